@@ -349,6 +349,28 @@ typedef uint16_t LexicalBlockIndex;
 #define STRING_SUB_STRING_MIN_VIEW_LENGTH 32
 #endif
 
+// a view that is shorter than 1/STRING_SUB_STRING_VIEW_MAX_PARENT_RATIO of a parent longer than
+// STRING_SUB_STRING_VIEW_COMPACT_PARENT_LENGTH is remembered, and VMInstance::compactSmallStringViews copies it
+// so that small pieces of a huge input do not keep the whole input alive
+#ifndef STRING_SUB_STRING_VIEW_COMPACT_PARENT_LENGTH
+#define STRING_SUB_STRING_VIEW_COMPACT_PARENT_LENGTH (1024 * 64)
+#endif
+
+#ifndef STRING_SUB_STRING_VIEW_MAX_PARENT_RATIO
+#define STRING_SUB_STRING_VIEW_MAX_PARENT_RATIO 16
+#endif
+
+// the remembered views are checked for dead ones when this many or twice the live ones are remembered
+#ifndef STRING_SUB_STRING_VIEW_TRACK_PRUNE_SIZE
+#define STRING_SUB_STRING_VIEW_TRACK_PRUNE_SIZE 1024
+#endif
+
+// stringFromUTF8File maps a pure ASCII file at least this large into memory when the caller allows it.
+// smaller files are copied, since mapping them saves little
+#ifndef STRING_FROM_FILE_MAP_SIZE_MIN
+#define STRING_FROM_FILE_MAP_SIZE_MIN (1024 * 64)
+#endif
+
 #ifndef STRING_BUILDER_INLINE_STORAGE_MAX
 #define STRING_BUILDER_INLINE_STORAGE_MAX 24
 #endif
@@ -357,11 +379,60 @@ typedef uint16_t LexicalBlockIndex;
 #define FUNCTION_OBJECT_BYTECODE_SIZE_MAX 1024 * 1024 * 2
 #endif
 
+// build the bytecode position to source index table of ByteCodeBlock along with its bytecode
+// the table is part of ByteCodeBlock::memoryAllocatedSize, so it shares FUNCTION_OBJECT_BYTECODE_SIZE_MAX budget
+// if 0, the table is built by parsing and generating the code again when a stack trace needs it
+#ifndef ENABLE_BYTECODE_LOC_DATA_ON_GENERATION
+#define ENABLE_BYTECODE_LOC_DATA_ON_GENERATION 1
+#endif
+
+// maximum number of frames recorded for the stack trace of a thrown exception
+#ifndef STACK_TRACE_CAPTURE_DEPTH_MAX
+#define STACK_TRACE_CAPTURE_DEPTH_MAX 64
+#endif
+
+// number of Scripts compiled by eval and the Function constructor kept per Context. 0 disables the cache
+#ifndef EVAL_CODE_CACHE_ENTRY_MAX
+#define EVAL_CODE_CACHE_ENTRY_MAX 64
+#endif
+
+// longer sources are compiled without being cached
+#ifndef EVAL_CODE_CACHE_SOURCE_LENGTH_MAX
+#define EVAL_CODE_CACHE_SOURCE_LENGTH_MAX (1024 * 64)
+#endif
+
+// sources at least this long are kept in the ScriptSourceStore of the VMInstance,
+// which shares identical sources and compresses the ones not used recently. 0 disables the store
+#ifndef SCRIPT_SOURCE_STORE_LENGTH_MIN
+#define SCRIPT_SOURCE_STORE_LENGTH_MIN (1024 * 16)
+#endif
+
+// bytes of stored source text kept uncompressed. above this, the sources not used for a while are compressed
+#ifndef SCRIPT_SOURCE_STORE_UNCOMPRESSED_SIZE_MAX
+#define SCRIPT_SOURCE_STORE_UNCOMPRESSED_SIZE_MAX (1024 * 1024 * 4)
+#endif
+
 
 #ifndef ROPE_STRING_MIN_LENGTH
 #define ROPE_STRING_MIN_LENGTH 24
 #endif
 
+// rope-aware access (charAt, substring) rebuilds a rope into a balanced tree
+// when its depth exceeds this value
+#ifndef ROPE_STRING_MAX_DEPTH
+#define ROPE_STRING_MAX_DEPTH 32
+#endif
+
+// while rebuilding a rope, adjacent leaves shorter than this are merged into one flat leaf
+#ifndef ROPE_STRING_LEAF_MERGE_LENGTH
+#define ROPE_STRING_LEAF_MERGE_LENGTH 512
+#endif
+
+// after this many rope-aware accesses to the same rope, it is flattened instead
+#ifndef ROPE_STRING_ACCESS_COUNT_BEFORE_FLATTEN
+#define ROPE_STRING_ACCESS_COUNT_BEFORE_FLATTEN 32
+#endif
+
 #include "heap/Heap.h"
 #include "CheckedArithmetic.h"
 #include "runtime/String.h"
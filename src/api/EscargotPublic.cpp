@@ -24,6 +24,8 @@
 #include "EscargotPublic.h"
 #include "parser/ast/Node.h"
 #include "parser/ScriptParser.h"
+#include "parser/EvalCodeCache.h"
+#include "parser/ScriptScanningTask.h"
 #include "parser/CodeBlock.h"
 #include "runtime/Context.h"
 #include "runtime/FunctionObject.h"
@@ -45,6 +47,7 @@
 #include "runtime/PromiseObject.h"
 #include "runtime/ProxyObject.h"
 #include "runtime/ArrayBufferObject.h"
+#include "runtime/ExternalString.h"
 #include "runtime/TypedArrayObject.h"
 #include "runtime/SetObject.h"
 #include "runtime/WeakSetObject.h"
@@ -145,6 +148,16 @@ inline SmallValueVector* toImpl(ValueVectorRef* v)
     return reinterpret_cast<SmallValueVector*>(v);
 }
 
+inline ObjectTemplateRef* toRef(ObjectStructure* v)
+{
+    return reinterpret_cast<ObjectTemplateRef*>(v);
+}
+
+inline ObjectStructure* toImpl(ObjectTemplateRef* v)
+{
+    return reinterpret_cast<ObjectStructure*>(v);
+}
+
 inline AtomicStringRef* toRef(const AtomicString& v)
 {
     return reinterpret_cast<AtomicStringRef*>(v.string());
@@ -308,6 +321,25 @@ StringRef* StringRef::createFromLatin1(const unsigned char* s, size_t len)
     return toRef(new Latin1String(s, len));
 }
 
+StringRef* StringRef::createExternalFromLatin1(const unsigned char* s, size_t len, ExternalStringReleaseCallback releaseCallback, void* data)
+{
+    return toRef(new ExternalLatin1String(s, len, releaseCallback, data));
+}
+
+StringRef* StringRef::createExternalFromUTF16(const char16_t* s, size_t len, ExternalStringReleaseCallback releaseCallback, void* data)
+{
+    return toRef(new ExternalUTF16String(s, len, releaseCallback, data));
+}
+
+OptionalRef<StringRef> StringRef::createFromUTF8File(const char* fileName, bool mayMapFile)
+{
+    String* str = stringFromUTF8File(fileName, mayMapFile);
+    if (str != nullptr) {
+        return toRef(str);
+    }
+    return nullptr;
+}
+
 StringRef* StringRef::emptyString()
 {
     return toRef(String::emptyString);
@@ -660,6 +692,8 @@ void VMInstanceRef::clearCachesRelatedWithContext()
     imp->m_regexpCache.clear();
     imp->m_cachedUTC = nullptr;
     imp->globalSymbolRegistry().clear();
+    imp->scriptSourceStore()->compressAll();
+    imp->compactSmallStringViews();
 }
 
 #define DECLARE_GLOBAL_SYMBOLS(name)                      \
@@ -1071,6 +1105,53 @@ void ObjectRef::enumerateObjectOwnProperies(ExecutionStateRef* state, const std:
                               (void*)&cb);
 }
 
+ObjectTemplateRef* ObjectTemplateRef::create(ExecutionStateRef* state, const size_t propertyCount, ValueRef** propertyNames)
+{
+    ExecutionState& s = *toImpl(state);
+    ObjectStructurePropertyDescriptor desc = ObjectStructurePropertyDescriptor::createDataDescriptor(ObjectStructurePropertyDescriptor::AllPresent);
+    if (propertyCount <= ESCARGOT_OBJECT_STRUCTURE_ACCESS_CACHE_BUILD_MIN_SIZE) {
+        // follow the transitions, so instances share their structure with objects built by ObjectRef::set or by script
+        ObjectStructure* structure = s.context()->defaultStructureForObject();
+        for (size_t i = 0; i < propertyCount; i++) {
+            PropertyName name(s, toImpl(propertyNames[i]));
+            ASSERT(structure->findProperty(name) == SIZE_MAX);
+            structure = structure->addProperty(s, name, desc);
+        }
+        return toRef(structure);
+    }
+
+    // a structure with fast access belongs to a single object
+    // so keep a plain structure here and convert it for each instance
+    ObjectStructureItemVector properties;
+    bool hasIndexPropertyName = false;
+    for (size_t i = 0; i < propertyCount; i++) {
+        PropertyName name(s, toImpl(propertyNames[i]));
+        hasIndexPropertyName = hasIndexPropertyName || name.isIndexString();
+        properties.pushBack(ObjectStructureItem(name, desc));
+    }
+    return toRef(new ObjectStructure(s, std::move(properties), false, hasIndexPropertyName));
+}
+
+size_t ObjectTemplateRef::propertyCount()
+{
+    return toImpl(this)->propertyCount();
+}
+
+ObjectRef* ObjectTemplateRef::instantiate(ExecutionStateRef* state, ValueRef** values)
+{
+    ExecutionState& s = *toImpl(state);
+    ObjectStructure* structure = toImpl(this);
+    size_t count = structure->propertyCount();
+    if (UNLIKELY(count > ESCARGOT_OBJECT_STRUCTURE_ACCESS_CACHE_BUILD_MIN_SIZE)) {
+        structure = structure->convertToWithFastAccess(s);
+    }
+    Value* newValues = ALLOCA(sizeof(Value) * count, Value, state);
+    for (size_t i = 0; i < count; i++) {
+        newValues[i] = toImpl(values[i]);
+    }
+    return toRef(new Object(s, structure, newValues));
+}
+
 FunctionObjectRef* GlobalObjectRef::object()
 {
     return toRef(toImpl(this)->object());
@@ -1370,6 +1451,7 @@ ObjectRef* GlobalObjectRef::float64ArrayPrototype()
 class CallPublicFunctionData : public CallNativeFunctionData {
 public:
     FunctionObjectRef::NativeFunctionPointer m_publicFn;
+    FunctionObjectRef::FastNativeFunctionPointer m_publicFastFn;
 };
 
 static Value publicFunctionBridge(ExecutionState& state, Value thisValue, size_t calledArgc, Value* calledArgv, bool isNewExpression)
@@ -1384,11 +1466,54 @@ static Value publicFunctionBridge(ExecutionState& state, Value thisValue, size_t
     return toImpl(code->m_publicFn(toRef(&state), toRef(thisValue), calledArgc, newArgv, isNewExpression));
 }
 
+static FastCallValue publicFastFunctionBridge(CallNativeFunctionData* data, FastCallValue* argv)
+{
+    CallPublicFunctionData* code = (CallPublicFunctionData*)data;
+
+    FunctionObjectRef::FastCallValue newArgv[ESCARGOT_FAST_CALL_ARGUMENT_MAX];
+    for (size_t i = 0; i < code->m_fastArgumentCount; i++) {
+        if (code->m_fastArgumentTypes[i] == FastCallType::String) {
+            newArgv[i].m_string = toRef(argv[i].m_string);
+        } else {
+            memcpy(&newArgv[i], &argv[i], sizeof(FastCallValue));
+        }
+    }
+
+    FunctionObjectRef::FastCallValue result = code->m_publicFastFn(newArgv);
+    FastCallValue newResult;
+    if (code->m_fastReturnType == FastCallType::String) {
+        newResult.m_string = toImpl(result.m_string);
+    } else {
+        memcpy(&newResult, &result, sizeof(FastCallValue));
+    }
+    return newResult;
+}
+
+COMPILE_ASSERT((int)FunctionObjectRef::FastCallVoid == (int)FastCallType::Void, "");
+COMPILE_ASSERT((int)FunctionObjectRef::FastCallBool == (int)FastCallType::Bool, "");
+COMPILE_ASSERT((int)FunctionObjectRef::FastCallInt32 == (int)FastCallType::Int32, "");
+COMPILE_ASSERT((int)FunctionObjectRef::FastCallDouble == (int)FastCallType::Double, "");
+COMPILE_ASSERT((int)FunctionObjectRef::FastCallString == (int)FastCallType::String, "");
+COMPILE_ASSERT(sizeof(FunctionObjectRef::FastCallValue) == sizeof(FastCallValue), "");
+COMPILE_ASSERT((int)FunctionObjectRef::FastNativeFunctionInfo::ArgumentCountMax == ESCARGOT_FAST_CALL_ARGUMENT_MAX, "");
+
 static FunctionObjectRef* createFunction(ExecutionStateRef* state, FunctionObjectRef::NativeFunctionInfo info, bool isBuiltin)
 {
     CallPublicFunctionData* data = new CallPublicFunctionData();
     data->m_fn = publicFunctionBridge;
     data->m_publicFn = info.m_nativeFunction;
+    if (info.m_fastNativeFunction.m_function) {
+        const FunctionObjectRef::FastNativeFunctionInfo& fastInfo = info.m_fastNativeFunction;
+        RELEASE_ASSERT(fastInfo.m_argumentCount <= ESCARGOT_FAST_CALL_ARGUMENT_MAX);
+        data->m_fastFn = publicFastFunctionBridge;
+        data->m_publicFastFn = fastInfo.m_function;
+        data->m_fastReturnType = (FastCallType)fastInfo.m_returnType;
+        data->m_fastArgumentCount = fastInfo.m_argumentCount;
+        for (size_t i = 0; i < fastInfo.m_argumentCount; i++) {
+            ASSERT(fastInfo.m_argumentTypes[i] != FunctionObjectRef::FastCallVoid);
+            data->m_fastArgumentTypes[i] = (FastCallType)fastInfo.m_argumentTypes[i];
+        }
+    }
 
     CodeBlock* cb = new CodeBlock(toImpl(state)->context(), toImpl(info.m_name), info.m_argumentCount, info.m_isStrict, info.m_isConstructor, data);
     FunctionObject* f;
@@ -1496,6 +1621,21 @@ void ContextRef::setSecurityPolicyCheckCallback(SecurityPolicyCheckCallback cb)
     });
 }
 
+size_t ContextRef::evalCodeCacheHitCount()
+{
+    return toImpl(this)->evalCodeCache()->hitCount();
+}
+
+size_t ContextRef::evalCodeCacheMissCount()
+{
+    return toImpl(this)->evalCodeCache()->missCount();
+}
+
+void ContextRef::clearEvalCodeCache()
+{
+    toImpl(this)->evalCodeCache()->clear();
+}
+
 OptionalRef<FunctionObjectRef> ExecutionStateRef::resolveCallee()
 {
     auto ec = toImpl(this);
@@ -1819,6 +1959,15 @@ ArrayObjectRef* ArrayObjectRef::create(ExecutionStateRef* state, ValueVectorRef*
     return toRef(ret);
 }
 
+ArrayObjectRef* ArrayObjectRef::create(ExecutionStateRef* state, const size_t length, ValueRef** values)
+{
+    Value* newValues = ALLOCA(sizeof(Value) * length, Value, state);
+    for (size_t i = 0; i < length; i++) {
+        newValues[i] = toImpl(values[i]);
+    }
+    return toRef(new ArrayObject(*toImpl(state), newValues, length));
+}
+
 IteratorObjectRef* ArrayObjectRef::values(ExecutionStateRef* state)
 {
     return toRef(toImpl(this)->values(*toImpl(state)));
@@ -1995,6 +2144,11 @@ void ArrayBufferObjectRef::attachBuffer(ExecutionStateRef* state, void* buffer,
     toImpl(this)->attachBuffer(*toImpl(state), buffer, bytelength);
 }
 
+void ArrayBufferObjectRef::attachExternalBuffer(ExecutionStateRef* state, void* buffer, size_t bytelength, ExternalBufferReleaseCallback releaseCallback, void* data)
+{
+    toImpl(this)->attachExternalBuffer(*toImpl(state), buffer, bytelength, releaseCallback, data);
+}
+
 void ArrayBufferObjectRef::detachArrayBuffer(ExecutionStateRef* state)
 {
     toImpl(this)->detachArrayBuffer(*toImpl(state));
@@ -2300,9 +2454,38 @@ ScriptRef* ScriptParserRef::InitializeScriptResult::fetchScriptThrowsExceptionIf
     return script.value();
 }
 
-ScriptParserRef::InitializeScriptResult ScriptParserRef::initializeScript(StringRef* script, StringRef* fileName, bool isModule)
+inline ScriptScanningTask* toImpl(ScriptScanningTaskRef* v)
+{
+    return reinterpret_cast<ScriptScanningTask*>(v);
+}
+
+inline ScriptScanningTaskRef* toRef(ScriptScanningTask* v)
+{
+    return reinterpret_cast<ScriptScanningTaskRef*>(v);
+}
+
+ScriptScanningTaskRef* ScriptScanningTaskRef::create(const char* utf8Source, size_t length)
+{
+    return toRef(new ScriptScanningTask(utf8Source, length));
+}
+
+void ScriptScanningTaskRef::run()
+{
+    toImpl(this)->run();
+}
+
+bool ScriptScanningTaskRef::hasRun()
+{
+    return toImpl(this)->hasRun();
+}
+
+void ScriptScanningTaskRef::destroy()
+{
+    delete toImpl(this);
+}
+
+static ScriptParserRef::InitializeScriptResult toInitializeScriptResultRef(ScriptParser::InitializeScriptResult internalResult)
 {
-    auto internalResult = toImpl(this)->initializeScript(toImpl(script), toImpl(fileName), isModule);
     ScriptParserRef::InitializeScriptResult result;
     if (internalResult.script) {
         result.script = toRef(internalResult.script.value());
@@ -2314,6 +2497,20 @@ ScriptParserRef::InitializeScriptResult ScriptParserRef::initializeScript(String
     return result;
 }
 
+ScriptParserRef::InitializeScriptResult ScriptParserRef::initializeScript(StringRef* script, StringRef* fileName, bool isModule)
+{
+    return toInitializeScriptResultRef(toImpl(this)->initializeScript(toImpl(script), toImpl(fileName), isModule));
+}
+
+ScriptParserRef::InitializeScriptResult ScriptParserRef::initializeScript(ScriptScanningTaskRef* task, StringRef* fileName, bool isModule)
+{
+    ScriptScanningTask* impl = toImpl(task);
+    String* source = impl->takeString();
+    auto internalResult = toImpl(this)->initializeScript(StringView(source), toImpl(fileName), isModule, nullptr, false, false, false, false, SIZE_MAX, true, false, false, impl->tokenTable());
+    impl->tokenTable()->clear();
+    return toInitializeScriptResultRef(internalResult);
+}
+
 bool ScriptRef::isModule()
 {
     return toImpl(this)->isModule();
@@ -32,6 +32,7 @@
 #include <cstddef>
 #include <string>
 #include <functional>
+#include <initializer_list>
 #include <limits>
 #include <tuple>
 #include <type_traits>
@@ -50,6 +51,7 @@ class SymbolRef;
 class ValueRef;
 class PointerValueRef;
 class ObjectRef;
+class ObjectTemplateRef;
 class GlobalObjectRef;
 class FunctionObjectRef;
 class ArrayObjectRef;
@@ -80,6 +82,7 @@ class ProxyObjectRef;
 class PlatformRef;
 class ScriptRef;
 class ScriptParserRef;
+class ScriptScanningTaskRef;
 class ExecutionStateRef;
 class ValueVectorRef;
 class JobRef;
@@ -529,6 +532,10 @@ public:
     typedef void (*OnVMInstanceDelete)(VMInstanceRef* instance);
     void setOnVMInstanceDelete(OnVMInstanceDelete cb);
 
+    // also compresses the sources of large scripts until they are needed again,
+    // and copies small substrings of large strings so that they stop keeping the large strings alive.
+    // the copy replaces the buffer of a live string, so this must not be called from a native function
+    // or any other callback which runs while a script is executing
     void clearCachesRelatedWithContext();
 
     PlatformRef* platform();
@@ -571,6 +578,11 @@ public:
     VirtualIdentifierCallback virtualIdentifierCallback();
 
     void setSecurityPolicyCheckCallback(SecurityPolicyCheckCallback cb);
+
+    // statistics of the cache of code compiled by eval and the Function constructor
+    size_t evalCodeCacheHitCount();
+    size_t evalCodeCacheMissCount();
+    void clearEvalCodeCache();
 };
 
 // AtomicStringRef is never deleted by gc until VMInstance destroyed
@@ -767,6 +779,21 @@ public:
     static StringRef* createFromUTF8(const char* s, size_t len);
     static StringRef* createFromUTF16(const char16_t* s, size_t len);
     static StringRef* createFromLatin1(const unsigned char* s, size_t len);
+
+    // create strings on top of characters owned by the client, without copying them
+    // the characters must not change until releaseCallback is called (from GC finalizer) with s, len and data
+    // releaseCallback can be nullptr if the characters outlive the VM
+    typedef void (*ExternalStringReleaseCallback)(const void* s, size_t len, void* data);
+    static StringRef* createExternalFromLatin1(const unsigned char* s, size_t len, ExternalStringReleaseCallback releaseCallback, void* data);
+    static StringRef* createExternalFromUTF16(const char16_t* s, size_t len, ExternalStringReleaseCallback releaseCallback, void* data);
+
+    // read a UTF-8 file. returns nullptr if the file cannot be opened
+    // with mayMapFile, a large pure ASCII file is memory-mapped and used without copying.
+    // the file must then stay unchanged while the string is alive: reading the string after the file
+    // is truncated raises SIGBUS, and rewriting it changes the string under its cached hash.
+    // only use it for files such as script sources that nobody writes while they run
+    static OptionalRef<StringRef> createFromUTF8File(const char* fileName, bool mayMapFile = false);
+
     static StringRef* emptyString();
 
     char16_t charAt(size_t idx);
@@ -779,6 +806,8 @@ public:
 
     // don't store this sturct
     // this is only for temporary access
+    // the buffer of a substring is replaced with a copy when the outermost ScriptRef::execute returns
+    // or VMInstanceRef::clearCachesRelatedWithContext is called, so don't keep the buffer across them
     struct StringBufferAccessDataRef {
         bool has8BitContent;
         size_t length;
@@ -975,6 +1004,18 @@ public:
     void removeFromHiddenClassChain(ExecutionStateRef* state);
 };
 
+// shape of plain objects which always have the same data properties in the same order
+// the shape is computed once, so instantiate() stores every value without per-property lookup or transition
+class ESCARGOT_EXPORT ObjectTemplateRef {
+public:
+    // propertyNames must not have duplicates
+    // every property is writable, enumerable and configurable like ObjectRef::set does
+    static ObjectTemplateRef* create(ExecutionStateRef* state, const size_t propertyCount, ValueRef** propertyNames);
+    size_t propertyCount();
+    // values[i] becomes the value of propertyNames[i]
+    ObjectRef* instantiate(ExecutionStateRef* state, ValueRef** values);
+};
+
 class ESCARGOT_EXPORT GlobalObjectRef : public ObjectRef {
 public:
     FunctionObjectRef* object();
@@ -1045,12 +1086,64 @@ public:
     // in constructor call, function must return newly created object && thisValue is always undefined
     typedef ValueRef* (*NativeFunctionPointer)(ExecutionStateRef* state, ValueRef* thisValue, size_t argc, ValueRef** argv, bool isConstructCall);
 
+    // typed entry point which receives unboxed arguments
+    // it is called instead of NativeFunctionPointer, without ExecutionStateRef and thisValue,
+    // when each declared argument already has its type (FastCallInt32 needs an int32 value, FastCallDouble takes any number)
+    // so it must give the same result as NativeFunctionPointer for such arguments, and it cannot throw or run script
+    enum FastCallType {
+        FastCallVoid, // return type only
+        FastCallBool,
+        FastCallInt32,
+        FastCallDouble,
+        FastCallString,
+    };
+
+    union FastCallValue {
+        bool m_bool;
+        int32_t m_int32;
+        double m_double;
+        StringRef* m_string;
+    };
+
+    typedef FastCallValue (*FastNativeFunctionPointer)(FastCallValue* argv);
+
+    struct FastNativeFunctionInfo {
+        enum { ArgumentCountMax = 8 };
+
+        FastNativeFunctionPointer m_function;
+        FastCallType m_returnType;
+        size_t m_argumentCount;
+        FastCallType m_argumentTypes[ArgumentCountMax];
+
+        FastNativeFunctionInfo()
+            : m_function(nullptr)
+            , m_returnType(FastCallVoid)
+            , m_argumentCount(0)
+        {
+        }
+
+        FastNativeFunctionInfo(FastNativeFunctionPointer fn, FastCallType returnType, std::initializer_list<FastCallType> argumentTypes)
+            : m_function(fn)
+            , m_returnType(returnType)
+            , m_argumentCount(argumentTypes.size())
+        {
+            // FunctionObjectRef::create rejects more than ArgumentCountMax arguments
+            size_t i = 0;
+            for (FastCallType type : argumentTypes) {
+                if (i < ArgumentCountMax) {
+                    m_argumentTypes[i++] = type;
+                }
+            }
+        }
+    };
+
     struct NativeFunctionInfo {
         bool m_isStrict;
         bool m_isConstructor;
         AtomicStringRef* m_name;
         NativeFunctionPointer m_nativeFunction;
         size_t m_argumentCount;
+        FastNativeFunctionInfo m_fastNativeFunction;
 
         NativeFunctionInfo(AtomicStringRef* name, NativeFunctionPointer fn, size_t argc, bool isStrict = true, bool isConstructor = true)
             : m_isStrict(isStrict)
@@ -1060,6 +1153,16 @@ public:
             , m_argumentCount(argc)
         {
         }
+
+        NativeFunctionInfo(AtomicStringRef* name, NativeFunctionPointer fn, size_t argc, const FastNativeFunctionInfo& fastFn, bool isStrict = true, bool isConstructor = true)
+            : m_isStrict(isStrict)
+            , m_isConstructor(isConstructor)
+            , m_name(name)
+            , m_nativeFunction(fn)
+            , m_argumentCount(argc)
+            , m_fastNativeFunction(fastFn)
+        {
+        }
     };
 
     static FunctionObjectRef* create(ExecutionStateRef* state, NativeFunctionInfo info);
@@ -1084,6 +1187,7 @@ class ESCARGOT_EXPORT ArrayObjectRef : public ObjectRef {
 public:
     static ArrayObjectRef* create(ExecutionStateRef* state);
     static ArrayObjectRef* create(ExecutionStateRef* state, ValueVectorRef* source);
+    static ArrayObjectRef* create(ExecutionStateRef* state, const size_t length, ValueRef** values);
     IteratorObjectRef* values(ExecutionStateRef* state);
     IteratorObjectRef* keys(ExecutionStateRef* state);
     IteratorObjectRef* entries(ExecutionStateRef* state);
@@ -1196,7 +1300,13 @@ public:
     static ArrayBufferObjectRef* create(ExecutionStateRef* state);
     void allocateBuffer(ExecutionStateRef* state, size_t bytelength);
     void attachBuffer(ExecutionStateRef* state, void* buffer, size_t bytelength);
+    // use memory owned by the client as the buffer, without copying it
+    // releaseCallback is called instead of PlatformRef::onArrayBufferObjectDataBufferFree
+    // when the buffer is detached or the ArrayBuffer is collected
+    typedef void (*ExternalBufferReleaseCallback)(void* buffer, size_t bytelength, void* data);
+    void attachExternalBuffer(ExecutionStateRef* state, void* buffer, size_t bytelength, ExternalBufferReleaseCallback releaseCallback, void* data);
     void detachArrayBuffer(ExecutionStateRef* state);
+    // the buffer itself, not a copy of it
     uint8_t* rawBuffer();
     unsigned byteLength();
     bool isDetachedBuffer();
@@ -1324,6 +1434,20 @@ public:
     void set(ExecutionStateRef* state, ObjectRef* key, ValueRef* value);
 };
 
+// decodes UTF-8 script source and scans its tokens ahead of parsing.
+// run() does not touch the GC heap, so it can be called from a worker thread
+// while the owning thread keeps running scripts.
+// parsing itself interns strings in the Context and allocates GC objects,
+// so it always happens on the thread which owns the Context
+class ESCARGOT_EXPORT ScriptScanningTaskRef {
+public:
+    // the source buffer must stay alive until run() is finished
+    static ScriptScanningTaskRef* create(const char* utf8Source, size_t length);
+    void run();
+    bool hasRun();
+    void destroy();
+};
+
 class ESCARGOT_EXPORT ScriptParserRef {
 public:
     struct InitializeScriptResult {
@@ -1341,6 +1465,9 @@ public:
     };
 
     InitializeScriptResult initializeScript(StringRef* scriptSource, StringRef* fileName, bool isModule = false);
+    // runs the task here if it has not run yet. the task must not be running on another thread
+    // the decoded buffer is moved into the script source without copying, and the scanned tokens are dropped after parsing
+    InitializeScriptResult initializeScript(ScriptScanningTaskRef* task, StringRef* fileName, bool isModule = false);
 };
 
 class ESCARGOT_EXPORT ScriptRef {
@@ -91,12 +91,45 @@ void* ByteCodeBlock::operator new(size_t size)
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 
+bool ByteCodeLOCData::find(size_t byteCodePosition, size_t& index) const
+{
+    size_t position = 0;
+    size_t encodedIndex = 0;
+    const uint8_t* data = m_data.data();
+    const uint8_t* end = data + m_data.size();
+    while (data < end) {
+        size_t values[2];
+        for (size_t i = 0; i < 2; i++) {
+            size_t value = 0;
+            size_t shift = 0;
+            uint8_t byte;
+            do {
+                byte = *data++;
+                value |= (size_t)(byte & 0x7f) << shift;
+                shift += 7;
+            } while (byte & 0x80);
+            values[i] = value;
+        }
+        position += values[0];
+        encodedIndex += (size_t)((intptr_t)(values[1] >> 1) ^ -(intptr_t)(values[1] & 1));
+
+        if (position == byteCodePosition) {
+            index = encodedIndex ? encodedIndex - 1 : SIZE_MAX;
+            return true;
+        } else if (position > byteCodePosition) {
+            break;
+        }
+    }
+    return false;
+}
+
 void ByteCodeBlock::fillLocDataIfNeeded(Context* c)
 {
     if (!m_codeBlock->isInterpretedCodeBlock() || m_locData || (m_codeBlock->isInterpretedCodeBlock() && m_codeBlock->asInterpretedCodeBlock()->src().length() == 0)) {
         return;
     }
 
+    // only reached when the table was not built along with the bytecode (ENABLE_BYTECODE_LOC_DATA_ON_GENERATION is 0)
     GC_disable();
 
     ByteCodeBlock* block;
@@ -111,8 +144,6 @@ void ByteCodeBlock::fillLocDataIfNeeded(Context* c)
     }
     m_locData = block->m_locData;
     block->m_locData = nullptr;
-    // prevent infinate fillLocDataIfNeeded if m_locData.size() == 0 in here
-    m_locData->push_back(std::make_pair(SIZE_MAX, SIZE_MAX));
 
     // reset ASTAllocator
     c->astAllocator().reset();
@@ -128,14 +159,8 @@ ExtendedNodeLOC ByteCodeBlock::computeNodeLOCFromByteCode(Context* c, size_t cod
     fillLocDataIfNeeded(c);
 
     size_t index = 0;
-    for (size_t i = 0; i < m_locData->size(); i++) {
-        if ((*m_locData)[i].first == codePosition) {
-            index = (*m_locData)[i].second;
-            if (index == SIZE_MAX) {
-                return ExtendedNodeLOC(SIZE_MAX, SIZE_MAX, SIZE_MAX);
-            }
-            break;
-        }
+    if (m_locData->find(codePosition, index) && index == SIZE_MAX) {
+        return ExtendedNodeLOC(SIZE_MAX, SIZE_MAX, SIZE_MAX);
     }
 
     size_t indexRelatedWithScript = index;
@@ -245,15 +270,28 @@ void* SetObjectInlineCache::operator new(size_t size)
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 
+void* EnumerateObjectKeyData::operator new(size_t size)
+{
+    static bool typeInited = false;
+    static GC_descr descr;
+    if (!typeInited) {
+        GC_word obj_bitmap[GC_BITMAP_SIZE(EnumerateObjectKeyData)] = { 0 };
+        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(EnumerateObjectKeyData, m_hiddenClassChain));
+        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(EnumerateObjectKeyData, m_keys));
+        descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(EnumerateObjectKeyData));
+        typeInited = true;
+    }
+    return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
+}
+
 void* EnumerateObjectData::operator new(size_t size)
 {
     static bool typeInited = false;
     static GC_descr descr;
     if (!typeInited) {
         GC_word obj_bitmap[GC_BITMAP_SIZE(EnumerateObjectData)] = { 0 };
-        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(EnumerateObjectData, m_hiddenClassChain));
+        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(EnumerateObjectData, m_keyData));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(EnumerateObjectData, m_object));
-        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(EnumerateObjectData, m_keys));
         descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(EnumerateObjectData));
         typeInited = true;
     }
@@ -26,6 +26,7 @@
 #include "runtime/SmallValue.h"
 #include "runtime/String.h"
 #include "runtime/Value.h"
+#include "runtime/ArrayBufferObject.h"
 
 namespace Escargot {
 class ObjectStructure;
@@ -714,12 +715,15 @@ public:
         , m_objectRegisterIndex(objectRegisterIndex)
         , m_propertyRegisterIndex(propertyRegisterIndex)
         , m_storeRegisterIndex(storeRegisterIndex)
+        , m_cachedTypedArrayType(TypedArrayType::Uint8)
     {
     }
 
     ByteCodeRegisterIndex m_objectRegisterIndex;
     ByteCodeRegisterIndex m_propertyRegisterIndex;
     ByteCodeRegisterIndex m_storeRegisterIndex;
+    // kind of the typed array last accessed here; the fast path only checks the tag of this kind
+    TypedArrayType m_cachedTypedArrayType : 8;
 
 #ifndef NDEBUG
     void dump(const char* byteCodeStart)
@@ -736,12 +740,15 @@ public:
         , m_objectRegisterIndex(objectRegisterIndex)
         , m_propertyRegisterIndex(propertyRegisterIndex)
         , m_loadRegisterIndex(loadRegisterIndex)
+        , m_cachedTypedArrayType(TypedArrayType::Uint8)
     {
     }
 
     ByteCodeRegisterIndex m_objectRegisterIndex;
     ByteCodeRegisterIndex m_propertyRegisterIndex;
     ByteCodeRegisterIndex m_loadRegisterIndex;
+    // kind of the typed array last accessed here; the fast path only checks the tag of this kind
+    TypedArrayType m_cachedTypedArrayType : 8;
 
 #ifndef NDEBUG
     void dump(const char* byteCodeStart)
@@ -1915,20 +1922,31 @@ public:
 #endif
 };
 
+// keys of a for-in loop, with the structures of the object and its prototype chain they were collected from
+// it is never modified once built, so loops over objects of the same shape can share it (see ObjectStructure::cachedEnumerateObjectKeyData)
+class EnumerateObjectKeyData : public gc {
+public:
+    ObjectStructureChainWithGC m_hiddenClassChain;
+    SmallValueVector m_keys;
+
+    void* operator new(size_t size);
+    void* operator new[](size_t size) = delete;
+};
+
 class EnumerateObjectData : public PointerValue {
 public:
     EnumerateObjectData()
     {
+        m_keyData = nullptr;
         m_object = nullptr;
         m_originalLength = 0;
         m_idx = 0;
     }
 
-    ObjectStructureChainWithGC m_hiddenClassChain;
+    EnumerateObjectKeyData* m_keyData;
     Object* m_object;
     uint64_t m_originalLength;
     size_t m_idx;
-    SmallValueVector m_keys;
 
     void* operator new(size_t size);
     void* operator new[](size_t size) = delete;
@@ -2264,7 +2282,62 @@ public:
 
 
 typedef Vector<char, std::allocator<char>, 200> ByteCodeBlockData;
-typedef std::vector<std::pair<size_t, size_t>, std::allocator<std::pair<size_t, size_t>>> ByteCodeLOCData;
+
+// source index of each bytecode, in code order
+// every entry is stored as two LEB128 varints: the growth of the bytecode position
+// and the zigzag encoded change of (source index + 1), where 0 stands for a code without source location
+class ByteCodeLOCData {
+public:
+    ByteCodeLOCData()
+        : m_lastByteCodePosition(0)
+        , m_lastIndex(0)
+    {
+    }
+
+    void pushBack(size_t byteCodePosition, size_t index)
+    {
+        ASSERT(byteCodePosition >= m_lastByteCodePosition);
+        size_t encodedIndex = index == SIZE_MAX ? 0 : index + 1;
+        pushVarint(byteCodePosition - m_lastByteCodePosition);
+        pushVarint(zigzagEncode((intptr_t)(encodedIndex - m_lastIndex)));
+        m_lastByteCodePosition = byteCodePosition;
+        m_lastIndex = encodedIndex;
+    }
+
+    // returns false if there is no entry for byteCodePosition
+    // index becomes SIZE_MAX when the code at byteCodePosition has no source location
+    bool find(size_t byteCodePosition, size_t& index) const;
+
+    void shrinkToFit()
+    {
+        m_data.shrink_to_fit();
+    }
+
+    size_t memoryAllocatedSize() const
+    {
+        return m_data.capacity();
+    }
+
+private:
+    void pushVarint(size_t value)
+    {
+        while (value >= 0x80) {
+            m_data.push_back((uint8_t)(value | 0x80));
+            value >>= 7;
+        }
+        m_data.push_back((uint8_t)value);
+    }
+
+    static size_t zigzagEncode(intptr_t value)
+    {
+        return ((size_t)value << 1) ^ (size_t)(value >> (sizeof(intptr_t) * 8 - 1));
+    }
+
+    std::vector<uint8_t> m_data;
+    size_t m_lastByteCodePosition;
+    size_t m_lastIndex;
+};
+
 typedef Vector<void*, GCUtil::gc_malloc_allocator<void*>> ByteCodeLiteralData;
 typedef Vector<Value, std::allocator<Value>> ByteCodeNumeralLiteralData;
 typedef std::unordered_set<ObjectStructure*, std::hash<ObjectStructure*>, std::equal_to<ObjectStructure*>,
@@ -2327,7 +2400,7 @@ public:
         char* first = (char*)&code;
         size_t start = m_code.size();
         if (context->m_shouldGenerateLOCData)
-            m_locData->push_back(std::make_pair(start, idx));
+            m_locData->pushBack(start, idx);
 
         m_code.resizeWithUninitializedValues(m_code.size() + sizeof(CodeType));
         for (size_t i = 0; i < sizeof(CodeType); i++) {
@@ -2381,7 +2454,7 @@ public:
     size_t memoryAllocatedSize()
     {
         size_t siz = m_code.size();
-        siz += m_locData ? (m_locData->size() * sizeof(std::pair<size_t, size_t>)) : 0;
+        siz += m_locData ? m_locData->memoryAllocatedSize() : 0;
         siz += m_literalData.size() * sizeof(size_t);
         siz += m_objectStructuresInUse->size() * sizeof(size_t);
         siz += m_getObjectCodePositions.size() * sizeof(size_t);
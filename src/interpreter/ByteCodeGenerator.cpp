@@ -135,8 +135,9 @@ ByteCodeBlock* ByteCodeGenerator::generateByteCode(Context* c, InterpretedCodeBl
     }
 
     ByteCodeGenerateContext ctx(codeBlock, block, info, nData);
-    ctx.m_shouldGenerateLOCData = shouldGenerateLOCData;
-    if (shouldGenerateLOCData) {
+    // shouldGenerateLOCData is for ByteCodeBlock::fillLocDataIfNeeded, which needs the table even if it is not built by default
+    ctx.m_shouldGenerateLOCData = ENABLE_BYTECODE_LOC_DATA_ON_GENERATION || shouldGenerateLOCData;
+    if (ctx.m_shouldGenerateLOCData) {
         block->m_locData = new ByteCodeLOCData();
     }
 
@@ -156,7 +157,7 @@ ByteCodeBlock* ByteCodeGenerator::generateByteCode(Context* c, InterpretedCodeBl
             delete block->m_locData;
         }
         block->m_locData = new ByteCodeLOCData();
-        block->m_locData->push_back(std::make_pair(0, err.m_index));
+        block->m_locData->pushBack(0, err.m_index);
     } catch (const char* err) {
         // TODO
         RELEASE_ASSERT_NOT_REACHED();
@@ -176,6 +177,10 @@ ByteCodeBlock* ByteCodeGenerator::generateByteCode(Context* c, InterpretedCodeBl
 
     block->m_getObjectCodePositions = std::move(ctx.m_getObjectCodePositions);
 
+    if (block->m_locData) {
+        block->m_locData->shrinkToFit();
+    }
+
     {
         ByteCodeRegisterIndex stackBase = REGULAR_REGISTER_LIMIT;
         ByteCodeRegisterIndex stackBaseWillBe = block->m_requiredRegisterFileSizeInValueSize;
@@ -87,6 +87,7 @@ struct ByteCodeGenerateContext {
         , m_isLeftBindingAffectedByRightExpression(false)
         , m_registerStack(new std::vector<ByteCodeRegisterIndex>())
         , m_lexicallyDeclaredNames(new std::vector<std::pair<size_t, AtomicString>>())
+        , m_childBlockCursor(new InterpretedCodeBlock::ChildBlockCursor())
         , m_positionToContinue(0)
         , m_complexJumpBreakIgnoreCount(0)
         , m_complexJumpContinueIgnoreCount(0)
@@ -121,6 +122,7 @@ struct ByteCodeGenerateContext {
         , m_isLeftBindingAffectedByRightExpression(contextBefore.m_isLeftBindingAffectedByRightExpression)
         , m_registerStack(contextBefore.m_registerStack)
         , m_lexicallyDeclaredNames(contextBefore.m_lexicallyDeclaredNames)
+        , m_childBlockCursor(contextBefore.m_childBlockCursor)
         , m_positionToContinue(contextBefore.m_positionToContinue)
         , m_recursiveStatementStack(contextBefore.m_recursiveStatementStack)
         , m_complexJumpBreakIgnoreCount(contextBefore.m_complexJumpBreakIgnoreCount)
@@ -320,6 +322,7 @@ struct ByteCodeGenerateContext {
 
     std::shared_ptr<std::vector<ByteCodeRegisterIndex>> m_registerStack;
     std::shared_ptr<std::vector<std::pair<size_t, AtomicString>>> m_lexicallyDeclaredNames;
+    std::shared_ptr<InterpretedCodeBlock::ChildBlockCursor> m_childBlockCursor;
     std::vector<size_t> m_breakStatementPositions;
     std::vector<size_t> m_continueStatementPositions;
     std::vector<std::pair<String*, size_t>> m_labeledBreakStatmentPositions;
@@ -42,11 +42,89 @@
 #include "util/Util.h"
 #include "../third_party/checked_arithmetic/CheckedArithmetic.h"
 #include "runtime/ProxyObject.h"
+#include "runtime/TypedArrayObject.h"
 
 namespace Escargot {
 
 #define ADD_PROGRAM_COUNTER(CodeType) programCounter += sizeof(CodeType);
 
+// Element access on a typed array whose tag was checked against g_typedArrayObjectTags[type].
+// An index out of bounds or a detached buffer is left to the generic path.
+ALWAYS_INLINE bool getTypedArrayElement(ArrayBufferView* view, TypedArrayType type, uint32_t index, Value& result)
+{
+    if (UNLIKELY(index >= view->arrayLength()) || UNLIKELY(view->buffer()->isDetachedBuffer())) {
+        return false;
+    }
+    uint8_t* raw = view->rawBuffer();
+    switch (type) {
+    case TypedArrayType::Int8:
+        result = Value(((int8_t*)raw)[index]);
+        break;
+    case TypedArrayType::Int16:
+        result = Value(((int16_t*)raw)[index]);
+        break;
+    case TypedArrayType::Int32:
+        result = Value(((int32_t*)raw)[index]);
+        break;
+    case TypedArrayType::Uint8:
+    case TypedArrayType::Uint8Clamped:
+        result = Value(raw[index]);
+        break;
+    case TypedArrayType::Uint16:
+        result = Value(((uint16_t*)raw)[index]);
+        break;
+    case TypedArrayType::Uint32:
+        result = Value(((uint32_t*)raw)[index]);
+        break;
+    case TypedArrayType::Float32:
+        result = Value(((float*)raw)[index]);
+        break;
+    case TypedArrayType::Float64:
+        result = Value(((double*)raw)[index]);
+        break;
+    }
+    return true;
+}
+
+// Stores of values that are not numbers yet also take the generic path, because ToNumber may run user code.
+ALWAYS_INLINE bool setTypedArrayElement(ExecutionState& state, ArrayBufferView* view, TypedArrayType type, uint32_t index, const Value& value)
+{
+    if (UNLIKELY(!value.isNumber()) || UNLIKELY(index >= view->arrayLength()) || UNLIKELY(view->buffer()->isDetachedBuffer())) {
+        return false;
+    }
+    uint8_t* raw = view->rawBuffer();
+    switch (type) {
+    case TypedArrayType::Int8:
+        ((int8_t*)raw)[index] = Int8Adaptor::toNative(state, value);
+        break;
+    case TypedArrayType::Int16:
+        ((int16_t*)raw)[index] = Int16Adaptor::toNative(state, value);
+        break;
+    case TypedArrayType::Int32:
+        ((int32_t*)raw)[index] = Int32Adaptor::toNative(state, value);
+        break;
+    case TypedArrayType::Uint8:
+        raw[index] = Uint8Adaptor::toNative(state, value);
+        break;
+    case TypedArrayType::Uint8Clamped:
+        raw[index] = Uint8ClampedAdaptor::toNative(state, value);
+        break;
+    case TypedArrayType::Uint16:
+        ((uint16_t*)raw)[index] = Uint16Adaptor::toNative(state, value);
+        break;
+    case TypedArrayType::Uint32:
+        ((uint32_t*)raw)[index] = Uint32Adaptor::toNative(state, value);
+        break;
+    case TypedArrayType::Float32:
+        ((float*)raw)[index] = Float32Adaptor::toNative(state, value);
+        break;
+    case TypedArrayType::Float64:
+        ((double*)raw)[index] = Float64Adaptor::toNative(state, value);
+        break;
+    }
+    return true;
+}
+
 ALWAYS_INLINE size_t jumpTo(char* codeBuffer, const size_t jumpPosition)
 {
     return (size_t)&codeBuffer[jumpPosition];
@@ -472,6 +550,12 @@ Value ByteCodeInterpreter::interpret(ExecutionState* state, ByteCodeBlock* byteC
                         }
                     }
                 }
+            } else if (willBeObject.isObject() && v->hasTag(g_typedArrayObjectTags[code->m_cachedTypedArrayType])) {
+                uint32_t idx = property.tryToUseAsArrayIndex(*state);
+                if (LIKELY(getTypedArrayElement((ArrayBufferView*)v, code->m_cachedTypedArrayType, idx, registerFile[code->m_storeRegisterIndex]))) {
+                    ADD_PROGRAM_COUNTER(GetObject);
+                    NEXT_INSTRUCTION();
+                }
             }
             JUMP_INSTRUCTION(GetObjectOpcodeSlowCase);
         }
@@ -501,6 +585,12 @@ Value ByteCodeInterpreter::interpret(ExecutionState* state, ByteCodeBlock* byteC
                         NEXT_INSTRUCTION();
                     }
                 }
+            } else if (willBeObject.isObject() && willBeObject.asPointerValue()->hasTag(g_typedArrayObjectTags[code->m_cachedTypedArrayType])) {
+                uint32_t idx = property.tryToUseAsArrayIndex(*state);
+                if (LIKELY(setTypedArrayElement(*state, (ArrayBufferView*)willBeObject.asPointerValue(), code->m_cachedTypedArrayType, idx, registerFile[code->m_loadRegisterIndex]))) {
+                    ADD_PROGRAM_COUNTER(SetObjectOperation);
+                    NEXT_INSTRUCTION();
+                }
             }
             JUMP_INSTRUCTION(SetObjectOpcodeSlowCase);
         }
@@ -1096,7 +1186,7 @@ Value ByteCodeInterpreter::interpret(ExecutionState* state, ByteCodeBlock* byteC
             EnumerateObjectKey* code = (EnumerateObjectKey*)programCounter;
             EnumerateObjectData* data = (EnumerateObjectData*)registerFile[code->m_dataRegisterIndex].asPointerValue();
             data->m_idx++;
-            registerFile[code->m_registerIndex] = Value(data->m_keys[data->m_idx - 1]).toString(*state);
+            registerFile[code->m_registerIndex] = Value(data->m_keyData->m_keys[data->m_idx - 1]).toString(*state);
             ADD_PROGRAM_COUNTER(EnumerateObjectKey);
             NEXT_INSTRUCTION();
         }
@@ -1263,13 +1353,9 @@ Value ByteCodeInterpreter::interpret(ExecutionState* state, ByteCodeBlock* byteC
             const Value& iterator = registerFile[code->m_iterIndex];
 
             size_t i = 0;
-            while (true) {
-                Value next = iteratorStep(*state, iterator);
-                if (next.isFalse()) {
-                    break;
-                }
-
-                array->setIndexedProperty(*state, Value(i++), iteratorValue(*state, next));
+            Value value;
+            while (iteratorStepValue(*state, iterator, value)) {
+                array->setIndexedProperty(*state, Value(i++), value);
             }
 
             registerFile[code->m_dstIndex] = array;
@@ -1886,6 +1972,23 @@ NEVER_INLINE void ByteCodeInterpreter::setObjectPreComputedCaseOperationCacheMis
     }
 }
 
+// whether keyData was collected from an object with the same structure as obj and a prototype chain with the same structures
+// only plain objects are checked, since the own keys of other objects may not be described by their structure
+bool ByteCodeInterpreter::isCachedEnumerateObjectKeyDataValid(ExecutionState& state, Object* obj, EnumerateObjectKeyData* keyData)
+{
+    const ObjectStructureChainWithGC& chain = keyData->m_hiddenClassChain;
+    size_t i = 0;
+    Object* target = obj;
+    while (target) {
+        if (i == chain.size() || !target->hasTag(g_objectTag) || chain[i].m_objectStructure != target->structure()) {
+            return false;
+        }
+        i++;
+        target = target->getPrototypeObject(state);
+    }
+    return i == chain.size();
+}
+
 NEVER_INLINE EnumerateObjectData* ByteCodeInterpreter::executeEnumerateObject(ExecutionState& state, Object* obj)
 {
     EnumerateObjectData* data = new EnumerateObjectData();
@@ -1893,12 +1996,23 @@ NEVER_INLINE EnumerateObjectData* ByteCodeInterpreter::executeEnumerateObject(Ex
     data->m_originalLength = 0;
     if (obj->isArrayObject())
         data->m_originalLength = obj->length(state);
+
+    EnumerateObjectKeyData* cachedKeyData = obj->structure()->cachedEnumerateObjectKeyData();
+    if (cachedKeyData && isCachedEnumerateObjectKeyDataValid(state, obj, cachedKeyData)) {
+        data->m_keyData = cachedKeyData;
+        return data;
+    }
+
+    EnumerateObjectKeyData* keyData = new EnumerateObjectKeyData();
+    data->m_keyData = keyData;
+    // the keys of plain objects without enumerable properties on their prototype chain depend only on the structures
+    bool isCacheable = obj->hasTag(g_objectTag);
     Value target = data->m_object;
     bool shouldSearchProto = false;
     ObjectStructureChainItem newItem;
     newItem.m_objectStructure = target.asObject()->structure();
 
-    data->m_hiddenClassChain.push_back(newItem);
+    keyData->m_hiddenClassChain.push_back(newItem);
 
     std::unordered_set<String*, std::hash<String*>, std::equal_to<String*>, GCUtil::gc_malloc_allocator<String*>> keyStringSet;
 
@@ -1915,8 +2029,9 @@ NEVER_INLINE EnumerateObjectData* ByteCodeInterpreter::executeEnumerateObject(Ex
             },
                                            &shouldSearchProto);
         }
+        isCacheable = isCacheable && target.asObject()->hasTag(g_objectTag);
         newItem.m_objectStructure = target.asObject()->structure();
-        data->m_hiddenClassChain.push_back(newItem);
+        keyData->m_hiddenClassChain.push_back(newItem);
         target = target.asObject()->getPrototype(state);
     }
 
@@ -1925,11 +2040,11 @@ NEVER_INLINE EnumerateObjectData* ByteCodeInterpreter::executeEnumerateObject(Ex
     if (shouldSearchProto) {
         struct EData {
             std::unordered_set<String*, std::hash<String*>, std::equal_to<String*>, GCUtil::gc_malloc_allocator<String*>>* keyStringSet;
-            EnumerateObjectData* data;
+            EnumerateObjectKeyData* data;
             Object* obj;
         } eData;
 
-        eData.data = data;
+        eData.data = keyData;
         eData.keyStringSet = &keyStringSet;
         eData.obj = obj;
         while (target.isObject()) {
@@ -1977,13 +2092,17 @@ NEVER_INLINE EnumerateObjectData* ByteCodeInterpreter::executeEnumerateObject(Ex
 
         std::sort(params.indexes.begin(), params.indexes.end(), std::less<Value::ValueIndex>());
 
-        data->m_keys.resizeWithUninitializedValues(params.indexes.size() + params.strings.size());
+        keyData->m_keys.resizeWithUninitializedValues(params.indexes.size() + params.strings.size());
         size_t idx = 0;
         for (auto& v : params.indexes) {
-            data->m_keys[idx++] = Value(v).toString(state);
+            keyData->m_keys[idx++] = Value(v).toString(state);
         }
         for (auto& v : params.strings) {
-            data->m_keys[idx++] = v;
+            keyData->m_keys[idx++] = v;
+        }
+
+        if (isCacheable) {
+            obj->structure()->setCachedEnumerateObjectKeyData(keyData);
         }
     }
 
@@ -1997,13 +2116,15 @@ NEVER_INLINE EnumerateObjectData* ByteCodeInterpreter::executeEnumerateObject(Ex
 NEVER_INLINE EnumerateObjectData* ByteCodeInterpreter::updateEnumerateObjectData(ExecutionState& state, EnumerateObjectData* data)
 {
     EnumerateObjectData* newData = executeEnumerateObject(state, data->m_object);
+    const SmallValueVector& keys = data->m_keyData->m_keys;
     std::vector<Value, GCUtil::gc_malloc_allocator<Value>> oldKeys;
-    if (data->m_keys.size()) {
-        oldKeys.insert(oldKeys.end(), &data->m_keys[0], &data->m_keys[data->m_keys.size() - 1] + 1);
+    if (keys.size()) {
+        oldKeys.insert(oldKeys.end(), &keys[0], &keys[keys.size() - 1] + 1);
     }
     std::vector<Value, GCUtil::gc_malloc_allocator<Value>> differenceKeys;
-    for (size_t i = 0; i < newData->m_keys.size(); i++) {
-        const Value& key = newData->m_keys[i];
+    const SmallValueVector& newKeys = newData->m_keyData->m_keys;
+    for (size_t i = 0; i < newKeys.size(); i++) {
+        const Value& key = newKeys[i];
         // If a property that has not yet been visited during enumeration is deleted, then it will not be visited.
         if (std::find(oldKeys.begin(), oldKeys.begin() + data->m_idx, key) == oldKeys.begin() + data->m_idx && std::find(oldKeys.begin() + data->m_idx, oldKeys.end(), key) != oldKeys.end()) {
             // If new properties are added to the object being enumerated during enumeration,
@@ -2011,13 +2132,15 @@ NEVER_INLINE EnumerateObjectData* ByteCodeInterpreter::updateEnumerateObjectData
             differenceKeys.push_back(key);
         }
     }
-    data = newData;
-    data->m_keys.clear();
-    data->m_keys.resizeWithUninitializedValues(differenceKeys.size());
+    // the key data of newData may be shared with other loops, so the remaining keys go to a copy of it
+    EnumerateObjectKeyData* keyData = new EnumerateObjectKeyData();
+    keyData->m_hiddenClassChain = newData->m_keyData->m_hiddenClassChain;
+    keyData->m_keys.resizeWithUninitializedValues(differenceKeys.size());
     for (size_t i = 0; i < differenceKeys.size(); i++) {
-        data->m_keys[i] = differenceKeys[i];
+        keyData->m_keys[i] = differenceKeys[i];
     }
-    return data;
+    newData->m_keyData = keyData;
+    return newData;
 }
 
 ALWAYS_INLINE Object* ByteCodeInterpreter::fastToObject(ExecutionState& state, const Value& obj)
@@ -3164,13 +3287,9 @@ NEVER_INLINE void ByteCodeInterpreter::createSpreadArrayObject(ExecutionState& s
 
     Value iterator = getIterator(state, registerFile[code->m_argumentIndex]);
     size_t i = 0;
-    while (true) {
-        Value next = iteratorStep(state, iterator);
-        if (next.isFalse()) {
-            break;
-        }
-        Value value = iteratorValue(state, next);
-        spreadArray->setIndexedProperty(state, Value(i++), iteratorValue(state, next));
+    Value value;
+    while (iteratorStepValue(state, iterator, value)) {
+        spreadArray->setIndexedProperty(state, Value(i++), value);
     }
     registerFile[code->m_registerIndex] = spreadArray;
 }
@@ -3269,8 +3388,9 @@ NEVER_INLINE void ByteCodeInterpreter::checkIfKeyIsLast(ExecutionState& state, C
     EnumerateObjectData* data = (EnumerateObjectData*)registerFile[code->m_registerIndex].asPointerValue();
     bool shouldUpdateEnumerateObjectData = false;
     Object* obj = data->m_object;
-    for (size_t i = 0; i < data->m_hiddenClassChain.size(); i++) {
-        auto hc = data->m_hiddenClassChain[i];
+    const ObjectStructureChainWithGC& hiddenClassChain = data->m_keyData->m_hiddenClassChain;
+    for (size_t i = 0; i < hiddenClassChain.size(); i++) {
+        auto hc = hiddenClassChain[i];
         ObjectStructureChainItem testItem;
         testItem.m_objectStructure = obj->structure();
         if (hc != testItem) {
@@ -3297,7 +3417,7 @@ NEVER_INLINE void ByteCodeInterpreter::checkIfKeyIsLast(ExecutionState& state, C
         data = (EnumerateObjectData*)registerFile[code->m_registerIndex].asPointerValue();
     }
 
-    if (data->m_keys.size() <= data->m_idx) {
+    if (data->m_keyData->m_keys.size() <= data->m_idx) {
         programCounter = jumpTo(codeBuffer, code->m_forInEndPosition);
     } else {
         ADD_PROGRAM_COUNTER(CheckIfKeyIsLast);
@@ -3313,9 +3433,9 @@ NEVER_INLINE void ByteCodeInterpreter::getIteratorOperation(ExecutionState& stat
 NEVER_INLINE void ByteCodeInterpreter::iteratorStepOperation(ExecutionState& state, size_t& programCounter, Value* registerFile, char* codeBuffer)
 {
     IteratorStep* code = (IteratorStep*)programCounter;
-    Value nextResult = iteratorStep(state, registerFile[code->m_iterRegisterIndex]);
+    Value value;
 
-    if (nextResult.isFalse()) {
+    if (!iteratorStepValue(state, registerFile[code->m_iterRegisterIndex], value)) {
         if (code->m_forOfEndPosition == SIZE_MAX) {
             registerFile[code->m_registerIndex] = Value();
             ADD_PROGRAM_COUNTER(IteratorStep);
@@ -3323,7 +3443,7 @@ NEVER_INLINE void ByteCodeInterpreter::iteratorStepOperation(ExecutionState& sta
             programCounter = jumpTo(codeBuffer, code->m_forOfEndPosition);
         }
     } else {
-        registerFile[code->m_registerIndex] = iteratorValue(state, nextResult);
+        registerFile[code->m_registerIndex] = value;
         ADD_PROGRAM_COUNTER(IteratorStep);
     }
 }
@@ -3363,6 +3483,9 @@ NEVER_INLINE void ByteCodeInterpreter::getObjectOpcodeSlowCase(ExecutionState& s
     } else {
         obj = fastToObject(state, willBeObject);
     }
+    if (obj->isTypedArrayObject()) {
+        code->m_cachedTypedArrayType = obj->asArrayBufferView()->typedArrayType();
+    }
     registerFile[code->m_storeRegisterIndex] = obj->getIndexedProperty(state, property).value(state, willBeObject);
 }
 
@@ -3373,6 +3496,8 @@ NEVER_INLINE void ByteCodeInterpreter::setObjectOpcodeSlowCase(ExecutionState& s
     Object* obj = willBeObject.toObject(state);
     if (willBeObject.isPrimitive()) {
         obj->preventExtensions(state);
+    } else if (obj->isTypedArrayObject()) {
+        code->m_cachedTypedArrayType = obj->asArrayBufferView()->typedArrayType();
     }
 
     bool result = obj->setIndexedProperty(state, property, registerFile[code->m_loadRegisterIndex]);
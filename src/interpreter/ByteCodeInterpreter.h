@@ -33,6 +33,7 @@ class LexicalEnvironment;
 struct GetObjectInlineCache;
 struct SetObjectInlineCache;
 class EnumerateObjectData;
+class EnumerateObjectKeyData;
 struct GlobalVariableAccessCacheItem;
 class InitializeGlobalVariable;
 class CallFunctionInWithScope;
@@ -98,6 +99,7 @@ public:
 
     static EnumerateObjectData* executeEnumerateObject(ExecutionState& state, Object* obj);
     static EnumerateObjectData* updateEnumerateObjectData(ExecutionState& state, EnumerateObjectData* data);
+    static bool isCachedEnumerateObjectKeyDataValid(ExecutionState& state, Object* obj, EnumerateObjectKeyData* keyData);
 
     static Object* fastToObject(ExecutionState& state, const Value& obj);
 
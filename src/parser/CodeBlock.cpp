@@ -191,7 +191,8 @@ void InterpretedCodeBlock::initBlockScopeInformation(ASTFunctionScopeContext* sc
 
 InterpretedCodeBlock::InterpretedCodeBlock(Context* ctx, Script* script, StringView src, ASTFunctionScopeContext* scopeCtx, ExtendedNodeLOC paramsStartLOC, bool isEvalCode, bool isEvalCodeInFunction)
     : m_script(script)
-    , m_src(src)
+    , m_srcLength(src.length())
+    , m_parameterNames(nullptr)
     , m_identifierOnStackCount(0)
     , m_identifierOnHeapCount(0)
     , m_lexicalBlockStackAllocatedIdentifierMaximumDepth(0)
@@ -264,7 +265,8 @@ InterpretedCodeBlock::InterpretedCodeBlock(Context* ctx, Script* script, StringV
 
 InterpretedCodeBlock::InterpretedCodeBlock(Context* ctx, Script* script, StringView src, ASTFunctionScopeContext* scopeCtx, ExtendedNodeLOC paramsStartLOC, InterpretedCodeBlock* parentBlock, bool isEvalCode, bool isEvalCodeInFunction)
     : m_script(script)
-    , m_src(StringView(src, scopeCtx->m_paramsStartLOC.index, scopeCtx->m_bodyEndLOC.index))
+    , m_srcLength(scopeCtx->m_bodyEndLOC.index - scopeCtx->m_paramsStartLOC.index)
+    , m_parameterNames(nullptr)
     , m_identifierOnStackCount(0)
     , m_identifierOnHeapCount(0)
     , m_lexicalBlockStackAllocatedIdentifierMaximumDepth(0)
@@ -316,11 +318,6 @@ InterpretedCodeBlock::InterpretedCodeBlock(Context* ctx, Script* script, StringV
     m_allowSuperCall = scopeCtx->m_allowSuperCall;
     m_allowSuperProperty = scopeCtx->m_allowSuperProperty;
 
-    m_parameterNames.resizeWithUninitializedValues(parameterNames.size());
-    for (size_t i = 0; i < parameterNames.size(); i++) {
-        m_parameterNames[i] = parameterNames[i];
-    }
-
     m_canUseIndexedVariableStorage = !m_hasEval && !m_isEvalCode && !m_hasWith;
     m_canAllocateEnvironmentOnStack = m_canUseIndexedVariableStorage && !m_isGenerator;
     m_canAllocateVariablesOnStack = true;
@@ -367,7 +364,7 @@ void InterpretedCodeBlock::captureArguments()
         // Unmapped arguments object doesn't connect arguments object property with arguments variable
         if (isMapped) {
             m_canAllocateEnvironmentOnStack = false;
-            for (size_t j = 0; j < m_parameterNames.size(); j++) {
+            for (size_t j = 0; j < m_parameterCount; j++) {
                 for (size_t k = 0; k < m_identifierInfos.size(); k++) {
                     if (m_identifierInfos[k].m_name == m_parameterNames[j]) {
                         m_identifierInfos[k].m_needToAllocateOnStack = false;
@@ -390,14 +387,10 @@ std::pair<bool, size_t> InterpretedCodeBlock::tryCaptureIdentifiersFromChildCode
         return std::make_pair(true, std::get<1>(r));
     }
 
-    if (m_astContext->mayContainVarName(name)) {
-        size_t siz = m_identifierInfos.size();
-        for (size_t i = 0; i < siz; i++) {
-            if (m_identifierInfos[i].m_name == name) {
-                m_identifierInfos[i].m_needToAllocateOnStack = false;
-                return std::make_pair(true, SIZE_MAX);
-            }
-        }
+    size_t index = findVarNameOnTreeBuilding(name);
+    if (index != SIZE_MAX) {
+        m_identifierInfos[index].m_needToAllocateOnStack = false;
+        return std::make_pair(true, SIZE_MAX);
     }
     return std::make_pair(false, SIZE_MAX);
 }
@@ -677,6 +670,12 @@ void InterpretedCodeBlock::computeVariables()
     }
 }
 
+StringView InterpretedCodeBlock::src()
+{
+    size_t start = m_sourceElementStart.index;
+    return StringView(m_script->sourceCode(), start, start + m_srcLength);
+}
+
 bool InterpretedCodeBlock::needsToLoadThisBindingFromEnvironment()
 {
     if (isClassConstructor()) {
@@ -60,9 +60,44 @@ struct NativeFunctionInfo {
     }
 };
 
+// typed entry point of a native function, called with unboxed arguments and without an ExecutionState
+enum class FastCallType : uint8_t {
+    Void, // return type only
+    Bool,
+    Int32,
+    Double,
+    String,
+};
+
+union FastCallValue {
+    bool m_bool;
+    int32_t m_int32;
+    double m_double;
+    String* m_string;
+};
+
+class CallNativeFunctionData;
+typedef FastCallValue (*FastNativeFunctionPointer)(CallNativeFunctionData* data, FastCallValue* argv);
+
+#define ESCARGOT_FAST_CALL_ARGUMENT_MAX 8
+
 class CallNativeFunctionData : public gc {
 public:
+    CallNativeFunctionData()
+        : m_fn(nullptr)
+        , m_fastFn(nullptr)
+        , m_fastReturnType(FastCallType::Void)
+        , m_fastArgumentCount(0)
+    {
+    }
+
     NativeFunctionPointer m_fn;
+    // NativeFunctionObject::call uses m_fastFn instead of m_fn
+    // when every one of the first m_fastArgumentCount arguments already has its declared type
+    FastNativeFunctionPointer m_fastFn;
+    FastCallType m_fastReturnType;
+    uint8_t m_fastArgumentCount;
+    FastCallType m_fastArgumentTypes[ESCARGOT_FAST_CALL_ARGUMENT_MAX];
 };
 
 class InterpretedCodeBlock;
@@ -373,7 +408,8 @@ public:
     /* capture ok, block vector index(if not block variable, returns SIZE_MAX) */
     std::pair<bool, size_t> tryCaptureIdentifiersFromChildCodeBlock(LexicalBlockIndex blockIndex, AtomicString name);
 
-    const AtomicStringTightVector& parameterNames() const
+    // shared between code blocks with the same parameter list, see ScriptParser::sharedParameterNames
+    const AtomicString* parameterNames() const
     {
         return m_parameterNames;
     }
@@ -409,10 +445,36 @@ public:
     };
 
 
+    // index of a variable in the stack or heap storage of its code block, kept in 16 bits.
+    // ScriptParser rejects code blocks whose indexed storage would not fit.
+    // UINT16_MAX is the escape value and reads back as SIZE_MAX (no index),
+    // so environment records without indexed storage look such variables up by name
+    class StorageIndex {
+    public:
+        StorageIndex(size_t index = SIZE_MAX)
+        {
+            *this = index;
+        }
+
+        StorageIndex& operator=(size_t index)
+        {
+            m_index = index < UINT16_MAX ? index : UINT16_MAX;
+            return *this;
+        }
+
+        operator size_t() const
+        {
+            return m_index == UINT16_MAX ? SIZE_MAX : m_index;
+        }
+
+    private:
+        uint16_t m_index;
+    };
+
     struct BlockIdentifierInfo {
         bool m_needToAllocateOnStack : 1;
         bool m_isMutable : 1;
-        size_t m_indexForIndexedStorage; // TODO reduce variable size into uint16_t.
+        StorageIndex m_indexForIndexedStorage;
         AtomicString m_name;
     };
 
@@ -455,7 +517,7 @@ public:
         bool m_isMutable : 1;
         bool m_isExplicitlyDeclaredOrParameterName : 1;
         bool m_isVarDeclaration : 1;
-        size_t m_indexForIndexedStorage; // TODO reduce variable size into uint16_t.
+        StorageIndex m_indexForIndexedStorage;
         AtomicString m_name;
     };
 
@@ -597,6 +659,37 @@ public:
         return c;
     }
 
+    // remembers the last child found by childBlockAt,
+    // so looking children up in source order does not walk the sibling list from the head each time
+    struct ChildBlockCursor {
+        size_t m_index;
+        InterpretedCodeBlock* m_block;
+
+        ChildBlockCursor()
+            : m_index(0)
+            , m_block(nullptr)
+        {
+        }
+    };
+
+    InterpretedCodeBlock* childBlockAt(size_t idx, ChildBlockCursor& cursor)
+    {
+        ASSERT(!!m_firstChild);
+        ASSERT(!cursor.m_block || cursor.m_block->parentCodeBlock() == this);
+        if (!cursor.m_block || idx < cursor.m_index) {
+            cursor.m_index = 0;
+            cursor.m_block = m_firstChild;
+        }
+
+        while (cursor.m_index < idx) {
+            ASSERT(cursor.m_block->nextSibling());
+            cursor.m_block = cursor.m_block->nextSibling();
+            cursor.m_index++;
+        }
+
+        return cursor.m_block;
+    }
+
     // You can use this function on ScriptParser only
     bool hasVarName(const AtomicString& name)
     {
@@ -615,15 +708,30 @@ public:
             return true;
         }
 
+        return findVarNameOnTreeBuilding(name) != SIZE_MAX;
+    }
+
+    // You can use this function on ScriptParser only
+    // m_identifierInfos mirrors m_astContext->m_varNames until computeVariables,
+    // so the scope context can answer the lookup
+    size_t findVarNameOnTreeBuilding(const AtomicString& name)
+    {
+        size_t index = m_astContext->findVarName(name);
+        if (index != SIZE_MAX) {
+            ASSERT(m_identifierInfos[index].m_name == name);
+            return index;
+        }
+
+        // `arguments` may be appended after the scope context's names
         if (m_astContext->mayContainVarName(name)) {
-            for (size_t i = 0; i < m_identifierInfos.size(); i++) {
+            for (size_t i = m_astContext->m_varNames.size(); i < m_identifierInfos.size(); i++) {
                 if (m_identifierInfos[i].m_name == name) {
-                    return true;
+                    return i;
                 }
             }
         }
 
-        return false;
+        return SIZE_MAX;
     }
 
     size_t findVarName(const AtomicString& name)
@@ -638,7 +746,7 @@ public:
 
     bool hasParameter(const AtomicString& name)
     {
-        for (size_t i = 0; i < m_parameterNames.size(); i++) {
+        for (size_t i = 0; i < m_parameterCount; i++) {
             if (m_parameterNames[i] == name) {
                 return true;
             }
@@ -646,10 +754,8 @@ public:
         return false;
     }
 
-    const StringView& src()
-    {
-        return m_src;
-    }
+    // function source including parameters
+    StringView src();
 
     ExtendedNodeLOC sourceElementStart()
     {
@@ -727,9 +833,9 @@ protected:
     }
 
     Script* m_script;
-    StringView m_src; // function source including parameters
+    size_t m_srcLength; // source of this code block starts at m_sourceElementStart.index of the script source
 
-    AtomicStringTightVector m_parameterNames;
+    AtomicString* m_parameterNames;
     uint16_t m_identifierOnStackCount; // this member variable only count `var`
     uint16_t m_identifierOnHeapCount; // this member variable only count `var`
     uint16_t m_lexicalBlockStackAllocatedIdentifierMaximumDepth; // this member variable only count `let`
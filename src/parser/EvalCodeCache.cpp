@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2016-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#include "Escargot.h"
+#include "EvalCodeCache.h"
+#include "parser/Script.h"
+
+namespace Escargot {
+
+Script* EvalCodeCache::find(const Key& key)
+{
+    if (!canCache(key.m_source)) {
+        return nullptr;
+    }
+
+    size_t hash = key.m_source->hashValue();
+    for (size_t i = 0; i < m_entries.size(); i++) {
+        Entry& e = m_entries[i];
+        if (e.m_hash == hash && isSameKey(e.m_key, key) && e.m_key.m_source->equals(key.m_source)) {
+            e.m_lastUsed = ++m_useCount;
+            m_hitCount++;
+            return e.m_script;
+        }
+    }
+
+    m_missCount++;
+    return nullptr;
+}
+
+void EvalCodeCache::insert(const Key& key, Script* script)
+{
+    if (!canCache(key.m_source)) {
+        return;
+    }
+
+    script->setCachedEvalCode();
+    Entry entry(key, key.m_source->hashValue(), ++m_useCount, script);
+    if (m_entries.size() < EVAL_CODE_CACHE_ENTRY_MAX) {
+        m_entries.pushBack(entry);
+        return;
+    }
+
+    // replace the least recently used entry
+    size_t victim = 0;
+    for (size_t i = 1; i < m_entries.size(); i++) {
+        if (m_entries[i].m_lastUsed < m_entries[victim].m_lastUsed) {
+            victim = i;
+        }
+    }
+    m_entries[victim] = entry;
+}
+
+void EvalCodeCache::clear()
+{
+    m_entries.clear();
+}
+}
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2016-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#ifndef __EscargotEvalCodeCache__
+#define __EscargotEvalCodeCache__
+
+#include "runtime/String.h"
+
+namespace Escargot {
+
+class Script;
+class InterpretedCodeBlock;
+
+// keeps Scripts compiled by eval and the Function constructor,
+// so the same source text is not parsed again each time it is evaluated.
+// a direct eval is compiled against its caller's code block,
+// so the caller code block and the parse options are part of the key
+class EvalCodeCache : public gc {
+public:
+    enum Kind : uint8_t {
+        IndirectEval,
+        DirectEval,
+        FunctionConstructor,
+    };
+
+    struct Key {
+        Key(Kind kind, String* source, InterpretedCodeBlock* parentCodeBlock = nullptr, bool strictFromOutside = false,
+            bool isEvalCodeInFunction = false, bool inWithOperation = false, bool allowSuperCall = false)
+            : m_source(source)
+            , m_parentCodeBlock(parentCodeBlock)
+            , m_kind(kind)
+            , m_strictFromOutside(strictFromOutside)
+            , m_isEvalCodeInFunction(isEvalCodeInFunction)
+            , m_inWithOperation(inWithOperation)
+            , m_allowSuperCall(allowSuperCall)
+        {
+        }
+
+        String* m_source;
+        InterpretedCodeBlock* m_parentCodeBlock;
+        Kind m_kind;
+        bool m_strictFromOutside : 1;
+        bool m_isEvalCodeInFunction : 1;
+        bool m_inWithOperation : 1;
+        bool m_allowSuperCall : 1;
+    };
+
+    EvalCodeCache()
+        : m_useCount(0)
+        , m_hitCount(0)
+        , m_missCount(0)
+    {
+    }
+
+    // returns nullptr if the key is not cached or cannot be cached
+    Script* find(const Key& key);
+    void insert(const Key& key, Script* script);
+    void clear();
+
+    static bool canCache(String* source)
+    {
+        return EVAL_CODE_CACHE_ENTRY_MAX != 0 && source->length() <= EVAL_CODE_CACHE_SOURCE_LENGTH_MAX;
+    }
+
+    size_t size() const
+    {
+        return m_entries.size();
+    }
+
+    size_t hitCount() const
+    {
+        return m_hitCount;
+    }
+
+    size_t missCount() const
+    {
+        return m_missCount;
+    }
+
+private:
+    struct Entry {
+        Key m_key;
+        size_t m_hash;
+        size_t m_lastUsed;
+        Script* m_script;
+
+        Entry(const Key& key, size_t hash, size_t lastUsed, Script* script)
+            : m_key(key)
+            , m_hash(hash)
+            , m_lastUsed(lastUsed)
+            , m_script(script)
+        {
+        }
+    };
+
+    static bool isSameKey(const Key& a, const Key& b)
+    {
+        return a.m_kind == b.m_kind && a.m_parentCodeBlock == b.m_parentCodeBlock && a.m_strictFromOutside == b.m_strictFromOutside
+            && a.m_isEvalCodeInFunction == b.m_isEvalCodeInFunction && a.m_inWithOperation == b.m_inWithOperation
+            && a.m_allowSuperCall == b.m_allowSuperCall;
+    }
+
+    Vector<Entry, GCUtil::gc_malloc_allocator<Entry>> m_entries;
+    size_t m_useCount;
+    size_t m_hitCount;
+    size_t m_missCount;
+};
+}
+
+#endif
@@ -44,6 +44,10 @@ const char* Messages::TemplateOctalLiteral = "Octal literals are not allowed in
  * value can represent an invalid octal value. */
 #define NON_OCTAL_VALUE 256
 
+/* Identifiers and string literals switch to the bulk
+ * StringConversion scanners once they are this long. */
+#define SCANNER_BULK_SCAN_MIN_LENGTH 16
+
 char EscargotLexer::g_asciiRangeCharMap[128] = {
     0,
     0,
@@ -344,99 +348,59 @@ struct ParserCharPiece {
     }
 };
 
-AtomicString keywordToString(::Escargot::Context* ctx, KeywordKind keyword)
+// indexed by KeywordKind
+static AtomicString StaticStrings::*const g_keywordStrings[KeywordKindEnd] = {
+    &StaticStrings::stringError, // NotKeyword
+    &StaticStrings::stringIf,
+    &StaticStrings::stringIn,
+    &StaticStrings::stringDo,
+    &StaticStrings::stringVar,
+    &StaticStrings::stringFor,
+    &StaticStrings::stringNew,
+    &StaticStrings::stringTry,
+    &StaticStrings::stringThis,
+    &StaticStrings::stringElse,
+    &StaticStrings::stringCase,
+    &StaticStrings::stringVoid,
+    &StaticStrings::stringWith,
+    &StaticStrings::stringEnum,
+    &StaticStrings::stringAwait,
+    &StaticStrings::stringWhile,
+    &StaticStrings::stringBreak,
+    &StaticStrings::stringCatch,
+    &StaticStrings::stringThrow,
+    &StaticStrings::stringConst,
+    &StaticStrings::stringClass,
+    &StaticStrings::stringSuper,
+    &StaticStrings::stringReturn,
+    &StaticStrings::stringTypeof,
+    &StaticStrings::stringDelete,
+    &StaticStrings::stringSwitch,
+    &StaticStrings::stringExport,
+    &StaticStrings::stringImport,
+    &StaticStrings::stringDefault,
+    &StaticStrings::stringFinally,
+    &StaticStrings::stringExtends,
+    &StaticStrings::function,
+    &StaticStrings::stringContinue,
+    &StaticStrings::stringDebugger,
+    &StaticStrings::stringInstanceof,
+    &StaticStrings::stringError, // StrictModeReservedWord
+    &StaticStrings::implements,
+    &StaticStrings::interface,
+    &StaticStrings::package,
+    &StaticStrings::stringPrivate,
+    &StaticStrings::stringProtected,
+    &StaticStrings::stringPublic,
+    &StaticStrings::stringStatic,
+    &StaticStrings::yield,
+    &StaticStrings::let,
+};
+
+AtomicString EscargotLexer::keywordToString(::Escargot::Context* ctx, KeywordKind keyword)
 {
-    switch (keyword) {
-    case IfKeyword:
-        return ctx->staticStrings().stringIf;
-    case InKeyword:
-        return ctx->staticStrings().stringIn;
-    case DoKeyword:
-        return ctx->staticStrings().stringDo;
-    case VarKeyword:
-        return ctx->staticStrings().stringVar;
-    case ForKeyword:
-        return ctx->staticStrings().stringFor;
-    case NewKeyword:
-        return ctx->staticStrings().stringNew;
-    case TryKeyword:
-        return ctx->staticStrings().stringTry;
-    case ThisKeyword:
-        return ctx->staticStrings().stringThis;
-    case ElseKeyword:
-        return ctx->staticStrings().stringElse;
-    case CaseKeyword:
-        return ctx->staticStrings().stringCase;
-    case VoidKeyword:
-        return ctx->staticStrings().stringVoid;
-    case WithKeyword:
-        return ctx->staticStrings().stringWith;
-    case EnumKeyword:
-        return ctx->staticStrings().stringEnum;
-    case AwaitKeyword:
-        return ctx->staticStrings().stringAwait;
-    case WhileKeyword:
-        return ctx->staticStrings().stringWhile;
-    case BreakKeyword:
-        return ctx->staticStrings().stringBreak;
-    case CatchKeyword:
-        return ctx->staticStrings().stringCatch;
-    case ThrowKeyword:
-        return ctx->staticStrings().stringThrow;
-    case ConstKeyword:
-        return ctx->staticStrings().stringConst;
-    case ClassKeyword:
-        return ctx->staticStrings().stringClass;
-    case SuperKeyword:
-        return ctx->staticStrings().stringSuper;
-    case ReturnKeyword:
-        return ctx->staticStrings().stringReturn;
-    case TypeofKeyword:
-        return ctx->staticStrings().stringTypeof;
-    case DeleteKeyword:
-        return ctx->staticStrings().stringDelete;
-    case SwitchKeyword:
-        return ctx->staticStrings().stringSwitch;
-    case ExportKeyword:
-        return ctx->staticStrings().stringExport;
-    case ImportKeyword:
-        return ctx->staticStrings().stringImport;
-    case DefaultKeyword:
-        return ctx->staticStrings().stringDefault;
-    case FinallyKeyword:
-        return ctx->staticStrings().stringFinally;
-    case ExtendsKeyword:
-        return ctx->staticStrings().stringExtends;
-    case FunctionKeyword:
-        return ctx->staticStrings().function;
-    case ContinueKeyword:
-        return ctx->staticStrings().stringContinue;
-    case DebuggerKeyword:
-        return ctx->staticStrings().stringDebugger;
-    case InstanceofKeyword:
-        return ctx->staticStrings().stringInstanceof;
-    case ImplementsKeyword:
-        return ctx->staticStrings().implements;
-    case InterfaceKeyword:
-        return ctx->staticStrings().interface;
-    case PackageKeyword:
-        return ctx->staticStrings().package;
-    case PrivateKeyword:
-        return ctx->staticStrings().stringPrivate;
-    case ProtectedKeyword:
-        return ctx->staticStrings().stringProtected;
-    case PublicKeyword:
-        return ctx->staticStrings().stringPublic;
-    case StaticKeyword:
-        return ctx->staticStrings().stringStatic;
-    case YieldKeyword:
-        return ctx->staticStrings().yield;
-    case LetKeyword:
-        return ctx->staticStrings().let;
-    default:
-        ASSERT_NOT_REACHED();
-        return ctx->staticStrings().stringError;
-    }
+    ASSERT(keyword != NotKeyword && keyword != StrictModeReservedWord && keyword < KeywordKindEnd);
+    return ctx->staticStrings().*g_keywordStrings[keyword];
 }
 
 void ErrorHandler::throwError(size_t index, size_t line, size_t col, String* description, ErrorObject::Code code)
@@ -488,6 +452,11 @@ Value Scanner::ScannerResult::valueStringLiteralForAST(Scanner* scannerInstance)
 {
     StringView sv = valueStringLiteral(scannerInstance);
     if (!this->hasAllocatedString) {
+        if (scannerInstance->copyStringLiterals) {
+            StringBuilder builder;
+            builder.appendSubString(sv.string(), sv.start(), sv.end());
+            return builder.finalize();
+        }
         return new StringView(sv);
     }
     return sv.string();
@@ -657,14 +626,18 @@ Scanner::Scanner(::Escargot::Context* escargotContext, StringView code, size_t s
     , index(0)
     , lineNumber(((length > 0) ? 1 : 0) + startLine)
     , lineStart(startColumn)
+    , copyStringLiterals(false)
 {
-    ASSERT(escargotContext != nullptr);
     // trackComment = false;
 }
 
 void Scanner::skipSingleLineComment(void)
 {
     while (!this->eof()) {
+        this->index += this->lineTerminatorFreeRunLength('\n', '\n');
+        if (this->eof()) {
+            break;
+        }
         char16_t ch = this->peekChar();
         ++this->index;
 
@@ -683,6 +656,10 @@ void Scanner::skipSingleLineComment(void)
 void Scanner::skipMultiLineComment(void)
 {
     while (!this->eof()) {
+        this->index += this->lineTerminatorFreeRunLength('*', '*');
+        if (this->eof()) {
+            break;
+        }
         char16_t ch = this->peekChar();
         ++this->index;
 
@@ -762,6 +739,10 @@ Scanner::ScanIDResult Scanner::getIdentifier()
         }
         if (isIdentifierPart(ch)) {
             ++this->index;
+            if (UNLIKELY(this->index - start >= SCANNER_BULK_SCAN_MIN_LENGTH)) {
+                // most identifiers are shorter than this, so only long ones pay for the bulk scan
+                this->index += this->identifierPartRunLength();
+            }
         } else {
             break;
         }
@@ -844,6 +825,9 @@ Scanner::ScanIDResult Scanner::getComplexIdentifier()
         }
     }
 
+    if (UNLIKELY(!this->escargotContext)) {
+        throw TokenTable::ScanError();
+    }
     String* str = new UTF16String(id.data(), id.length());
     return std::make_tuple(str->bufferAccessData(), str);
 }
@@ -1321,6 +1305,12 @@ void Scanner::scanStringLiteral(Scanner::ScannerResult* token)
     bool isPlainCase = true;
 
     while (LIKELY(!this->eof())) {
+        if (UNLIKELY(this->index - start >= SCANNER_BULK_SCAN_MIN_LENGTH)) {
+            this->index += this->lineTerminatorFreeRunLength(quote, '\\');
+            if (UNLIKELY(this->eof())) {
+                break;
+            }
+        }
         char16_t ch = this->peekChar();
         ++this->index;
         if (ch == quote) {
@@ -1532,16 +1522,22 @@ void Scanner::scanTemplate(Scanner::ScannerResult* token, bool head)
         this->throwUnexpectedToken();
     }
 
+    if (head) {
+        start--;
+    }
+
+    if (UNLIKELY(!this->escargotContext)) {
+        // a TokenTable needs only where the token ends
+        token->setTemplateTokenResult(nullptr, this->lineNumber, this->lineStart, start, this->index);
+        return;
+    }
+
     ScanTemplateResult* result = new ScanTemplateResult();
     result->head = head;
     result->tail = tail;
     result->valueRaw = UTF16StringData(raw.data(), raw.length());
     result->valueCooked = UTF16StringData(cooked.data(), cooked.length());
 
-    if (head) {
-        start--;
-    }
-
     token->setTemplateTokenResult(result, this->lineNumber, this->lineStart, start, this->index);
 }
 
@@ -1590,6 +1586,11 @@ String* Scanner::scanRegExpBody()
         this->throwUnexpectedToken(Messages::UnterminatedRegExp);
     }
 
+    if (UNLIKELY(!this->escargotContext)) {
+        // a TokenTable needs only where the token ends
+        return nullptr;
+    }
+
     // Exclude leading and trailing slash.
     str = str.substr(1, str.length() - 2);
     if (isAllASCII(str.data(), str.length())) {
@@ -1639,6 +1640,10 @@ String* Scanner::scanRegExpFlags()
         }
     }
 
+    if (UNLIKELY(!this->escargotContext)) {
+        return nullptr;
+    }
+
     if (isAllASCII(flags.data(), flags.length())) {
         return new ASCIIString(flags.data(), flags.length());
     }
@@ -1663,167 +1668,139 @@ void Scanner::scanRegExp(Scanner::ScannerResult* token)
 }
 
 // ECMA-262 11.6.2.1 Keywords
-static ALWAYS_INLINE KeywordKind isKeyword(const StringBufferAccessData& data)
+// 'const' is specialized as Keyword in V8.
+// 'yield' and 'let' are for compatibility with SpiderMonkey and ES.next.
+// Some others are from future reserved words.
+// null, true and false are recognized by the same lookup.
+struct KeywordTableEntry {
+    const char* m_name;
+    size_t m_length;
+    Token m_token;
+    KeywordKind m_keyword;
+};
+
+static constexpr KeywordTableEntry g_keywordTable[] = {
+    { "if", 2, Token::KeywordToken, IfKeyword },
+    { "in", 2, Token::KeywordToken, InKeyword },
+    { "do", 2, Token::KeywordToken, DoKeyword },
+    { "var", 3, Token::KeywordToken, VarKeyword },
+    { "for", 3, Token::KeywordToken, ForKeyword },
+    { "new", 3, Token::KeywordToken, NewKeyword },
+    { "try", 3, Token::KeywordToken, TryKeyword },
+    { "this", 4, Token::KeywordToken, ThisKeyword },
+    { "else", 4, Token::KeywordToken, ElseKeyword },
+    { "case", 4, Token::KeywordToken, CaseKeyword },
+    { "void", 4, Token::KeywordToken, VoidKeyword },
+    { "with", 4, Token::KeywordToken, WithKeyword },
+    { "enum", 4, Token::KeywordToken, EnumKeyword },
+    { "await", 5, Token::KeywordToken, AwaitKeyword },
+    { "while", 5, Token::KeywordToken, WhileKeyword },
+    { "break", 5, Token::KeywordToken, BreakKeyword },
+    { "catch", 5, Token::KeywordToken, CatchKeyword },
+    { "throw", 5, Token::KeywordToken, ThrowKeyword },
+    { "const", 5, Token::KeywordToken, ConstKeyword },
+    { "class", 5, Token::KeywordToken, ClassKeyword },
+    { "super", 5, Token::KeywordToken, SuperKeyword },
+    { "return", 6, Token::KeywordToken, ReturnKeyword },
+    { "typeof", 6, Token::KeywordToken, TypeofKeyword },
+    { "delete", 6, Token::KeywordToken, DeleteKeyword },
+    { "switch", 6, Token::KeywordToken, SwitchKeyword },
+    { "export", 6, Token::KeywordToken, ExportKeyword },
+    { "import", 6, Token::KeywordToken, ImportKeyword },
+    { "default", 7, Token::KeywordToken, DefaultKeyword },
+    { "finally", 7, Token::KeywordToken, FinallyKeyword },
+    { "extends", 7, Token::KeywordToken, ExtendsKeyword },
+    { "function", 8, Token::KeywordToken, FunctionKeyword },
+    { "continue", 8, Token::KeywordToken, ContinueKeyword },
+    { "debugger", 8, Token::KeywordToken, DebuggerKeyword },
+    { "instanceof", 10, Token::KeywordToken, InstanceofKeyword },
+    { "yield", 5, Token::KeywordToken, YieldKeyword },
+    { "let", 3, Token::KeywordToken, LetKeyword },
+    { "null", 4, Token::NullLiteralToken, NotKeyword },
+    { "true", 4, Token::BooleanLiteralToken, NotKeyword },
+    { "false", 5, Token::BooleanLiteralToken, NotKeyword },
+};
+
+#define KEYWORD_TABLE_SIZE (sizeof(g_keywordTable) / sizeof(KeywordTableEntry))
+#define KEYWORD_MIN_LENGTH 2
+#define KEYWORD_MAX_LENGTH 10
+#define KEYWORD_HASH_BITS 7
+#define KEYWORD_HASH_EMPTY_SLOT 255
+
+/* Multiplicative hash of the first, second and last characters and the length.
+ * The multiplier was searched offline so that every entry of g_keywordTable
+ * gets its own slot, which is checked by the COMPILE_ASSERT below. */
+static constexpr uint32_t keywordHash(uint32_t first, uint32_t second, uint32_t last, uint32_t length)
 {
-    // 'const' is specialized as Keyword in V8.
-    // 'yield' and 'let' are for compatibility with SpiderMonkey and ES.next.
-    // Some others are from future reserved words.
-
-    size_t length = data.length;
-    char16_t first = data.charAt(0);
-    char16_t second;
-    switch (first) {
-    case 'a':
-        if (length == 5 && data.equalsSameLength("await", 1)) {
-            return AwaitKeyword;
-        }
-        break;
-    case 'b':
-        if (length == 5 && data.equalsSameLength("break", 1)) {
-            return BreakKeyword;
-        }
-        break;
-    case 'c':
-        if (length == 4) {
-            if (data.equalsSameLength("case", 1)) {
-                return CaseKeyword;
-            }
-        } else if (length == 5) {
-            second = data.charAt(1);
-            if (second == 'a' && data.equalsSameLength("catch", 2)) {
-                return CatchKeyword;
-            } else if (second == 'o' && data.equalsSameLength("const", 2)) {
-                return ConstKeyword;
-            } else if (second == 'l' && data.equalsSameLength("class", 2)) {
-                return ClassKeyword;
-            }
-        } else if (length == 8 && data.equalsSameLength("continue", 1)) {
-            return ContinueKeyword;
-        }
-        break;
-    case 'd':
-        if (length == 8) {
-            if (data.equalsSameLength("debugger", 1)) {
-                return DebuggerKeyword;
-            }
-        } else if (length == 2) {
-            if (data.equalsSameLength("do", 1)) {
-                return DoKeyword;
-            }
-        } else if (length == 6) {
-            if (data.equalsSameLength("delete", 1)) {
-                return DeleteKeyword;
-            }
-        } else if (length == 7) {
-            if (data.equalsSameLength("default", 1)) {
-                return DefaultKeyword;
-            }
-        }
-        break;
-    case 'e':
-        if (length == 4) {
-            second = data.charAt(1);
-            if (second == 'l' && data.equalsSameLength("else", 2)) {
-                return ElseKeyword;
-            } else if (second == 'n' && data.equalsSameLength("enum", 2)) {
-                return EnumKeyword;
-            }
-        } else if (length == 6 && data.equalsSameLength("export", 1)) {
-            return ExportKeyword;
-        } else if (length == 7 && data.equalsSameLength("extends", 1)) {
-            return ExtendsKeyword;
-        }
-        break;
-    case 'f':
-        if (length == 3 && data.equalsSameLength("for", 1)) {
-            return ForKeyword;
-        } else if (length == 7 && data.equalsSameLength("finally", 1)) {
-            return FinallyKeyword;
-        } else if (length == 8 && data.equalsSameLength("function", 1)) {
-            return FunctionKeyword;
-        }
-        break;
-    case 'i':
-        if (length == 2) {
-            second = data.charAt(1);
-            if (second == 'f') {
-                return IfKeyword;
-            } else if (second == 'n') {
-                return InKeyword;
-            }
-        } else if (length == 6 && data.equalsSameLength("import", 1)) {
-            return ImportKeyword;
-        } else if (length == 10 && data.equalsSameLength("instanceof", 1)) {
-            return InstanceofKeyword;
-        }
-        break;
-    case 'l':
-        if (length == 3 && data.equalsSameLength("let", 1)) {
-            return LetKeyword;
-        }
-        break;
-    case 'n':
-        if (length == 3 && data.equalsSameLength("new", 1)) {
-            return NewKeyword;
-        }
-        break;
-    case 'r':
-        if (length == 6 && data.equalsSameLength("return", 1)) {
-            return ReturnKeyword;
-        }
-        break;
-    case 's':
-        if (length == 5 && data.equalsSameLength("super", 1)) {
-            return SuperKeyword;
-        } else if (length == 6 && data.equalsSameLength("switch", 1)) {
-            return SwitchKeyword;
-        }
-        break;
-    case 't':
-        switch (length) {
-        case 3:
-            if (data.equalsSameLength("try", 1)) {
-                return TryKeyword;
-            }
-            break;
-        case 4:
-            if (data.equalsSameLength("this", 1)) {
-                return ThisKeyword;
-            }
-            break;
-        case 5:
-            if (data.equalsSameLength("throw", 1)) {
-                return ThrowKeyword;
-            }
-            break;
-        case 6:
-            if (data.equalsSameLength("typeof", 1)) {
-                return TypeofKeyword;
-            }
-            break;
-        }
-        break;
-    case 'v':
-        if (length == 3 && data.equalsSameLength("var", 1)) {
-            return VarKeyword;
-        } else if (length == 4 && data.equalsSameLength("void", 1)) {
-            return VoidKeyword;
-        }
-        break;
-    case 'w':
-        if (length == 4 && data.equalsSameLength("with", 1)) {
-            return WithKeyword;
-        } else if (length == 5 && data.equalsSameLength("while", 1)) {
-            return WhileKeyword;
-        }
-        break;
-    case 'y':
-        if (length == 5 && data.equalsSameLength("yield", 1)) {
-            return YieldKeyword;
+    return ((first | (second << 8) | (last << 16) | (length << 24)) * 0x6c0f3459u) >> (32 - KEYWORD_HASH_BITS);
+}
+
+static constexpr uint32_t keywordHash(const KeywordTableEntry& entry)
+{
+    return keywordHash(entry.m_name[0], entry.m_name[1], entry.m_name[entry.m_length - 1], entry.m_length);
+}
+
+// maps keywordHash to an index of g_keywordTable
+static constexpr uint8_t g_keywordHashSlots[1 << KEYWORD_HASH_BITS] = {
+    4, 255, 255, 255, 255, 1, 7, 255, 255, 255, 255, 8, 22, 255, 255, 11,
+    255, 255, 255, 255, 255, 255, 255, 255, 33, 2, 38, 17, 255, 255, 10, 255,
+    255, 255, 255, 30, 255, 255, 32, 255, 255, 255, 255, 255, 35, 255, 27, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 19, 28, 13, 255, 255, 34,
+    255, 255, 6, 255, 255, 20, 16, 255, 25, 255, 255, 9, 26, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 21, 29, 255, 255, 255, 255, 255,
+    15, 255, 255, 37, 255, 255, 14, 5, 31, 255, 255, 18, 12, 36, 255, 255,
+    255, 255, 255, 255, 255, 255, 3, 0, 255, 23, 255, 24, 255, 255, 255, 255,
+};
+
+static constexpr bool isKeywordHashSlotValid(size_t slot, size_t usedCount)
+{
+    return slot == (1 << KEYWORD_HASH_BITS)
+        ? usedCount == KEYWORD_TABLE_SIZE
+        : (g_keywordHashSlots[slot] == KEYWORD_HASH_EMPTY_SLOT
+               ? isKeywordHashSlotValid(slot + 1, usedCount)
+               : (g_keywordHashSlots[slot] < KEYWORD_TABLE_SIZE && keywordHash(g_keywordTable[g_keywordHashSlots[slot]]) == slot
+                  && isKeywordHashSlotValid(slot + 1, usedCount + 1)));
+}
+
+COMPILE_ASSERT(isKeywordHashSlotValid(0, 0), "");
+
+template <typename CharType>
+static ALWAYS_INLINE const KeywordTableEntry* findKeyword(const CharType* chars, size_t length)
+{
+    char16_t first = chars[0];
+    char16_t second = chars[1];
+    char16_t last = chars[length - 1];
+    if ((first | second | last) >= 128) {
+        return nullptr;
+    }
+
+    uint8_t index = g_keywordHashSlots[keywordHash(first, second, last, length)];
+    if (index == KEYWORD_HASH_EMPTY_SLOT) {
+        return nullptr;
+    }
+
+    const KeywordTableEntry& entry = g_keywordTable[index];
+    if (entry.m_length != length) {
+        return nullptr;
+    }
+    for (size_t i = 0; i < length; i++) {
+        if (chars[i] != (CharType)entry.m_name[i]) {
+            return nullptr;
         }
-        break;
     }
-    return NotKeyword;
+    return &entry;
+}
+
+// finds a keyword, null, true or false with a single hash probe
+static ALWAYS_INLINE const KeywordTableEntry* findKeyword(const StringBufferAccessData& data)
+{
+    if (data.length < KEYWORD_MIN_LENGTH || data.length > KEYWORD_MAX_LENGTH) {
+        return nullptr;
+    }
+    if (LIKELY(data.has8BitContent)) {
+        return findKeyword((const LChar*)data.buffer, data.length);
+    }
+    return findKeyword((const char16_t*)data.buffer, data.length);
 }
 
 ALWAYS_INLINE void Scanner::scanIdentifier(Scanner::ScannerResult* token, char16_t ch0)
@@ -1836,27 +1813,14 @@ ALWAYS_INLINE void Scanner::scanIdentifier(Scanner::ScannerResult* token, char16
     ScanIDResult id = UNLIKELY(ch0 == 0x5C) ? this->getComplexIdentifier() : this->getIdentifier();
     const size_t end = this->index;
 
-    // There is no keyword or literal with only one character.
-    // Thus, it must be an identifier.
-    KeywordKind keywordKind;
-    const auto& data = std::get<0>(id);
-    if (data.length == 1) {
+    const KeywordTableEntry* keyword = findKeyword(std::get<0>(id));
+    if (LIKELY(!keyword)) {
         type = Token::IdentifierToken;
-    } else if ((keywordKind = isKeyword(data))) {
-        token->setKeywordResult(this->lineNumber, this->lineStart, start, this->index, keywordKind);
+    } else if (keyword->m_token == Token::KeywordToken) {
+        token->setKeywordResult(this->lineNumber, this->lineStart, start, this->index, keyword->m_keyword);
         return;
-    } else if (data.length == 4) {
-        if (data.equalsSameLength("null")) {
-            type = Token::NullLiteralToken;
-        } else if (data.equalsSameLength("true")) {
-            type = Token::BooleanLiteralToken;
-        } else {
-            type = Token::IdentifierToken;
-        }
-    } else if (data.length == 5 && data.equalsSameLength("false")) {
-        type = Token::BooleanLiteralToken;
     } else {
-        type = Token::IdentifierToken;
+        type = keyword->m_token;
     }
 
     if (UNLIKELY(std::get<1>(id) != nullptr)) {
@@ -1915,4 +1879,170 @@ ScanID:
     this->scanIdentifier(token, cp);
     return;
 }
+
+void TokenTable::scan(String* source)
+{
+    ASSERT(m_tokens.empty());
+    if (source->length() > std::numeric_limits<uint32_t>::max()) {
+        return;
+    }
+
+    // without a Context, the scanner allocates nothing and throws ScanError in place of reporting an error
+    Scanner scanner(nullptr, StringView(source));
+    Scanner::ScannerResult token;
+    // brace depths where template substitutions opened
+    std::vector<size_t> substitutionDepths;
+    size_t braceDepth = 0;
+    // only the parser knows whether a slash starts a regular expression. the previous token tells it well enough here
+    bool slashStartsRegExp = true;
+
+    while (true) {
+        size_t lineNumberBeforeComments = scanner.lineNumber;
+        try {
+            scanner.scanComments();
+        } catch (const ScanError&) {
+            // an unterminated comment
+            break;
+        }
+        if (scanner.eof()) {
+            break;
+        }
+
+        ScannedToken scanned;
+        scanned.start = scanner.index;
+        scanned.lineStart = scanner.lineStart;
+        scanned.lineBreaks = scanner.lineNumber - lineNumberBeforeComments;
+        scanned.type = InvalidToken;
+        scanned.value = 0;
+        bool canTake = scanner.lineNumber - lineNumberBeforeComments <= std::numeric_limits<uint16_t>::max();
+
+        try {
+            size_t lineNumber = scanner.lineNumber;
+            if (slashStartsRegExp && scanner.source.bufferedCharAt(scanner.index) == '/') {
+                scanner.scanRegExp(&token);
+            } else {
+                scanner.lex(&token);
+            }
+            // tokens over several lines are left to the parser
+            canTake = canTake && scanner.lineNumber == lineNumber;
+            slashStartsRegExp = false;
+
+            switch (token.type) {
+            case Token::PunctuatorToken: {
+                PunctuatorKind kind = token.valuePunctuatorKind;
+                scanned.value = kind;
+                slashStartsRegExp = kind != RightParenthesis && kind != RightSquareBracket && kind != RightBrace && kind != PlusPlus && kind != MinusMinus;
+                if (kind == LeftBrace) {
+                    braceDepth++;
+                } else if (kind == RightBrace && !substitutionDepths.empty() && substitutionDepths.back() == braceDepth) {
+                    // the brace closes a substitution, and the template goes on after it
+                    scanned.type = Token::PunctuatorToken;
+                    scanned.end = scanner.index;
+                    m_tokens.push_back(scanned);
+
+                    scanned.start = scanned.lineStart = scanner.index;
+                    scanned.lineBreaks = 0;
+                    scanned.value = 0;
+                    scanner.scanTemplate(&token);
+                    bool tail = scanner.source.bufferedCharAt(scanner.index - 1) == '`';
+                    if (tail) {
+                        substitutionDepths.pop_back();
+                    }
+                    slashStartsRegExp = !tail;
+                    canTake = false;
+                } else if (kind == RightBrace && braceDepth) {
+                    braceDepth--;
+                }
+                break;
+            }
+            case Token::KeywordToken:
+                scanned.value = token.valueKeywordKind;
+                slashStartsRegExp = token.valueKeywordKind != ThisKeyword && token.valueKeywordKind != SuperKeyword;
+                break;
+            case Token::StringLiteralToken:
+                if (token.hasAllocatedString) {
+                    scanned.value |= ScannedToken::EscapedString;
+                }
+                if (token.octal) {
+                    scanned.value |= ScannedToken::OctalString;
+                }
+                break;
+            case Token::NumericLiteralToken:
+                // hexadecimal, octal and binary literals are computed by lex
+                canTake = canTake && token.hasNonComputedNumberLiteral;
+                if (token.startWithZero) {
+                    scanned.value |= ScannedToken::StartWithZero;
+                }
+                break;
+            case Token::TemplateToken:
+                if (scanner.source.bufferedCharAt(scanner.index - 1) != '`') {
+                    substitutionDepths.push_back(braceDepth);
+                    slashStartsRegExp = true;
+                }
+                canTake = false;
+                break;
+            case Token::RegularExpressionToken:
+                canTake = false;
+                break;
+            default:
+                break;
+            }
+
+            scanned.type = canTake ? token.type : (uint8_t)InvalidToken;
+            scanned.end = scanner.index;
+        } catch (const ScanError&) {
+            // the scan most likely agrees with the parser again from the next line
+            size_t index = scanned.start;
+            while (index < scanner.length && !isLineTerminator(scanner.source.bufferedCharAt(index))) {
+                index++;
+            }
+            if (index == scanner.length) {
+                break;
+            }
+            if (scanner.source.bufferedCharAt(index) == '\r' && index + 1 < scanner.length && scanner.source.bufferedCharAt(index + 1) == '\n') {
+                index++;
+            }
+            index++;
+
+            scanner.index = index;
+            scanner.lineNumber++;
+            scanner.lineStart = index;
+            substitutionDepths.clear();
+            braceDepth = 0;
+            slashStartsRegExp = true;
+
+            scanned.type = InvalidToken;
+            scanned.end = index;
+        }
+
+        m_tokens.push_back(scanned);
+    }
+}
+
+void TokenTable::clear()
+{
+    std::vector<ScannedToken>().swap(m_tokens);
+    m_cursor = 0;
+}
+
+const ScannedToken* TokenTable::findTokenAt(size_t index)
+{
+    // the parser went back, or scanned something by itself. find the token after the one ending at index
+    size_t next = 0;
+    if (index) {
+        auto iter = std::lower_bound(m_tokens.begin(), m_tokens.end(), index, [](const ScannedToken& token, size_t index) {
+            return token.end < index;
+        });
+        if (iter == m_tokens.end() || iter->end != index) {
+            return nullptr;
+        }
+        next = iter - m_tokens.begin() + 1;
+    }
+    if (next >= m_tokens.size()) {
+        return nullptr;
+    }
+
+    m_cursor = next + 1;
+    return m_tokens[next].type != InvalidToken ? &m_tokens[next] : nullptr;
+}
 }
@@ -21,6 +21,7 @@
 #define __EscargotLexer__
 
 #include "parser/esprima_cpp/esprima.h"
+#include "runtime/StringConversion.h"
 
 namespace Escargot {
 
@@ -149,6 +150,9 @@ enum KeywordKind : uint8_t {
     KeywordKindEnd
 };
 
+// returns the pre-interned static string of a keyword
+AtomicString keywordToString(::Escargot::Context* ctx, KeywordKind keyword);
+
 enum {
     LexerIsCharIdentStart = (1 << 0),
     LexerIsCharIdent = (1 << 1),
@@ -226,6 +230,65 @@ extern const char* UnterminatedRegExp;
 extern const char* TemplateOctalLiteral;
 }
 
+// a token scanned ahead of parsing. see TokenTable
+struct ScannedToken {
+    // flags of literals, kept in value
+    enum : uint8_t {
+        EscapedString = 1 << 0,
+        OctalString = 1 << 1,
+        StartWithZero = 1 << 2,
+    };
+
+    uint32_t start;
+    uint32_t end;
+    // the comments and blanks before the token hold lineBreaks line terminators, and the last line starts at lineStart
+    uint32_t lineStart;
+    uint16_t lineBreaks;
+    // InvalidToken marks a token the parser scans by itself, such as templates and regular expressions
+    uint8_t type;
+    // PunctuatorKind, KeywordKind or the flags of a literal
+    uint8_t value;
+};
+
+COMPILE_ASSERT(sizeof(ScannedToken) == 16, "");
+
+// tokens of a whole source scanned ahead of parsing. scanning needs neither the GC heap nor a Context,
+// so it can run on another thread than the parser.
+// each token is what scanComments and lex produce from the end of the previous token, so the parser takes
+// a token only when its scanner stands at that end, and scans by itself wherever the two went different ways
+class TokenTable {
+public:
+    // thrown by a Scanner without a Context where it would report an error or allocate
+    struct ScanError {
+    };
+
+    TokenTable()
+        : m_cursor(0)
+    {
+    }
+
+    // the characters of source must not move while this runs
+    void scan(String* source);
+    void clear();
+
+    // returns the token scanned from index, or nullptr if the parser has to scan it by itself
+    ALWAYS_INLINE const ScannedToken* tokenAt(size_t index)
+    {
+        if (LIKELY(m_cursor < m_tokens.size() && (m_cursor ? m_tokens[m_cursor - 1].end : 0) == index)) {
+            const ScannedToken* token = &m_tokens[m_cursor++];
+            return LIKELY(token->type != InvalidToken) ? token : nullptr;
+        }
+        return findTokenAt(index);
+    }
+
+private:
+    const ScannedToken* findTokenAt(size_t index);
+
+    std::vector<ScannedToken> m_tokens;
+    // the token after the one taken last
+    size_t m_cursor;
+};
+
 class Scanner {
 public:
     struct ScannerSourceStringView {
@@ -467,6 +530,7 @@ public:
     COMPILE_ASSERT(sizeof(ScannerResult) < 512, "");
 
     StringView source;
+    // nullptr while scanning a TokenTable
     ::Escargot::Context* escargotContext;
     // trackComment: boolean;
 
@@ -474,6 +538,8 @@ public:
     size_t index;
     size_t lineNumber;
     size_t lineStart;
+    // string literals of a source kept in ScriptSourceStore are copied instead of viewing the source
+    bool copyStringLiterals;
 
     ~Scanner()
     {
@@ -489,8 +555,40 @@ public:
         return index >= length;
     }
 
+    // lengths of the ASCII runs starting at index that the StringConversion kernels skip in bulk
+    ALWAYS_INLINE size_t identifierPartRunLength()
+    {
+        const auto& data = this->source.bufferAccessData();
+        if (data.has8BitContent) {
+            return StringConversion::asciiIdentifierPartPrefixLength((const LChar*)data.buffer + this->index, this->length - this->index);
+        }
+        return StringConversion::asciiIdentifierPartPrefixLength((const char16_t*)data.buffer + this->index, this->length - this->index);
+    }
+
+    ALWAYS_INLINE size_t blankRunLength()
+    {
+        const auto& data = this->source.bufferAccessData();
+        if (data.has8BitContent) {
+            return StringConversion::asciiBlankPrefixLength((const LChar*)data.buffer + this->index, this->length - this->index);
+        }
+        return StringConversion::asciiBlankPrefixLength((const char16_t*)data.buffer + this->index, this->length - this->index);
+    }
+
+    ALWAYS_INLINE size_t lineTerminatorFreeRunLength(char stop1, char stop2)
+    {
+        const auto& data = this->source.bufferAccessData();
+        if (data.has8BitContent) {
+            return StringConversion::lineTerminatorFreePrefixLength((const LChar*)data.buffer + this->index, this->length - this->index, stop1, stop2);
+        }
+        return StringConversion::lineTerminatorFreePrefixLength((const char16_t*)data.buffer + this->index, this->length - this->index, stop1, stop2);
+    }
+
     ALWAYS_INLINE void throwUnexpectedToken(const char* message = Messages::UnexpectedTokenIllegal)
     {
+        if (UNLIKELY(!this->escargotContext)) {
+            // the parser reports the error when it scans the token by itself
+            throw TokenTable::ScanError();
+        }
         ErrorHandler::throwError(this->index, this->lineNumber, this->index - this->lineStart + 1, new ASCIIString(message), ErrorObject::SyntaxError);
     }
 
@@ -515,6 +613,10 @@ public:
                 ++this->lineNumber;
                 this->lineStart = this->index;
                 start = true;
+                if (!this->eof() && isWhiteSpace(this->source.bufferedCharAt(this->index))) {
+                    // skip indentation at once
+                    this->index += this->blankRunLength();
+                }
             } else if (ch == 0x2F) { // U+002F is '/'
                 ch = this->source.bufferedCharAt(this->index + 1);
                 if (ch == 0x2F) {
@@ -616,6 +718,40 @@ public:
 
     void lex(Scanner::ScannerResult* token);
 
+    // moves over the comments and the token which scanComments and lex would, using a token of a TokenTable
+    ALWAYS_INLINE void takeScannedToken(const ScannedToken& scanned, Scanner::ScannerResult* token)
+    {
+        if (scanned.lineBreaks) {
+            this->lineNumber += scanned.lineBreaks;
+            this->lineStart = scanned.lineStart;
+        }
+        this->index = scanned.end;
+
+        switch (scanned.type) {
+        case Token::PunctuatorToken:
+            token->setPunctuatorResult(this->lineNumber, this->lineStart, scanned.start, scanned.end, (PunctuatorKind)scanned.value);
+            break;
+        case Token::KeywordToken:
+            token->setKeywordResult(this->lineNumber, this->lineStart, scanned.start, scanned.end, (KeywordKind)scanned.value);
+            break;
+        case Token::StringLiteralToken:
+            if (scanned.value & ScannedToken::EscapedString) {
+                token->setResult(Token::StringLiteralToken, (String*)nullptr, this->lineNumber, this->lineStart, scanned.start, scanned.end, scanned.value & ScannedToken::OctalString);
+            } else {
+                token->setResult(Token::StringLiteralToken, scanned.start + 1, scanned.end - 1, this->lineNumber, this->lineStart, scanned.start, scanned.end, scanned.value & ScannedToken::OctalString);
+            }
+            break;
+        case Token::NumericLiteralToken:
+            token->setNumericLiteralResult(0, this->lineNumber, this->lineStart, scanned.start, scanned.end, true);
+            token->startWithZero = scanned.value & ScannedToken::StartWithZero;
+            break;
+        default:
+            // identifiers, boolean and null literals
+            token->setResult((Token)scanned.type, scanned.start, scanned.end, this->lineNumber, this->lineStart, scanned.start, scanned.end);
+            break;
+        }
+    }
+
 private:
     ALWAYS_INLINE char16_t peekChar()
     {
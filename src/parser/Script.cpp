@@ -45,6 +45,17 @@ Context* Script::context()
     return m_topCodeBlock->context();
 }
 
+String* Script::sourceCodeText(const StringView& text)
+{
+    if (!isSourceCodeStored()) {
+        return new StringView(text);
+    }
+
+    StringBuilder builder;
+    builder.appendSubString(text.string(), text.start(), text.end());
+    return builder.finalize();
+}
+
 static Optional<Script*> findLoadedModule(Context* context, Optional<Script*> referrer, String* src)
 {
     const auto& lm = context->loadedModules();
@@ -440,11 +451,23 @@ Value Script::executeModule(ExecutionState& state, Optional<Script*> referrer)
     clearStack<512>();
 
     // we give up program bytecodeblock after first excution for reducing memory usage
-    m_topCodeBlock->m_byteCodeBlock = nullptr;
+    if (!m_isCachedEvalCode) {
+        m_topCodeBlock->m_byteCodeBlock = nullptr;
+    }
 
     return resultValue;
 }
 
+// native code may hold the buffer of a string while it runs, but no native frame is left
+// when the outermost script execution returns. small views of large strings are compacted there
+static void compactSmallStringViewsIfOutermost(ExecutionState& state)
+{
+    SandBox* sandBox = state.context()->vmInstance()->currentSandBox();
+    if (!state.parent() && sandBox && sandBox->isOutermost()) {
+        state.context()->vmInstance()->compactSmallStringViews();
+    }
+}
+
 Value Script::execute(ExecutionState& state, bool isExecuteOnEvalFunction, bool inStrictMode)
 {
     if (UNLIKELY(isExecuted())) {
@@ -452,11 +475,13 @@ Value Script::execute(ExecutionState& state, bool isExecuteOnEvalFunction, bool
             ESCARGOT_LOG_ERROR("You cannot re-execute is type of Script object");
             RELEASE_ASSERT_NOT_REACHED();
         }
-        m_topCodeBlock = state.context()->scriptParser().initializeScript(m_sourceCode, m_src, m_moduleData).script->m_topCodeBlock;
+        m_topCodeBlock = state.context()->scriptParser().initializeScript(sourceCode(), m_src, m_moduleData).script->m_topCodeBlock;
     }
 
     if (isModule()) {
-        return executeModule(state, nullptr);
+        Value resultValue = executeModule(state, nullptr);
+        compactSmallStringViewsIfOutermost(state);
+        return resultValue;
     }
 
     ExecutionState newState(context(), state.stackBase());
@@ -521,7 +546,13 @@ Value Script::execute(ExecutionState& state, bool isExecuteOnEvalFunction, bool
     clearStack<512>();
 
     // we give up program bytecodeblock after first excution for reducing memory usage
-    m_topCodeBlock->m_byteCodeBlock = nullptr;
+    if (!m_isCachedEvalCode) {
+        m_topCodeBlock->m_byteCodeBlock = nullptr;
+    }
+
+    if (!isExecuteOnEvalFunction) {
+        compactSmallStringViewsIfOutermost(state);
+    }
 
     return resultValue;
 }
@@ -21,6 +21,7 @@
 #define __EscargotScript__
 
 #include "runtime/Value.h"
+#include "parser/ScriptSourceStore.h"
 
 namespace Escargot {
 
@@ -91,9 +92,22 @@ public:
 
     String* sourceCode()
     {
+        if (m_storedSourceCode) {
+            return m_storedSourceCode->source();
+        }
         return m_sourceCode;
     }
 
+    // large sources are kept in ScriptSourceStore, which may drop the text and decompress it again.
+    // strings made from the text of such a source are copied, so they do not keep the whole text alive
+    bool isSourceCodeStored()
+    {
+        return m_storedSourceCode;
+    }
+
+    // returns a String of `text`, which is a part of sourceCode()
+    String* sourceCodeText(const StringView& text);
+
     InterpretedCodeBlock* topCodeBlock()
     {
         return m_topCodeBlock;
@@ -116,11 +130,30 @@ public:
 
     bool isExecuted();
 
+    // Scripts shared through EvalCodeCache are executed many times
+    // so they keep the bytecode of the top code block after execution
+    void setCachedEvalCode()
+    {
+        m_isCachedEvalCode = true;
+    }
+
 private:
     Script(String* src, String* sourceCode, ModuleData* moduleData, bool canExecuteAgain)
         : m_canExecuteAgain(canExecuteAgain && !moduleData)
+        , m_isCachedEvalCode(false)
         , m_src(src)
         , m_sourceCode(sourceCode)
+        , m_storedSourceCode(nullptr)
+        , m_topCodeBlock(nullptr)
+        , m_moduleData(moduleData)
+    {
+    }
+    Script(String* src, ScriptSourceStore::Entry* storedSourceCode, ModuleData* moduleData, bool canExecuteAgain)
+        : m_canExecuteAgain(canExecuteAgain && !moduleData)
+        , m_isCachedEvalCode(false)
+        , m_src(src)
+        , m_sourceCode(nullptr)
+        , m_storedSourceCode(storedSourceCode)
         , m_topCodeBlock(nullptr)
         , m_moduleData(moduleData)
     {
@@ -161,8 +194,10 @@ private:
     // http://www.ecma-international.org/ecma-262/6.0/#sec-getexportednames
     AtomicStringVector exportedNames(ExecutionState& state, std::vector<Script*>& exportStarSet);
     bool m_canExecuteAgain;
+    bool m_isCachedEvalCode;
     String* m_src;
     String* m_sourceCode;
+    ScriptSourceStore::Entry* m_storedSourceCode;
     InterpretedCodeBlock* m_topCodeBlock;
     ModuleData* m_moduleData;
 };
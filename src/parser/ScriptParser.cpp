@@ -42,6 +42,7 @@ InterpretedCodeBlock* ScriptParser::generateCodeBlockTreeFromASTWalker(Context*
         codeBlock = new InterpretedCodeBlock(ctx, script, source, scopeCtx, ExtendedNodeLOC(1, 1, 0), isEvalCode, isEvalCodeInFunction);
     } else {
         codeBlock = new InterpretedCodeBlock(ctx, script, source, scopeCtx, scopeCtx->m_paramsStartLOC, parentCodeBlock, isEvalCode, isEvalCodeInFunction);
+        codeBlock->m_parameterNames = sharedParameterNames(scopeCtx->m_parameters);
     }
 
     // child scopes are don't need this
@@ -177,12 +178,64 @@ InterpretedCodeBlock* ScriptParser::generateCodeBlockTreeFromASTWalker(Context*
     return codeBlock;
 }
 
+AtomicString* ScriptParser::sharedParameterNames(const AtomicStringTightVector& names)
+{
+    if (!names.size()) {
+        return nullptr;
+    }
+
+    ParameterNames key;
+    key.m_names = const_cast<AtomicString*>(names.data());
+    key.m_count = names.size();
+    auto iter = m_parameterNamesTables.find(key);
+    if (iter != m_parameterNamesTables.end()) {
+        return iter->m_names;
+    }
+
+    key.m_names = (AtomicString*)GC_MALLOC_ATOMIC(sizeof(AtomicString) * names.size());
+    for (size_t i = 0; i < names.size(); i++) {
+        key.m_names[i] = names[i];
+    }
+    m_parameterNamesTables.insert(key);
+    return key.m_names;
+}
+
 // generate code blocks from AST
 InterpretedCodeBlock* ScriptParser::generateCodeBlockTreeFromAST(Context* ctx, StringView source, Script* script, ProgramNode* program, bool isEvalCode, bool isEvalCodeInFunction)
 {
     return generateCodeBlockTreeFromASTWalker(ctx, source, script, program->scopeContext(), nullptr, isEvalCode, isEvalCodeInFunction);
 }
 
+// InterpretedCodeBlock::StorageIndex holds indexes below UINT16_MAX.
+// the 16 bit counts checked with VARIABLE_LIMIT wrap around before that, so the names are counted too
+static bool exceedsStorageIndexLimit(InterpretedCodeBlock* cb)
+{
+    bool isGlobal = cb->isGlobalScopeCodeBlock();
+    bool isModule = isGlobal && cb->script()->isModule();
+    size_t nameCount = cb->identifierInfos().size();
+
+    for (size_t i = 0; i < cb->blockInfos().size(); i++) {
+        InterpretedCodeBlock::BlockInfo* bi = cb->blockInfos()[i];
+        size_t blockNameCount = bi->m_identifiers.size();
+        if (isGlobal && bi->m_blockIndex == 0) {
+            // top level lexical names of a module are indexed after its var names.
+            // the ones of other global code live on the GlobalEnvironmentRecord and are looked up by name
+            if (isModule) {
+                nameCount += blockNameCount;
+            }
+            continue;
+        }
+        // names of the other blocks keep their indexes only in code blocks using indexed storage
+        if (cb->canUseIndexedVariableStorage() && blockNameCount >= UINT16_MAX) {
+            return true;
+        }
+    }
+
+    // stack indexes of variables start after `this` and the function itself
+    bool hasIndexedVariables = isGlobal ? isModule : cb->canUseIndexedVariableStorage();
+    return hasIndexedVariables && nameCount + 2 >= UINT16_MAX;
+}
+
 void ScriptParser::generateCodeBlockTreeFromASTWalkerPostProcess(InterpretedCodeBlock* cb)
 {
     InterpretedCodeBlock* child = cb->firstChild();
@@ -191,7 +244,8 @@ void ScriptParser::generateCodeBlockTreeFromASTWalkerPostProcess(InterpretedCode
         child = child->nextSibling();
     }
     cb->computeVariables();
-    if (cb->m_identifierOnStackCount > VARIABLE_LIMIT || cb->m_identifierOnHeapCount > VARIABLE_LIMIT || cb->m_lexicalBlockStackAllocatedIdentifierMaximumDepth > VARIABLE_LIMIT) {
+    if (cb->m_identifierOnStackCount > VARIABLE_LIMIT || cb->m_identifierOnHeapCount > VARIABLE_LIMIT || cb->m_lexicalBlockStackAllocatedIdentifierMaximumDepth > VARIABLE_LIMIT
+        || exceedsStorageIndexLimit(cb)) {
         auto err = new esprima::Error(new ASCIIString("variable limit exceeded"));
         err->errorCode = ErrorObject::SyntaxError;
         err->lineNumber = cb->m_sourceElementStart.line;
@@ -202,7 +256,7 @@ void ScriptParser::generateCodeBlockTreeFromASTWalkerPostProcess(InterpretedCode
     cb->m_astContext = nullptr;
 }
 
-ScriptParser::InitializeScriptResult ScriptParser::initializeScript(StringView scriptSource, String* fileName, bool isModule, InterpretedCodeBlock* parentCodeBlock, bool strictFromOutside, bool isEvalCodeInFunction, bool isEvalMode, bool inWithOperation, size_t stackSizeRemain, bool needByteCodeGeneration, bool allowSuperCall, bool allowSuperProperty)
+ScriptParser::InitializeScriptResult ScriptParser::initializeScript(StringView scriptSource, String* fileName, bool isModule, InterpretedCodeBlock* parentCodeBlock, bool strictFromOutside, bool isEvalCodeInFunction, bool isEvalMode, bool inWithOperation, size_t stackSizeRemain, bool needByteCodeGeneration, bool allowSuperCall, bool allowSuperProperty, EscargotLexer::TokenTable* tokenTable)
 {
     GC_disable();
 
@@ -213,9 +267,15 @@ ScriptParser::InitializeScriptResult ScriptParser::initializeScript(StringView s
     // Parsing
     try {
         InterpretedCodeBlock* topCodeBlock = nullptr;
-        ProgramNode* programNode = esprima::parseProgram(m_context, scriptSource, isModule, strictFromOutside, inWith, stackSizeRemain, allowSC, allowSP);
+        ProgramNode* programNode = esprima::parseProgram(m_context, scriptSource, isModule, strictFromOutside, inWith, stackSizeRemain, allowSC, allowSP, tokenTable);
 
-        Script* script = new Script(fileName, new StringView(scriptSource), programNode->moduleData(), !parentCodeBlock);
+        Script* script;
+        if (ScriptSourceStore::canStore(scriptSource.length())) {
+            ScriptSourceStore::Entry* storedSource = m_context->vmInstance()->scriptSourceStore()->store(new StringView(scriptSource));
+            script = new Script(fileName, storedSource, programNode->moduleData(), !parentCodeBlock);
+        } else {
+            script = new Script(fileName, new StringView(scriptSource), programNode->moduleData(), !parentCodeBlock);
+        }
         if (parentCodeBlock) {
             programNode->scopeContext()->m_hasEval = parentCodeBlock->hasEval();
             programNode->scopeContext()->m_hasWith = parentCodeBlock->hasWith();
@@ -250,6 +310,7 @@ ScriptParser::InitializeScriptResult ScriptParser::initializeScript(StringView s
 
         // reset ASTAllocator
         m_context->astAllocator().reset();
+        m_parameterNamesTables.clear();
         GC_enable();
 
         ScriptParser::InitializeScriptResult result;
@@ -259,6 +320,7 @@ ScriptParser::InitializeScriptResult ScriptParser::initializeScript(StringView s
     } catch (esprima::Error& orgError) {
         // reset ASTAllocator
         m_context->astAllocator().reset();
+        m_parameterNamesTables.clear();
         GC_enable();
 
         ScriptParser::InitializeScriptResult result;
@@ -33,6 +33,10 @@ class Context;
 class ProgramNode;
 class Node;
 
+namespace EscargotLexer {
+class TokenTable;
+}
+
 class ScriptParser : public gc {
 public:
     explicit ScriptParser(Context* c);
@@ -58,7 +62,7 @@ public:
         }
     };
 
-    InitializeScriptResult initializeScript(StringView scriptSource, String* fileName, bool isModule, InterpretedCodeBlock* parentCodeBlock, bool strictFromOutside, bool isEvalCodeInFunction, bool isEvalMode, bool inWithOperation, size_t stackSizeRemain, bool needByteCodeGeneration, bool allowSuperCall, bool allowSuperProperty);
+    InitializeScriptResult initializeScript(StringView scriptSource, String* fileName, bool isModule, InterpretedCodeBlock* parentCodeBlock, bool strictFromOutside, bool isEvalCodeInFunction, bool isEvalMode, bool inWithOperation, size_t stackSizeRemain, bool needByteCodeGeneration, bool allowSuperCall, bool allowSuperProperty, EscargotLexer::TokenTable* tokenTable = nullptr);
     InitializeScriptResult initializeScript(String* scriptSource, String* fileName, bool isModule, bool strictFromOutside = false, bool isRunningEvalOnFunction = false, bool isEvalMode = false, size_t stackSizeRemain = SIZE_MAX)
     {
         return initializeScript(StringView(scriptSource, 0, scriptSource->length()), fileName, isModule, nullptr, strictFromOutside, isRunningEvalOnFunction, isEvalMode, false, stackSizeRemain, true, false, false);
@@ -70,11 +74,39 @@ private:
     InterpretedCodeBlock* generateCodeBlockTreeFromAST(Context* ctx, StringView source, Script* script, ProgramNode* program, bool isEvalCode, bool isEvalCodeInFunction);
     InterpretedCodeBlock* generateCodeBlockTreeFromASTWalker(Context* ctx, StringView source, Script* script, ASTFunctionScopeContext* scopeCtx, InterpretedCodeBlock* parentCodeBlock, bool isEvalCode, bool isEvalCodeInFunction);
     void generateCodeBlockTreeFromASTWalkerPostProcess(InterpretedCodeBlock* cb);
+    AtomicString* sharedParameterNames(const AtomicStringTightVector& names);
 #ifndef NDEBUG
     void dumpCodeBlockTree(InterpretedCodeBlock* topCodeBlock);
 #endif
 
+    struct ParameterNames {
+        AtomicString* m_names;
+        size_t m_count;
+    };
+
+    struct ParameterNamesHash {
+        size_t operator()(const ParameterNames& p) const
+        {
+            size_t hash = p.m_count;
+            for (size_t i = 0; i < p.m_count; i++) {
+                hash = hash * 31 + std::hash<AtomicString>()(p.m_names[i]);
+            }
+            return hash;
+        }
+    };
+
+    struct ParameterNamesEqual {
+        bool operator()(const ParameterNames& a, const ParameterNames& b) const
+        {
+            return a.m_count == b.m_count && std::equal(a.m_names, a.m_names + a.m_count, b.m_names);
+        }
+    };
+
     Context* m_context;
+    // parameter name tables of the script being parsed.
+    // bundled and minified code repeats lists like (e, t, n) in thousands of functions,
+    // so code blocks with the same list share one table
+    std::unordered_set<ParameterNames, ParameterNamesHash, ParameterNamesEqual> m_parameterNamesTables;
 };
 }
 
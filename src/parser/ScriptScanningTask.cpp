@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2016-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#include "Escargot.h"
+#include "ScriptScanningTask.h"
+#include "runtime/ExternalString.h"
+
+namespace Escargot {
+
+void ScriptScanningTask::decode()
+{
+    // the buffers end with a zero character, because the scanner may peek one character past the end
+    if (isAllASCII(m_source, m_sourceLength)) {
+        m_has8BitContent = true;
+        m_length = m_sourceLength;
+        m_buffer = malloc(m_length + 1);
+        memcpy(m_buffer, m_source, m_length);
+        ((LChar*)m_buffer)[m_length] = 0;
+    } else {
+        UTF16StringDataNonGCStd str = utf8StringToUTF16StringNonGC(m_source, m_sourceLength);
+        m_length = str.length();
+        if (isAllLatin1(str.data(), str.length())) {
+            m_has8BitContent = true;
+            m_buffer = malloc(m_length + 1);
+            StringConversion::narrow(str.data(), (LChar*)m_buffer, m_length);
+            ((LChar*)m_buffer)[m_length] = 0;
+        } else {
+            m_has8BitContent = false;
+            m_buffer = malloc((m_length + 1) * sizeof(char16_t));
+            memcpy(m_buffer, str.data(), m_length * sizeof(char16_t));
+            ((char16_t*)m_buffer)[m_length] = 0;
+        }
+    }
+}
+
+void ScriptScanningTask::run()
+{
+    ASSERT(!m_hasRun);
+
+    decode();
+
+    // strings without a release callback do not register a GC finalizer, so this one can live on the stack
+    if (m_has8BitContent) {
+        ExternalLatin1String source((const LChar*)m_buffer, m_length, nullptr, nullptr);
+        m_tokenTable.scan(&source);
+    } else {
+        ExternalUTF16String source((const char16_t*)m_buffer, m_length, nullptr, nullptr);
+        m_tokenTable.scan(&source);
+    }
+
+    m_source = nullptr;
+    m_hasRun = true;
+}
+
+static void releaseDecodedBuffer(const void* buffer, size_t length, void* data)
+{
+    free(const_cast<void*>(buffer));
+}
+
+String* ScriptScanningTask::takeString()
+{
+    if (!m_hasRun) {
+        run();
+    }
+
+    void* buffer = m_buffer;
+    m_buffer = nullptr;
+    if (!buffer) {
+        // already taken
+        return String::emptyString;
+    }
+
+    if (m_has8BitContent) {
+        return new ExternalLatin1String((const LChar*)buffer, m_length, releaseDecodedBuffer, nullptr);
+    }
+    return new ExternalUTF16String((const char16_t*)buffer, m_length, releaseDecodedBuffer, nullptr);
+}
+}
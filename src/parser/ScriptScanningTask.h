@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2016-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#ifndef __EscargotScriptScanningTask__
+#define __EscargotScriptScanningTask__
+
+#include "runtime/String.h"
+#include "parser/Lexer.h"
+
+namespace Escargot {
+
+// decodes UTF-8 script source and scans its tokens into a TokenTable.
+// run() uses only malloc memory, so it can be called from any thread;
+// takeString() and parsing with tokenTable() must happen on the thread which owns the Context,
+// because the parser interns AtomicStrings and allocates GC objects
+class ScriptScanningTask {
+public:
+    // the source buffer must stay alive until run() is finished
+    ScriptScanningTask(const char* source, size_t length)
+        : m_source(source)
+        , m_sourceLength(length)
+        , m_hasRun(false)
+        , m_has8BitContent(true)
+        , m_buffer(nullptr)
+        , m_length(0)
+    {
+    }
+
+    ~ScriptScanningTask()
+    {
+        free(m_buffer);
+    }
+
+    void run();
+
+    bool hasRun() const
+    {
+        return m_hasRun;
+    }
+
+    // returns a string which owns the decoded buffer
+    // the task does not own the buffer after this
+    String* takeString();
+
+    EscargotLexer::TokenTable* tokenTable()
+    {
+        return &m_tokenTable;
+    }
+
+private:
+    void decode();
+
+    const char* m_source;
+    size_t m_sourceLength;
+    bool m_hasRun;
+    bool m_has8BitContent;
+    void* m_buffer;
+    size_t m_length;
+    EscargotLexer::TokenTable m_tokenTable;
+};
+}
+
+#endif
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2016-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+
+#include "Escargot.h"
+#include "ScriptSourceStore.h"
+#include "util/LZ4Block.h"
+
+namespace Escargot {
+
+ScriptSourceStore::Entry::Entry(ScriptSourceStore* store, String* source, size_t hash)
+    : m_store(store)
+    , m_source(source)
+    , m_compressedSource(nullptr)
+    , m_compressedSize(0)
+    , m_length(source->length())
+    , m_hash(hash)
+    , m_lastUsed(++store->m_useCount)
+    , m_is8Bit(source->has8BitContent())
+    , m_isIncompressible(false)
+{
+}
+
+ScriptSourceStore::Entry* ScriptSourceStore::store(String* source)
+{
+    ASSERT(canStore(source->length()));
+
+    size_t hash = source->hashValue();
+    for (size_t i = 0; i < m_entries.size(); i++) {
+        Entry* entry = *m_entries[i].m_entry;
+        if (!entry) {
+            // the link was cleared by GC
+            m_entries.erase(i);
+            i--;
+            continue;
+        }
+        if (m_entries[i].m_hash == hash && entry->m_length == source->length() && equals(entry, source)) {
+            return entry;
+        }
+    }
+
+    Entry* entry = new Entry(this, source, hash);
+    // the link is allocated atomic so that GC does not see it as a reference
+    Entry** link = (Entry**)GC_MALLOC_ATOMIC(sizeof(Entry*));
+    *link = entry;
+    GC_GENERAL_REGISTER_DISAPPEARING_LINK((void**)link, entry);
+
+    WeakEntry weakEntry;
+    weakEntry.m_hash = hash;
+    weakEntry.m_entry = link;
+    m_entries.pushBack(weakEntry);
+
+    didDecompress(entry);
+    return entry;
+}
+
+bool ScriptSourceStore::equals(Entry* entry, String* source)
+{
+    if (entry->m_source) {
+        return entry->m_source->equals(source);
+    }
+
+    // compare with a temporary copy of the text, so that looking up a source does not make
+    // a compressed entry take its text back
+    const auto& data = source->bufferAccessData();
+    if (data.has8BitContent != entry->m_is8Bit) {
+        // the same text is almost always decoded the same way. missing such a pair only costs a second entry
+        return false;
+    }
+
+    size_t size = entry->byteLength();
+    uint8_t* buffer = (uint8_t*)malloc(size);
+    bool decompressed = LZ4Block::decompress(entry->m_compressedSource, entry->m_compressedSize, buffer, size);
+    RELEASE_ASSERT(decompressed);
+    bool result = memcmp(buffer, data.buffer, size) == 0;
+    free(buffer);
+    return result;
+}
+
+void ScriptSourceStore::compressAll()
+{
+    for (size_t i = 0; i < m_uncompressedEntries.size(); i++) {
+        compress(m_uncompressedEntries[i]);
+    }
+    m_uncompressedEntries.clear();
+    m_uncompressedSize = 0;
+    m_compressionThreshold = SCRIPT_SOURCE_STORE_UNCOMPRESSED_SIZE_MAX;
+    m_lastCompressionUseCount = m_useCount;
+}
+
+void ScriptSourceStore::didDecompress(Entry* entry)
+{
+    m_uncompressedEntries.pushBack(entry);
+    m_uncompressedSize += entry->byteLength();
+    if (m_uncompressedSize > m_compressionThreshold) {
+        compressUnusedEntries();
+    }
+}
+
+void ScriptSourceStore::compressUnusedEntries()
+{
+    size_t kept = 0;
+    for (size_t i = 0; i < m_uncompressedEntries.size(); i++) {
+        Entry* entry = m_uncompressedEntries[i];
+        if (entry->m_lastUsed <= m_lastCompressionUseCount) {
+            compress(entry);
+            // an incompressible entry keeps its text, but there is no point in trying it again
+            if (!entry->m_source || entry->m_isIncompressible) {
+                m_uncompressedSize -= entry->byteLength();
+                continue;
+            }
+        }
+        m_uncompressedEntries[kept++] = entry;
+    }
+    m_uncompressedEntries.resize(kept);
+    m_compressionThreshold = std::max((size_t)SCRIPT_SOURCE_STORE_UNCOMPRESSED_SIZE_MAX, m_uncompressedSize * 2);
+    m_lastCompressionUseCount = m_useCount;
+}
+
+void ScriptSourceStore::compress(Entry* entry)
+{
+    ASSERT(entry->m_source);
+
+    // the compressed text is kept once made, so an entry is compressed only once
+    if (!entry->m_compressedSource && !entry->m_isIncompressible) {
+        const auto& data = entry->m_source->bufferAccessData();
+        size_t size = entry->byteLength();
+
+        uint8_t* buffer = (uint8_t*)malloc(LZ4Block::compressBound(size));
+        size_t compressedSize = LZ4Block::compress((const uint8_t*)data.buffer, size, buffer);
+        if (compressedSize < size) {
+            entry->m_compressedSource = (uint8_t*)GC_MALLOC_ATOMIC(compressedSize);
+            memcpy(entry->m_compressedSource, buffer, compressedSize);
+            entry->m_compressedSize = compressedSize;
+        } else {
+            entry->m_isIncompressible = true;
+        }
+        free(buffer);
+    }
+
+    if (entry->m_compressedSource) {
+        entry->m_source = nullptr;
+    }
+}
+
+void ScriptSourceStore::decompress(Entry* entry)
+{
+    ASSERT(!entry->m_source && entry->m_compressedSource);
+
+    bool decompressed;
+    if (entry->m_is8Bit) {
+        Latin1StringData data;
+        data.resizeWithUninitializedValues(entry->m_length);
+        decompressed = LZ4Block::decompress(entry->m_compressedSource, entry->m_compressedSize, (uint8_t*)data.data(), entry->m_length * sizeof(LChar));
+        entry->m_source = new Latin1String(std::move(data));
+    } else {
+        UTF16StringData data;
+        data.resizeWithUninitializedValues(entry->m_length);
+        decompressed = LZ4Block::decompress(entry->m_compressedSource, entry->m_compressedSize, (uint8_t*)data.data(), entry->m_length * sizeof(char16_t));
+        entry->m_source = new UTF16String(std::move(data));
+    }
+    RELEASE_ASSERT(decompressed);
+
+    didDecompress(entry);
+}
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2016-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+
+#ifndef __EscargotScriptSourceStore__
+#define __EscargotScriptSourceStore__
+
+#include "runtime/String.h"
+
+namespace Escargot {
+
+// keeps the source code of large scripts for all Contexts of a VMInstance.
+// code blocks reparse their functions from the source code when they are compiled,
+// and Function.prototype.toString and stack traces read it, but most of it is rarely needed after loading.
+// identical sources share one entry. once the uncompressed text grows over SCRIPT_SOURCE_STORE_UNCOMPRESSED_SIZE_MAX,
+// the entries not used since the previous compression keep their text compressed until it is needed again
+class ScriptSourceStore : public gc {
+public:
+    class Entry : public gc {
+        friend class ScriptSourceStore;
+
+    public:
+        String* source()
+        {
+            m_lastUsed = ++m_store->m_useCount;
+            if (UNLIKELY(!m_source)) {
+                m_store->decompress(this);
+            }
+            return m_source;
+        }
+
+    private:
+        Entry(ScriptSourceStore* store, String* source, size_t hash);
+
+        size_t byteLength() const
+        {
+            return m_length * (m_is8Bit ? sizeof(LChar) : sizeof(char16_t));
+        }
+
+        ScriptSourceStore* m_store;
+        // nullptr while only the compressed text is kept
+        String* m_source;
+        uint8_t* m_compressedSource;
+        size_t m_compressedSize;
+        size_t m_length;
+        size_t m_hash;
+        size_t m_lastUsed;
+        bool m_is8Bit : 1;
+        // the text did not get smaller by compression, so it is kept as it is
+        bool m_isIncompressible : 1;
+    };
+
+    ScriptSourceStore()
+        : m_useCount(0)
+        , m_uncompressedSize(0)
+        , m_compressionThreshold(SCRIPT_SOURCE_STORE_UNCOMPRESSED_SIZE_MAX)
+        , m_lastCompressionUseCount(0)
+    {
+    }
+
+    static bool canStore(size_t length)
+    {
+        return SCRIPT_SOURCE_STORE_LENGTH_MIN != 0 && length >= SCRIPT_SOURCE_STORE_LENGTH_MIN;
+    }
+
+    // returns the entry of a source equal to `source`, or a new entry holding `source`
+    Entry* store(String* source);
+    // drops the text of every entry that can be compressed. it is decompressed on the next access
+    void compressAll();
+
+private:
+    bool equals(Entry* entry, String* source);
+    void didDecompress(Entry* entry);
+    void compressUnusedEntries();
+    void compress(Entry* entry);
+    void decompress(Entry* entry);
+
+    // entries are looked up through weak links, so an entry dies with the last Script using it
+    struct WeakEntry {
+        size_t m_hash;
+        Entry** m_entry;
+    };
+
+    Vector<WeakEntry, GCUtil::gc_malloc_allocator<WeakEntry>> m_entries;
+    Vector<Entry*, GCUtil::gc_malloc_allocator<Entry*>> m_uncompressedEntries;
+    size_t m_useCount;
+    // bytes of text held by m_uncompressedEntries
+    size_t m_uncompressedSize;
+    // m_uncompressedSize which starts the next compression. it grows with the text still in use after a compression,
+    // so that entries in use are not compressed and decompressed by turns
+    size_t m_compressionThreshold;
+    // m_useCount at the previous compression. entries used after it are kept uncompressed
+    size_t m_lastCompressionUseCount;
+};
+}
+
+#endif
@@ -119,12 +119,19 @@ private:
 };
 
 typedef TightVector<ASTBlockScopeContextNameInfo, GCUtil::gc_malloc_atomic_allocator<ASTBlockScopeContextNameInfo>> ASTBlockScopeContextNameInfoVector;
+
+// scopes with many names (e.g. bundles which put every module into one function)
+// look names up through this map instead of scanning their name vectors
+#define AST_SCOPE_NAME_INDEX_MIN_SIZE 32
+typedef std::unordered_map<AtomicString, size_t, std::hash<AtomicString>, std::equal_to<AtomicString>, GCUtil::gc_malloc_allocator<std::pair<const AtomicString, size_t>>> ASTScopeNameIndexMap;
+
 // context for block in function or program
 struct ASTBlockScopeContext {
     LexicalBlockIndex m_blockIndex;
     LexicalBlockIndex m_parentBlockIndex;
     ASTBlockScopeContextNameInfoVector m_names;
     AtomicStringVector m_usingNames;
+    ASTScopeNameIndexMap *m_usingNamesIndex;
 #ifndef NDEBUG
     ExtendedNodeLOC m_loc;
 #endif
@@ -143,11 +150,34 @@ struct ASTBlockScopeContext {
     ASTBlockScopeContext()
         : m_blockIndex(LEXICAL_BLOCK_INDEX_MAX)
         , m_parentBlockIndex(LEXICAL_BLOCK_INDEX_MAX)
+        , m_usingNamesIndex(nullptr)
 #ifndef NDEBUG
         , m_loc(SIZE_MAX, SIZE_MAX, SIZE_MAX)
 #endif
     {
     }
+
+    void insertUsingName(AtomicString name)
+    {
+        if (m_usingNamesIndex) {
+            if (m_usingNamesIndex->insert(std::make_pair(name, m_usingNames.size())).second) {
+                m_usingNames.push_back(name);
+            }
+            return;
+        }
+
+        if (VectorUtil::findInVector(m_usingNames, name) != VectorUtil::invalidIndex) {
+            return;
+        }
+        m_usingNames.push_back(name);
+
+        if (m_usingNames.size() >= AST_SCOPE_NAME_INDEX_MIN_SIZE) {
+            m_usingNamesIndex = new (GC) ASTScopeNameIndexMap();
+            for (size_t i = 0; i < m_usingNames.size(); i++) {
+                m_usingNamesIndex->insert(std::make_pair(m_usingNames[i], i));
+            }
+        }
+    }
 };
 
 typedef Vector<ASTBlockScopeContext *, GCUtil::gc_malloc_atomic_allocator<ASTBlockScopeContext *>> ASTBlockScopeContextVector;
@@ -178,10 +208,12 @@ struct ASTFunctionScopeContext {
     LexicalBlockIndex m_lexicalBlockIndexFunctionLocatedIn : 16;
     ASTFunctionScopeContextNameInfoVector m_varNames;
     ASTFunctionScopeContextVarNameBloomFilter m_varNamesFilter;
+    ASTScopeNameIndexMap *m_varNamesIndex;
     AtomicStringTightVector m_parameters;
     AtomicString m_functionName;
 
     ASTFunctionScopeContext *m_firstChild;
+    ASTFunctionScopeContext *m_lastChild; // keeps appendChild O(1) for scopes with many functions
     ASTFunctionScopeContext *m_nextSibling;
     ASTBlockScopeContextVector m_childBlockScopes;
 
@@ -209,12 +241,9 @@ struct ASTFunctionScopeContext {
         if (m_firstChild == nullptr) {
             m_firstChild = child;
         } else {
-            ASTFunctionScopeContext *tail = firstChild();
-            while (tail->m_nextSibling != nullptr) {
-                tail = tail->m_nextSibling;
-            }
-            tail->m_nextSibling = child;
+            m_lastChild->m_nextSibling = child;
         }
+        m_lastChild = child;
     }
 
     ASTFunctionScopeContext *firstChild()
@@ -229,18 +258,29 @@ struct ASTFunctionScopeContext {
 
     bool hasVarName(AtomicString name)
     {
+        return findVarName(name) != SIZE_MAX;
+    }
+
+    // returns the index of name in m_varNames or SIZE_MAX
+    size_t findVarName(AtomicString name)
+    {
+        if (m_varNamesIndex) {
+            auto iter = m_varNamesIndex->find(name);
+            return iter == m_varNamesIndex->end() ? SIZE_MAX : iter->second;
+        }
+
         if (!mayContainVarName(name)) {
-            return false;
+            return SIZE_MAX;
         }
 
         size_t siz = m_varNames.size();
         for (size_t i = 0; i < siz; i++) {
             if (m_varNames[i].name() == name) {
-                return true;
+                return i;
             }
         }
 
-        return false;
+        return SIZE_MAX;
     }
 
     bool mayContainVarName(AtomicString name)
@@ -299,16 +339,12 @@ struct ASTFunctionScopeContext {
 
     void insertVarName(AtomicString name, LexicalBlockIndex blockIndex, bool isExplicitlyDeclaredOrParameterName, bool isVarDeclaration = true)
     {
-        if (mayContainVarName(name)) {
-            size_t siz = m_varNames.size();
-            for (size_t i = 0; i < siz; i++) {
-                if (m_varNames[i].name() == name) {
-                    if (isExplicitlyDeclaredOrParameterName) {
-                        m_varNames[i].setIsExplicitlyDeclaredOrParameterName(isExplicitlyDeclaredOrParameterName);
-                    }
-                    return;
-                }
+        size_t index = findVarName(name);
+        if (index != SIZE_MAX) {
+            if (isExplicitlyDeclaredOrParameterName) {
+                m_varNames[index].setIsExplicitlyDeclaredOrParameterName(isExplicitlyDeclaredOrParameterName);
             }
+            return;
         }
 
         ASTFunctionScopeContextNameInfo info;
@@ -318,14 +354,20 @@ struct ASTFunctionScopeContext {
         info.setLexicalBlockIndex(blockIndex);
         m_varNames.push_back(info);
         m_varNamesFilter.add(name);
+
+        if (m_varNamesIndex) {
+            m_varNamesIndex->insert(std::make_pair(name, m_varNames.size() - 1));
+        } else if (m_varNames.size() >= AST_SCOPE_NAME_INDEX_MIN_SIZE) {
+            m_varNamesIndex = new (GC) ASTScopeNameIndexMap();
+            for (size_t i = 0; i < m_varNames.size(); i++) {
+                m_varNamesIndex->insert(std::make_pair(m_varNames[i].name(), i));
+            }
+        }
     }
 
     void insertUsingName(AtomicString name, LexicalBlockIndex blockIndex)
     {
-        ASTBlockScopeContext *blockContext = findBlockFromBackward(blockIndex);
-        if (VectorUtil::findInVector(blockContext->m_usingNames, name) == VectorUtil::invalidIndex) {
-            blockContext->m_usingNames.push_back(name);
-        }
+        findBlockFromBackward(blockIndex)->insertUsingName(name);
     }
 
     void insertBlockScope(ASTAllocator &allocator, LexicalBlockIndex blockIndex, LexicalBlockIndex parentBlockIndex, ExtendedNodeLOC loc)
@@ -413,17 +455,9 @@ struct ASTFunctionScopeContext {
                 return false;
             }
 
-            if (!mayContainVarName(name)) {
-                return true;
-            }
-
-            size_t siz = m_varNames.size();
-            for (size_t i = 0; i < siz; i++) {
-                if (m_varNames[i].name() == name) {
-                    if (m_varNames[i].lexicalBlockIndex() >= blockIndex) {
-                        return false;
-                    }
-                }
+            size_t index = findVarName(name);
+            if (index != SIZE_MAX && m_varNames[index].lexicalBlockIndex() >= blockIndex) {
+                return false;
             }
         }
 
@@ -451,7 +485,9 @@ struct ASTFunctionScopeContext {
         , m_allowSuperProperty(false)
         , m_nodeType(ASTNodeType::Program)
         , m_lexicalBlockIndexFunctionLocatedIn(LEXICAL_BLOCK_INDEX_MAX)
+        , m_varNamesIndex(nullptr)
         , m_firstChild(nullptr)
+        , m_lastChild(nullptr)
         , m_nextSibling(nullptr)
         , m_paramsStartLOC(SIZE_MAX, SIZE_MAX, SIZE_MAX)
 #ifndef NDEBUG
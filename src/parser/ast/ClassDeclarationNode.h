@@ -54,7 +54,7 @@ public:
         context->m_classInfo.m_superIndex = m_class.superClass() ? context->getRegister() : SIZE_MAX;
 
         context->m_classInfo.m_name = classIdent ? classIdent->asIdentifier()->name() : AtomicString();
-        context->m_classInfo.m_src = new StringView(m_class.classSrc());
+        context->m_classInfo.m_src = codeBlock->m_codeBlock->script()->sourceCodeText(m_class.classSrc());
         codeBlock->m_literalData.push_back(context->m_classInfo.m_src);
 
         size_t lexicalBlockIndexBefore = context->m_lexicalBlockIndex;
@@ -126,6 +126,8 @@ public:
     ::Escargot::Context* escargotContext;
     Scanner* scanner;
     Scanner scannerInstance;
+    // tokens scanned ahead, or nullptr
+    TokenTable* tokenTable;
 
     ASTAllocator& allocator;
 
@@ -158,6 +160,7 @@ public:
     bool isParsingSingleFunction;
     size_t stackLimit;
     size_t subCodeBlockIndex;
+    InterpretedCodeBlock::ChildBlockCursor childBlockCursor;
 
     LexicalBlockIndex lexicalBlockIndex;
     LexicalBlockIndex lexicalBlockCount;
@@ -207,6 +210,7 @@ public:
         this->codeBlock = nullptr;
 
         this->scanner = &scannerInstance;
+        this->tokenTable = nullptr;
         if (stackRemain >= STACK_LIMIT_FROM_BASE) {
             stackRemain = STACK_LIMIT_FROM_BASE;
         }
@@ -409,7 +413,7 @@ public:
         size_t orgIndex = this->lookahead.start;
         this->expect(LeftParenthesis);
 
-        InterpretedCodeBlock* childBlock = currentTarget->childBlockAt(this->subCodeBlockIndex);
+        InterpretedCodeBlock* childBlock = currentTarget->childBlockAt(this->subCodeBlockIndex, this->childBlockCursor);
         StringView src = childBlock->src();
         this->scanner->index = src.length() + orgIndex;
 
@@ -562,14 +566,22 @@ public:
         this->lastMarker.lineNumber = this->scanner->lineNumber;
         this->lastMarker.lineStart = this->scanner->lineStart;
 
-        this->collectComments();
+        Scanner::ScannerResult* next = &this->lookahead;
+        const ScannedToken* scanned = UNLIKELY(this->tokenTable != nullptr) ? this->tokenTable->tokenAt(this->scanner->index) : nullptr;
+        if (scanned) {
+            this->scanner->takeScannedToken(*scanned, next);
+            this->startMarker.index = next->start;
+            this->startMarker.lineNumber = this->scanner->lineNumber;
+            this->startMarker.lineStart = this->scanner->lineStart;
+        } else {
+            this->collectComments();
 
-        this->startMarker.index = this->scanner->index;
-        this->startMarker.lineNumber = this->scanner->lineNumber;
-        this->startMarker.lineStart = this->scanner->lineStart;
+            this->startMarker.index = this->scanner->index;
+            this->startMarker.lineNumber = this->scanner->lineNumber;
+            this->startMarker.lineStart = this->scanner->lineStart;
 
-        Scanner::ScannerResult* next = &this->lookahead;
-        this->scanner->lex(next);
+            this->scanner->lex(next);
+        }
         this->hasLineTerminator = tokenLineNumber != next->lineNumber;
 
         if (this->context->strict && next->type == Token::IdentifierToken && this->scanner->isStrictModeReservedWord(next->relatedSource(this->scanner->source))) {
@@ -909,6 +921,15 @@ public:
     {
         ASSERT(token != nullptr);
         ASTNode ret;
+        if (token->type == Token::KeywordToken && !token->hasKeywordButUseString) {
+            // keywords used as names are already interned
+            ret = builder.createIdentifierNode(keywordToString(this->escargotContext, token->valueKeywordKind));
+            if (this->trackUsingNames) {
+                insertUsingName(ret->asIdentifier()->name());
+            }
+            return ret;
+        }
+
         StringView sv = token->valueStringLiteral(this->scanner);
         const auto& a = sv.bufferAccessData();
         char16_t firstCh = a.charAt(0);
@@ -1879,6 +1900,27 @@ public:
         return this->finalize(node, finishIdentifier(builder, token));
     }
 
+    // property name of a member expression like `a.b`
+    // the SyntaxChecker pass only scans function bodies, so it validates the name without interning it
+    template <class ASTBuilder>
+    ASTNode parseMemberPropertyName(ASTBuilder& builder)
+    {
+        if (builder.isNodeGenerator()) {
+            bool trackUsingNamesBefore = this->trackUsingNames;
+            this->trackUsingNames = false;
+            ASTNode property = this->parseIdentifierName(builder);
+            this->trackUsingNames = trackUsingNamesBefore;
+            return property;
+        }
+
+        ALLOC_TOKEN(token);
+        this->nextToken(token);
+        if (!this->isIdentifierName(token)) {
+            this->throwUnexpectedToken(*token);
+        }
+        return builder.createIdentifierNode(AtomicString());
+    }
+
     template <class ASTBuilder>
     ASTNode parseNewExpression(ASTBuilder& builder)
     {
@@ -1936,11 +1978,8 @@ public:
                     this->context->isBindingElement = false;
                     this->context->isAssignmentTarget = true;
                     this->nextToken();
-                    bool trackUsingNamesBefore = this->trackUsingNames;
-                    this->trackUsingNames = false;
-                    ASTNode property = this->parseIdentifierName(builder);
+                    ASTNode property = this->parseMemberPropertyName(builder);
                     exprNode = this->finalize(this->startNode(startToken), builder.createMemberExpressionNode(exprNode, property, true));
-                    this->trackUsingNames = trackUsingNamesBefore;
                 } else if (this->lookahead.valuePunctuatorKind == LeftParenthesis) {
                     this->context->isBindingElement = false;
                     this->context->isAssignmentTarget = false;
@@ -2017,11 +2056,8 @@ public:
                 this->context->isBindingElement = false;
                 this->context->isAssignmentTarget = true;
                 this->expect(Period);
-                bool trackUsingNamesBefore = this->trackUsingNames;
-                this->trackUsingNames = false;
-                ASTNode property = this->parseIdentifierName(builder);
+                ASTNode property = this->parseMemberPropertyName(builder);
                 exprNode = this->finalize(node, builder.createMemberExpressionNode(exprNode, property, true));
-                this->trackUsingNames = trackUsingNamesBefore;
             } else if (this->lookahead.type == Token::TemplateToken && this->lookahead.valueTemplate->head) {
                 ASTNode quasi = this->parseTemplateLiteral(builder);
                 // FIXME convertTaggedTemplateExpressionToCallExpression
@@ -2500,7 +2536,7 @@ public:
                     InterpretedCodeBlock* currentTarget = this->codeBlock->asInterpretedCodeBlock();
                     size_t orgIndex = this->lookahead.start;
 
-                    InterpretedCodeBlock* childBlock = currentTarget->childBlockAt(this->subCodeBlockIndex);
+                    InterpretedCodeBlock* childBlock = currentTarget->childBlockAt(this->subCodeBlockIndex, this->childBlockCursor);
                     StringView src = childBlock->src();
                     this->scanner->index = src.length() + orgIndex;
                     this->scanner->lineNumber = childBlock->sourceElementStart().line;
@@ -2862,10 +2898,7 @@ public:
 
                     auto parentBlockContext = currentFunctionScope->findBlockFromBackward(parentBlockIndex);
                     for (size_t i = 0; i < blockContext->m_usingNames.size(); i++) {
-                        AtomicString name = blockContext->m_usingNames[i];
-                        if (VectorUtil::findInVector(parentBlockContext->m_usingNames, name) == VectorUtil::invalidIndex) {
-                            parentBlockContext->m_usingNames.push_back(name);
-                        }
+                        parentBlockContext->insertUsingName(blockContext->m_usingNames[i]);
                     }
 
                     // remove current block context from function context
@@ -5279,7 +5312,7 @@ public:
     }
 };
 
-ProgramNode* parseProgram(::Escargot::Context* ctx, StringView source, bool isModule, bool strictFromOutside, bool inWith, size_t stackRemain, bool allowSuperCallOutside, bool allowSuperPropertyOutside)
+ProgramNode* parseProgram(::Escargot::Context* ctx, StringView source, bool isModule, bool strictFromOutside, bool inWith, size_t stackRemain, bool allowSuperCallOutside, bool allowSuperPropertyOutside, TokenTable* tokenTable)
 {
     // GC should be disabled during the parsing process
     ASSERT(GC_is_disabled());
@@ -5288,10 +5321,12 @@ ProgramNode* parseProgram(::Escargot::Context* ctx, StringView source, bool isMo
     Parser parser(ctx, source, isModule, stackRemain);
     NodeGenerator builder(ctx->astAllocator());
 
+    parser.scanner->copyStringLiterals = ScriptSourceStore::canStore(source.length());
     parser.context->strict = strictFromOutside;
     parser.context->inWith = inWith;
     parser.context->allowSuperCall = allowSuperCallOutside;
     parser.context->allowSuperProperty = allowSuperPropertyOutside;
+    parser.tokenTable = tokenTable;
 
     ProgramNode* nd = parser.parseProgram(builder);
     return nd;
@@ -5306,6 +5341,7 @@ FunctionNode* parseSingleFunction(::Escargot::Context* ctx, InterpretedCodeBlock
     Parser parser(ctx, codeBlock->src(), false, stackRemain, codeBlock->sourceElementStart());
     NodeGenerator builder(ctx->astAllocator());
 
+    parser.scanner->copyStringLiterals = codeBlock->script()->isSourceCodeStored();
     parser.trackUsingNames = false;
     parser.context->allowLexicalDeclaration = true;
     parser.context->allowSuperCall = true;
@@ -32,6 +32,10 @@ class ProgramNode;
 class FunctionNode;
 class CodeBlock;
 
+namespace EscargotLexer {
+class TokenTable;
+}
+
 // Based on the latest esprima version 4.0.1
 
 namespace esprima {
@@ -61,7 +65,7 @@ struct Error : public gc {
 
 #define ESPRIMA_RECURSIVE_LIMIT 1024
 
-ProgramNode* parseProgram(::Escargot::Context* ctx, StringView source, bool isModule, bool strictFromOutside, bool inWith, size_t stackRemain, bool allowSuperCallOutside, bool allowSuperPropertyOutside);
+ProgramNode* parseProgram(::Escargot::Context* ctx, StringView source, bool isModule, bool strictFromOutside, bool inWith, size_t stackRemain, bool allowSuperCallOutside, bool allowSuperPropertyOutside, EscargotLexer::TokenTable* tokenTable = nullptr);
 FunctionNode* parseSingleFunction(::Escargot::Context* ctx, InterpretedCodeBlock* codeBlock, ASTFunctionScopeContext*& scopeContext, size_t stackRemain);
 }
 }
@@ -29,6 +29,8 @@ ArrayBufferObject::ArrayBufferObject(ExecutionState& state)
     , m_context(state.context())
     , m_data(nullptr)
     , m_bytelength(0)
+    , m_externalBufferReleaseCallback(nullptr)
+    , m_externalBufferReleaseCallbackData(nullptr)
 {
     Object::setPrototype(state, state.context()->globalObject()->arrayBufferPrototype());
 }
@@ -39,12 +41,7 @@ void ArrayBufferObject::allocateBuffer(ExecutionState& state, size_t bytelength)
 
     m_data = (uint8_t*)m_context->vmInstance()->platform()->onArrayBufferObjectDataBufferMalloc(m_context, this, bytelength);
     m_bytelength = bytelength;
-    GC_REGISTER_FINALIZER_NO_ORDER(this, [](void* obj,
-                                            void*) {
-        ArrayBufferObject* self = (ArrayBufferObject*)obj;
-        self->m_context->vmInstance()->platform()->onArrayBufferObjectDataBufferFree(self->m_context, self, self->m_data);
-    },
-                                   nullptr, nullptr, nullptr);
+    registerBufferFinalizer();
 }
 
 void ArrayBufferObject::attachBuffer(ExecutionState& state, void* buffer, size_t bytelength)
@@ -52,19 +49,45 @@ void ArrayBufferObject::attachBuffer(ExecutionState& state, void* buffer, size_t
     ASSERT(isDetachedBuffer());
     m_data = (uint8_t*)buffer;
     m_bytelength = bytelength;
+    registerBufferFinalizer();
+}
+
+void ArrayBufferObject::attachExternalBuffer(ExecutionState& state, void* buffer, size_t bytelength, ArrayBufferObjectExternalBufferReleaseCallback releaseCallback, void* releaseCallbackData)
+{
+    ASSERT(isDetachedBuffer());
+    m_data = (uint8_t*)buffer;
+    m_bytelength = bytelength;
+    m_externalBufferReleaseCallback = releaseCallback;
+    m_externalBufferReleaseCallbackData = releaseCallbackData;
+    registerBufferFinalizer();
+}
+
+void ArrayBufferObject::detachArrayBuffer(ExecutionState& state)
+{
+    releaseBuffer();
+    m_data = NULL;
+    m_bytelength = 0;
+}
+
+void ArrayBufferObject::registerBufferFinalizer()
+{
     GC_REGISTER_FINALIZER_NO_ORDER(this, [](void* obj,
                                             void*) {
         ArrayBufferObject* self = (ArrayBufferObject*)obj;
-        self->m_context->vmInstance()->platform()->onArrayBufferObjectDataBufferFree(self->m_context, self, self->m_data);
+        self->releaseBuffer();
     },
                                    nullptr, nullptr, nullptr);
 }
 
-void ArrayBufferObject::detachArrayBuffer(ExecutionState& state)
+void ArrayBufferObject::releaseBuffer()
 {
-    m_context->vmInstance()->platform()->onArrayBufferObjectDataBufferFree(m_context, this, m_data);
-    m_data = NULL;
-    m_bytelength = 0;
+    if (m_externalBufferReleaseCallback) {
+        m_externalBufferReleaseCallback(m_data, m_bytelength, m_externalBufferReleaseCallbackData);
+        m_externalBufferReleaseCallback = nullptr;
+        m_externalBufferReleaseCallbackData = nullptr;
+    } else {
+        m_context->vmInstance()->platform()->onArrayBufferObjectDataBufferFree(m_context, this, m_data);
+    }
 }
 
 // http://www.ecma-international.org/ecma-262/6.0/#sec-clonearraybuffer
@@ -37,6 +37,8 @@ enum TypedArrayType : unsigned {
     Float64
 };
 
+typedef void (*ArrayBufferObjectExternalBufferReleaseCallback)(void* buffer, size_t byteLength, void* data);
+
 class ArrayBufferObject : public Object {
 public:
     explicit ArrayBufferObject(ExecutionState& state);
@@ -54,6 +56,9 @@ public:
     bool cloneBuffer(ExecutionState& state, ArrayBufferObject* srcBuffer, size_t srcByteOffset, size_t cloneLength);
     void allocateBuffer(ExecutionState& state, size_t bytelength);
     void attachBuffer(ExecutionState& state, void* buffer, size_t bytelength);
+    // uses memory owned by the embedder without copying it
+    // releaseCallback frees it instead of Platform::onArrayBufferObjectDataBufferFree when the buffer is detached or collected
+    void attachExternalBuffer(ExecutionState& state, void* buffer, size_t bytelength, ArrayBufferObjectExternalBufferReleaseCallback releaseCallback, void* releaseCallbackData);
     void detachArrayBuffer(ExecutionState& state);
 
     virtual bool isArrayBufferObject() const
@@ -146,9 +151,14 @@ public:
     void* operator new[](size_t size) = delete;
 
 private:
+    void registerBufferFinalizer();
+    void releaseBuffer();
+
     Context* m_context;
     uint8_t* m_data;
     unsigned m_bytelength;
+    ArrayBufferObjectExternalBufferReleaseCallback m_externalBufferReleaseCallback;
+    void* m_externalBufferReleaseCallbackData;
 };
 }
 
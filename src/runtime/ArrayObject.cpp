@@ -55,6 +55,23 @@ ArrayObject::ArrayObject(ExecutionState& state, double length)
                                                                                                                           (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::NonEnumerablePresent | ObjectPropertyDescriptor::NonConfigurablePresent)));
 }
 
+ArrayObject::ArrayObject(ExecutionState& state, const Value* src, size_t length)
+    : ArrayObject(state)
+{
+    ASSERT(length <= ((1LL << 32LL) - 1LL));
+    if (LIKELY(isFastModeArray())) {
+        m_values[ESCARGOT_OBJECT_BUILTIN_PROPERTY_NUMBER] = Value(length);
+        m_fastModeData.resize(0, length);
+        for (size_t i = 0; i < length; i++) {
+            m_fastModeData[i] = src[i];
+        }
+    } else {
+        for (size_t i = 0; i < length; i++) {
+            defineOwnProperty(state, ObjectPropertyName(state, Value(i)), ObjectPropertyDescriptor(src[i], ObjectPropertyDescriptor::AllPresent));
+        }
+    }
+}
+
 ArrayObject* ArrayObject::createSpreadArray(ExecutionState& state)
 {
     // SpreadArray is a Fixed Array which has no __proto__ property
@@ -287,6 +304,32 @@ void ArrayObject::convertIntoNonFastMode(ExecutionState& state)
     m_fastModeData.clear();
 }
 
+bool ArrayObject::canUseFastModeAccess(ExecutionState& state)
+{
+    if (UNLIKELY(!isFastModeArray() || state.context()->vmInstance()->didSomePrototypeObjectDefineIndexedProperty())) {
+        return false;
+    }
+
+    if (UNLIKELY(!structure()->readProperty(state, (size_t)0).m_descriptor.isWritable())) {
+        return false;
+    }
+
+    // Array.prototype stores its own elements in fast mode too,
+    // which does not set didSomePrototypeObjectDefineIndexedProperty
+    // none of the objects involved can be a Proxy, so [[GetPrototypeOf]] is never virtual here
+    GlobalObject* globalObject = state.context()->globalObject();
+    ArrayObject* arrayPrototype = globalObject->arrayPrototype()->asArrayObject();
+    if (UNLIKELY(Object::getPrototypeObject(state) != arrayPrototype)) {
+        return false;
+    }
+    if (UNLIKELY(!arrayPrototype->isFastModeArray() || arrayPrototype->getArrayLength(state) != 0)) {
+        return false;
+    }
+
+    Object* objectPrototype = globalObject->objectPrototype();
+    return arrayPrototype->Object::getPrototypeObject(state) == objectPrototype && objectPrototype->Object::getPrototypeObject(state) == nullptr;
+}
+
 bool ArrayObject::setArrayLength(ExecutionState& state, const uint64_t newLength)
 {
     if (UNLIKELY(isFastModeArray() && (newLength > ESCARGOT_ARRAY_NON_FASTMODE_MIN_SIZE))) {
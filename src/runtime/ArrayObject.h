@@ -38,6 +38,8 @@ class ArrayObject : public Object {
     friend class Context;
     friend class Object;
     friend class ByteCodeInterpreter;
+    friend class JSONStringifier;
+    friend class ArrayObjectFastModeAccess;
     friend Value builtinArrayConstructor(ExecutionState& state, Value thisValue, size_t argc, Value* argv, bool isNewExpression);
     friend void initializeCustomAllocators();
     friend int getValidValueInArrayObject(void* ptr, GC_mark_custom_result* arr);
@@ -45,6 +47,8 @@ class ArrayObject : public Object {
 public:
     explicit ArrayObject(ExecutionState& state);
     ArrayObject(ExecutionState& state, double size); // http://www.ecma-international.org/ecma-262/7.0/index.html#sec-arraycreate
+    // creates [src[0], ..., src[length - 1]] in one step
+    ArrayObject(ExecutionState& state, const Value* src, size_t length);
 
     static ArrayObject* createSpreadArray(ExecutionState& state);
 
@@ -102,6 +106,25 @@ private:
         return rareData()->m_isFastModeArrayObject;
     }
 
+    ALWAYS_INLINE uint32_t getArrayLength(ExecutionState& state)
+    {
+        return m_values[ESCARGOT_OBJECT_BUILTIN_PROPERTY_NUMBER].toUint32(state);
+    }
+
+    bool setArrayLength(ExecutionState& state, const uint64_t newLength);
+
+    // Array builtins may read and write fastModeData() directly while this returns true:
+    // the array is in fast mode with a writable length, and no object on its prototype chain
+    // can supply an indexed property, so a hole behaves as an absent element reading undefined.
+    // Any call into user code can invalidate it.
+    bool canUseFastModeAccess(ExecutionState& state);
+
+    SmallValue* fastModeData()
+    {
+        ASSERT(isFastModeArray());
+        return m_fastModeData.data();
+    }
+
     ALWAYS_INLINE bool isInArrayObjectDefineOwnProperty()
     {
         if (LIKELY(rareData() == nullptr)) {
@@ -110,12 +133,6 @@ private:
         return rareData()->m_isInArrayObjectDefineOwnProperty;
     }
 
-    ALWAYS_INLINE uint32_t getArrayLength(ExecutionState& state)
-    {
-        return m_values[ESCARGOT_OBJECT_BUILTIN_PROPERTY_NUMBER].toUint32(state);
-    }
-
-    bool setArrayLength(ExecutionState& state, const uint64_t newLength);
     bool defineArrayLengthProperty(ExecutionState& state, const ObjectPropertyDescriptor& desc);
     void convertIntoNonFastMode(ExecutionState& state);
 
@@ -24,12 +24,14 @@
 #include "GlobalObject.h"
 #include "StringObject.h"
 #include "parser/ScriptParser.h"
+#include "parser/EvalCodeCache.h"
 #include "ObjectStructure.h"
 #include "Environment.h"
 #include "EnvironmentRecord.h"
 #include "parser/CodeBlock.h"
 #include "SandBox.h"
 #include "ArrayObject.h"
+#include "TypedArrayObject.h"
 
 namespace Escargot {
 
@@ -54,6 +56,7 @@ Context::Context(VMInstance* instance)
     , m_compiledCodeBlocks(instance->m_compiledCodeBlocks)
     , m_bumpPointerAllocator(instance->m_bumpPointerAllocator)
     , m_regexpCache(&instance->m_regexpCache)
+    , m_evalCodeCache(new EvalCodeCache())
     , m_toStringRecursionPreventer(&instance->m_toStringRecursionPreventer)
     , m_astAllocator(*instance->m_astAllocator)
 {
@@ -82,6 +85,16 @@ Context::Context(VMInstance* instance)
 
     auto temp = new ArrayObject(stateForInit);
     g_arrayObjectTag = *((size_t*)temp);
+
+    g_typedArrayObjectTags[TypedArrayType::Int8] = *((size_t*)new Int8ArrayObject(stateForInit));
+    g_typedArrayObjectTags[TypedArrayType::Int16] = *((size_t*)new Int16ArrayObject(stateForInit));
+    g_typedArrayObjectTags[TypedArrayType::Int32] = *((size_t*)new Int32ArrayObject(stateForInit));
+    g_typedArrayObjectTags[TypedArrayType::Uint8] = *((size_t*)new Uint8ArrayObject(stateForInit));
+    g_typedArrayObjectTags[TypedArrayType::Uint16] = *((size_t*)new Uint16ArrayObject(stateForInit));
+    g_typedArrayObjectTags[TypedArrayType::Uint32] = *((size_t*)new Uint32ArrayObject(stateForInit));
+    g_typedArrayObjectTags[TypedArrayType::Uint8Clamped] = *((size_t*)new Uint8ClampedArrayObject(stateForInit));
+    g_typedArrayObjectTags[TypedArrayType::Float32] = *((size_t*)new Float32ArrayObject(stateForInit));
+    g_typedArrayObjectTags[TypedArrayType::Float64] = *((size_t*)new Float64ArrayObject(stateForInit));
 }
 
 void Context::throwException(ExecutionState& state, const Value& exception)
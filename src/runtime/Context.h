@@ -38,6 +38,7 @@ class ObjectStructure;
 class ControlFlowRecord;
 class SandBox;
 class ByteCodeBlock;
+class EvalCodeCache;
 class ToStringRecursionPreventer;
 
 struct IdentifierRecord {
@@ -103,6 +104,11 @@ public:
         return m_regexpCache;
     }
 
+    EvalCodeCache* evalCodeCache()
+    {
+        return m_evalCodeCache;
+    }
+
     WTF::BumpPointerAllocator* bumpPointerAllocator()
     {
         return m_bumpPointerAllocator;
@@ -253,6 +259,7 @@ private:
     Vector<CodeBlock*, GCUtil::gc_malloc_allocator<CodeBlock*>>& m_compiledCodeBlocks;
     WTF::BumpPointerAllocator* m_bumpPointerAllocator;
     RegExpCacheMap* m_regexpCache;
+    EvalCodeCache* m_evalCodeCache;
     ObjectStructure* m_defaultStructureForObject;
     ObjectStructure* m_defaultStructureForFunctionObject;
     ObjectStructure* m_defaultStructureForNotConstructorFunctionObject;
@@ -146,7 +146,7 @@ public:
     struct StackTraceGCData {
         union {
             ByteCodeBlock* byteCodeBlock;
-            String* infoString;
+            CodeBlock* codeBlock;
         };
     };
     struct StackTraceNonGCData {
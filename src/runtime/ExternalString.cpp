@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2017-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+
+#include "Escargot.h"
+#include "ExternalString.h"
+#include "runtime/StringConversion.h"
+
+#if defined(OS_POSIX)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Escargot {
+
+ExternalLatin1String::ExternalLatin1String(const LChar* buffer, size_t length, ExternalStringReleaseCallback releaseCallback, void* releaseCallbackData)
+    : Latin1String()
+    , m_releaseCallback(releaseCallback)
+    , m_releaseCallbackData(releaseCallbackData)
+{
+    m_bufferAccessData.has8BitContent = true;
+    m_bufferAccessData.length = length;
+    m_bufferAccessData.buffer = buffer;
+
+    if (m_releaseCallback) {
+        GC_REGISTER_FINALIZER_NO_ORDER(this, [](void* obj,
+                                                void*) {
+            ExternalLatin1String* self = (ExternalLatin1String*)obj;
+            self->m_releaseCallback(self->m_bufferAccessData.buffer, self->m_bufferAccessData.length, self->m_releaseCallbackData);
+        },
+                                       nullptr, nullptr, nullptr);
+    }
+}
+
+void* ExternalLatin1String::operator new(size_t size)
+{
+    // the buffer and the callback data are not allocated by GC
+    return GC_MALLOC_ATOMIC(size);
+}
+
+ExternalUTF16String::ExternalUTF16String(const char16_t* buffer, size_t length, ExternalStringReleaseCallback releaseCallback, void* releaseCallbackData)
+    : UTF16String()
+    , m_releaseCallback(releaseCallback)
+    , m_releaseCallbackData(releaseCallbackData)
+{
+    m_bufferAccessData.has8BitContent = false;
+    m_bufferAccessData.length = length;
+    m_bufferAccessData.buffer = buffer;
+
+    if (m_releaseCallback) {
+        GC_REGISTER_FINALIZER_NO_ORDER(this, [](void* obj,
+                                                void*) {
+            ExternalUTF16String* self = (ExternalUTF16String*)obj;
+            self->m_releaseCallback(self->m_bufferAccessData.buffer, self->m_bufferAccessData.length, self->m_releaseCallbackData);
+        },
+                                       nullptr, nullptr, nullptr);
+    }
+}
+
+void* ExternalUTF16String::operator new(size_t size)
+{
+    // the buffer and the callback data are not allocated by GC
+    return GC_MALLOC_ATOMIC(size);
+}
+
+#if defined(OS_POSIX)
+static String* stringFromMappedFile(int fd, size_t size, bool mayKeepMapping)
+{
+    void* mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapped == MAP_FAILED) {
+        return nullptr;
+    }
+
+    const LChar* buffer = (const LChar*)mapped;
+    String* result;
+    if (StringConversion::asciiPrefixLength(buffer, size) == size) {
+        if (mayKeepMapping) {
+            return new ExternalLatin1String(buffer, size, [](const void* buffer, size_t length, void*) {
+                munmap(const_cast<void*>(buffer), length);
+            },
+                                            nullptr);
+        }
+        result = new Latin1String(buffer, size);
+    } else {
+        result = String::fromUTF8((const char*)buffer, size);
+    }
+    munmap(mapped, size);
+    return result;
+}
+#endif
+
+String* stringFromUTF8File(const char* path, bool mayMapFile)
+{
+#if defined(OS_POSIX)
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    String* result = nullptr;
+    struct stat st;
+    if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+        result = stringFromMappedFile(fd, st.st_size, mayMapFile && st.st_size >= STRING_FROM_FILE_MAP_SIZE_MIN);
+    }
+
+    if (!result) {
+        // pipes, character devices, files that cannot be mapped and files that report no size
+        // such as the ones in /proc are read sequentially
+        std::string utf8;
+        char buf[4096];
+        ssize_t readLen;
+        while ((readLen = read(fd, buf, sizeof buf)) > 0) {
+            utf8.append(buf, readLen);
+        }
+        result = String::fromUTF8(utf8.data(), utf8.length());
+    }
+    close(fd);
+    return result;
+#else
+    FILE* fp = fopen(path, "rb");
+    if (!fp) {
+        return nullptr;
+    }
+
+    std::string utf8;
+    char buf[4096];
+    size_t readLen;
+    while ((readLen = fread(buf, 1, sizeof buf, fp))) {
+        utf8.append(buf, readLen);
+    }
+    fclose(fp);
+    return String::fromUTF8(utf8.data(), utf8.length());
+#endif
+}
+} // namespace Escargot
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2017-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+
+#ifndef __EscargotExternalString__
+#define __EscargotExternalString__
+
+#include "runtime/String.h"
+
+namespace Escargot {
+
+typedef void (*ExternalStringReleaseCallback)(const void* buffer, size_t length, void* data);
+
+// Strings whose characters stay in memory owned by the embedder instead of being copied.
+// The memory must not change while the string is alive;
+// releaseCallback is called from the GC finalizer once the string is collected.
+class ExternalLatin1String : public Latin1String {
+public:
+    ExternalLatin1String(const LChar* buffer, size_t length, ExternalStringReleaseCallback releaseCallback, void* releaseCallbackData);
+
+    void* operator new(size_t size);
+    void* operator new[](size_t size) = delete;
+
+private:
+    ExternalStringReleaseCallback m_releaseCallback;
+    void* m_releaseCallbackData;
+};
+
+class ExternalUTF16String : public UTF16String {
+public:
+    ExternalUTF16String(const char16_t* buffer, size_t length, ExternalStringReleaseCallback releaseCallback, void* releaseCallbackData);
+
+    void* operator new(size_t size);
+    void* operator new[](size_t size) = delete;
+
+private:
+    ExternalStringReleaseCallback m_releaseCallback;
+    void* m_releaseCallbackData;
+};
+
+// Reads a UTF-8 file into a String. Returns nullptr if the file cannot be opened.
+// With mayMapFile, a pure ASCII regular file of at least STRING_FROM_FILE_MAP_SIZE_MIN bytes is
+// used in place as an ExternalLatin1String that unmaps it once collected. Reading it raises SIGBUS
+// if the file is truncated meanwhile, and rewriting it changes the String under its cached hash.
+// Every other file is copied
+String* stringFromUTF8File(const char* path, bool mayMapFile);
+} // namespace Escargot
+
+#endif
@@ -24,6 +24,7 @@
 #include "interpreter/ByteCode.h"
 #include "parser/ast/ProgramNode.h"
 #include "parser/ScriptParser.h"
+#include "parser/EvalCodeCache.h"
 #include "parser/esprima_cpp/esprima.h"
 #include "runtime/Environment.h"
 #include "runtime/EnvironmentRecord.h"
@@ -148,12 +149,20 @@ FunctionObject::FunctionSource FunctionObject::createFunctionSourceFromScriptSou
     src.appendString(source);
     src.appendString("\n}");
 
-    ScriptParser parser(state.context());
     String* scriptSource = src.finalize(&state);
 
-    Script* script = parser.initializeScript(StringView(scriptSource, 0, scriptSource->length()), new ASCIIString("Function Constructor input"), false, nullptr, false, false, false, false, SIZE_MAX, false, allowSuperCall, false).scriptThrowsExceptionIfParseError(state);
-    InterpretedCodeBlock* cb = script->topCodeBlock()->firstChild();
-    cb->updateSourceElementStart(3, 1);
+    EvalCodeCache::Key key(EvalCodeCache::FunctionConstructor, scriptSource, nullptr, false, false, false, allowSuperCall);
+    Script* script = state.context()->evalCodeCache()->find(key);
+    InterpretedCodeBlock* cb;
+    if (script) {
+        cb = script->topCodeBlock()->firstChild();
+    } else {
+        ScriptParser parser(state.context());
+        script = parser.initializeScript(StringView(scriptSource, 0, scriptSource->length()), new ASCIIString("Function Constructor input"), false, nullptr, false, false, false, false, SIZE_MAX, false, allowSuperCall, false).scriptThrowsExceptionIfParseError(state);
+        cb = script->topCodeBlock()->firstChild();
+        cb->updateSourceElementStart(3, 1);
+        state.context()->evalCodeCache()->insert(key, script);
+    }
     LexicalEnvironment* globalEnvironment = new LexicalEnvironment(new GlobalEnvironmentRecord(state, script->topCodeBlock(), state.context()->globalObject(), &state.context()->globalDeclarativeRecord(), &state.context()->globalDeclarativeStorage()), nullptr);
 
     FunctionObject::FunctionSource fs;
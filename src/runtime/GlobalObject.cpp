@@ -35,6 +35,7 @@
 #include "NativeFunctionObject.h"
 #include "parser/Lexer.h"
 #include "parser/ScriptParser.h"
+#include "parser/EvalCodeCache.h"
 #include "heap/LeakCheckerBridge.h"
 #include "EnvironmentRecord.h"
 #include "Environment.h"
@@ -156,7 +157,12 @@ Value GlobalObject::eval(ExecutionState& state, const Value& arg)
 #else
         size_t stackRemainApprox = STACK_LIMIT_FROM_BASE - (currentStackBase - state.stackBase());
 #endif
-        Script* script = parser.initializeScript(StringView(arg.asString(), 0, arg.asString()->length()), String::fromUTF8(s, strlen(s)), false, nullptr, strictFromOutside, false, true, false, stackRemainApprox, true, false, false).scriptThrowsExceptionIfParseError(state);
+        EvalCodeCache::Key key(EvalCodeCache::IndirectEval, arg.asString());
+        Script* script = m_context->evalCodeCache()->find(key);
+        if (!script) {
+            script = parser.initializeScript(StringView(arg.asString(), 0, arg.asString()->length()), String::fromUTF8(s, strlen(s)), false, nullptr, strictFromOutside, false, true, false, stackRemainApprox, true, false, false).scriptThrowsExceptionIfParseError(state);
+            m_context->evalCodeCache()->insert(key, script);
+        }
         // In case of indirect call, use global execution context
         ExecutionState stateForNewGlobal(m_context);
         return script->execute(stateForNewGlobal, true, script->topCodeBlock()->isStrict());
@@ -200,7 +206,12 @@ Value GlobalObject::evalLocal(ExecutionState& state, const Value& arg, Value thi
         size_t stackRemainApprox = STACK_LIMIT_FROM_BASE - (currentStackBase - state.stackBase());
 #endif
 
-        Script* script = parser.initializeScript(StringView(arg.asString(), 0, arg.asString()->length()), String::fromUTF8(s, sizeof(s) - 1), false, parentCodeBlock, strictFromOutside, isRunningEvalOnFunction, true, inWithOperation, stackRemainApprox, true, parentCodeBlock->allowSuperCall(), parentCodeBlock->allowSuperProperty()).scriptThrowsExceptionIfParseError(state);
+        EvalCodeCache::Key key(EvalCodeCache::DirectEval, arg.asString(), parentCodeBlock, strictFromOutside, isRunningEvalOnFunction, inWithOperation);
+        Script* script = m_context->evalCodeCache()->find(key);
+        if (!script) {
+            script = parser.initializeScript(StringView(arg.asString(), 0, arg.asString()->length()), String::fromUTF8(s, sizeof(s) - 1), false, parentCodeBlock, strictFromOutside, isRunningEvalOnFunction, true, inWithOperation, stackRemainApprox, true, parentCodeBlock->allowSuperCall(), parentCodeBlock->allowSuperProperty()).scriptThrowsExceptionIfParseError(state);
+            m_context->evalCodeCache()->insert(key, script);
+        }
         return script->executeLocal(state, thisValue, parentCodeBlock, script->topCodeBlock()->isStrict(), isRunningEvalOnFunction);
     }
     return arg;
@@ -75,6 +75,7 @@ public:
         , m_string(nullptr)
         , m_stringPrototype(nullptr)
         , m_stringIteratorPrototype(nullptr)
+        , m_stringIteratorPrototypeNext(nullptr)
         , m_number(nullptr)
         , m_numberPrototype(nullptr)
         , m_symbol(nullptr)
@@ -82,6 +83,7 @@ public:
         , m_array(nullptr)
         , m_arrayPrototype(nullptr)
         , m_arrayIteratorPrototype(nullptr)
+        , m_arrayIteratorPrototypeNext(nullptr)
         , m_arrayPrototypeValues(nullptr)
         , m_boolean(nullptr)
         , m_booleanPrototype(nullptr)
@@ -95,6 +97,7 @@ public:
         , m_eval(nullptr)
         , m_throwTypeError(nullptr)
         , m_throwerGetterSetterData(nullptr)
+        , m_errorStackGetterSetterData(nullptr)
         , m_stringProxyObject(nullptr)
         , m_numberProxyObject(nullptr)
         , m_booleanProxyObject(nullptr)
@@ -139,9 +142,11 @@ public:
         , m_map(nullptr)
         , m_mapPrototype(nullptr)
         , m_mapIteratorPrototype(nullptr)
+        , m_mapIteratorPrototypeNext(nullptr)
         , m_set(nullptr)
         , m_setPrototype(nullptr)
         , m_setIteratorPrototype(nullptr)
+        , m_setIteratorPrototypeNext(nullptr)
         , m_weakMap(nullptr)
         , m_weakMapPrototype(nullptr)
         , m_weakSet(nullptr)
@@ -330,6 +335,10 @@ public:
     {
         return m_stringIteratorPrototype;
     }
+    FunctionObject* stringIteratorPrototypeNext()
+    {
+        return m_stringIteratorPrototypeNext;
+    }
 
     FunctionObject* number()
     {
@@ -361,6 +370,10 @@ public:
     {
         return m_arrayIteratorPrototype;
     }
+    FunctionObject* arrayIteratorPrototypeNext()
+    {
+        return m_arrayIteratorPrototypeNext;
+    }
 
     FunctionObject* arrayPrototypeValues()
     {
@@ -573,6 +586,11 @@ public:
         return m_mapIteratorPrototype;
     }
 
+    FunctionObject* mapIteratorPrototypeNext()
+    {
+        return m_mapIteratorPrototypeNext;
+    }
+
     FunctionObject* set()
     {
         return m_set;
@@ -588,6 +606,11 @@ public:
         return m_setIteratorPrototype;
     }
 
+    FunctionObject* setIteratorPrototypeNext()
+    {
+        return m_setIteratorPrototypeNext;
+    }
+
     FunctionObject* weakMap()
     {
         return m_weakMap;
@@ -642,6 +665,12 @@ public:
         return m_throwerGetterSetterData;
     }
 
+    JSGetterSetter* errorStackGetterSetterData()
+    {
+        ASSERT(m_errorStackGetterSetterData);
+        return m_errorStackGetterSetterData;
+    }
+
     StringObject* stringProxyObject()
     {
         return m_stringProxyObject;
@@ -708,6 +737,8 @@ private:
     FunctionObject* m_string;
     Object* m_stringPrototype;
     Object* m_stringIteratorPrototype;
+    // The initial value of the next data property of %StringIteratorPrototype%
+    FunctionObject* m_stringIteratorPrototypeNext;
 
     FunctionObject* m_number;
     Object* m_numberPrototype;
@@ -718,6 +749,8 @@ private:
     FunctionObject* m_array;
     Object* m_arrayPrototype;
     Object* m_arrayIteratorPrototype;
+    // The initial value of the next data property of %ArrayIteratorPrototype%
+    FunctionObject* m_arrayIteratorPrototypeNext;
     // https://www.ecma-international.org/ecma-262/6.0/#sec-well-known-intrinsic-objects
     // Well-Known Intrinsic Objects : %ArrayProto_values%
     // The initial value of the values data property of %ArrayPrototype%
@@ -740,6 +773,7 @@ private:
 
     FunctionObject* m_throwTypeError;
     JSGetterSetter* m_throwerGetterSetterData;
+    JSGetterSetter* m_errorStackGetterSetterData;
 
     StringObject* m_stringProxyObject;
     NumberObject* m_numberProxyObject;
@@ -791,9 +825,11 @@ private:
     FunctionObject* m_map;
     Object* m_mapPrototype;
     Object* m_mapIteratorPrototype;
+    FunctionObject* m_mapIteratorPrototypeNext;
     FunctionObject* m_set;
     Object* m_setPrototype;
     Object* m_setIteratorPrototype;
+    FunctionObject* m_setIteratorPrototypeNext;
     FunctionObject* m_weakMap;
     Object* m_weakMapPrototype;
     FunctionObject* m_weakSet;
@@ -27,6 +27,7 @@
 #include "ToStringRecursionPreventer.h"
 #include "ErrorObject.h"
 #include "NativeFunctionObject.h"
+#include "util/TimSort.h"
 
 namespace Escargot {
 
@@ -130,6 +131,81 @@ static Object* arraySpeciesCreate(ExecutionState& state, Object* originalArray,
     return Object::construct(state, C, 1, argv);
 }
 
+// Returns O when its elements can be accessed through fast-mode storage, nullptr otherwise.
+// Callers have to ask again after anything that may run user code.
+// the fast paths below reach the fast-mode storage of ArrayObject through this friend class
+class ArrayObjectFastModeAccess {
+public:
+    static ALWAYS_INLINE bool isFastModeArray(ArrayObject* array)
+    {
+        return array->isFastModeArray();
+    }
+
+    static ALWAYS_INLINE uint32_t getArrayLength(ExecutionState& state, ArrayObject* array)
+    {
+        return array->getArrayLength(state);
+    }
+
+    static ALWAYS_INLINE bool setArrayLength(ExecutionState& state, ArrayObject* array, const uint64_t newLength)
+    {
+        return array->setArrayLength(state, newLength);
+    }
+
+    static ALWAYS_INLINE bool canUseFastModeAccess(ExecutionState& state, ArrayObject* array)
+    {
+        return array->canUseFastModeAccess(state);
+    }
+
+    static ALWAYS_INLINE SmallValue* fastModeData(ArrayObject* array)
+    {
+        return array->fastModeData();
+    }
+
+    // SmallValue keeps a double in a heap box, and a number stored into a slot that holds a box is written into that box.
+    // so two slots must never share a box: an element copied from another slot, or a value stored into a slot
+    // whose old content was moved elsewhere, goes through a new SmallValue
+    static ALWAYS_INLINE SmallValue unsharedElement(const Value& value)
+    {
+        return SmallValue(value);
+    }
+};
+
+static ALWAYS_INLINE ArrayObject* fastModeArray(ExecutionState& state, Object* O)
+{
+    if (LIKELY(O->isArrayObject())) {
+        ArrayObject* array = O->asArrayObject();
+        if (LIKELY(ArrayObjectFastModeAccess::canUseFastModeAccess(state, array))) {
+            return array;
+        }
+    }
+    return nullptr;
+}
+
+// Loops that call user code for every element read own elements while array is still in fast mode,
+// which is cheap enough to re-check each time. The full prototype chain check is needed only
+// to skip a hole; when it fails the generic path takes over from that index.
+static ALWAYS_INLINE bool readFastModeElement(ExecutionState& state, ArrayObject* array, int64_t k, int64_t len, Value& value)
+{
+    if (UNLIKELY(!array || k >= len || !ArrayObjectFastModeAccess::isFastModeArray(array) || k >= ArrayObjectFastModeAccess::getArrayLength(state, array))) {
+        return false;
+    }
+    value = ArrayObjectFastModeAccess::fastModeData(array)[k];
+    return !value.isEmpty() || ArrayObjectFastModeAccess::canUseFastModeAccess(state, array);
+}
+
+// CreateDataPropertyOrThrow(A, index, value) for an A made by arraySpeciesCreate
+static ALWAYS_INLINE void createArrayElement(ExecutionState& state, Object* A, int64_t index, const Value& value)
+{
+    if (LIKELY(A->isArrayObject())) {
+        ArrayObject* array = A->asArrayObject();
+        if (LIKELY(ArrayObjectFastModeAccess::isFastModeArray(array) && index < ArrayObjectFastModeAccess::getArrayLength(state, array))) {
+            ArrayObjectFastModeAccess::fastModeData(array)[index] = value;
+            return;
+        }
+    }
+    A->defineOwnPropertyThrowsException(state, ObjectPropertyName(state, Value(index)), ObjectPropertyDescriptor(value, ObjectPropertyDescriptor::AllPresent));
+}
+
 static Value builtinArrayIsArray(ExecutionState& state, Value thisValue, size_t argc, Value* argv, bool isNewExpression)
 {
     ASSERT(argv != nullptr);
@@ -195,16 +271,15 @@ static Value builtinArrayFrom(ExecutionState& state, Value thisValue, size_t arg
             // Let Pk be ! ToString(k).
             ObjectPropertyName pk(state, k);
             // Let next be ? IteratorStep(iterator).
-            Value next = iteratorStep(state, iterator);
             // If next is false, then
-            if (next.isFalse()) {
+            // Let nextValue be ? IteratorValue(next).
+            Value nextValue;
+            if (!iteratorStepValue(state, iterator, nextValue)) {
                 // Perform ? Set(A, "length", k, true).
                 A->setThrowsException(state, ObjectPropertyName(state, state.context()->staticStrings().length), Value(k), A);
                 // Return A.
                 return A;
             }
-            // Let nextValue be ? IteratorValue(next).
-            Value nextValue = iteratorValue(state, next);
             Value mappedValue;
             // If mapping is true, then
             if (mapping) {
@@ -325,6 +400,23 @@ static Value builtinArrayJoin(ExecutionState& state, Value thisValue, size_t arg
     StringBuilder builder;
     int64_t prevIndex = 0;
     int64_t curIndex = 0;
+
+    ArrayObject* array = thisBinded->isArrayObject() ? thisBinded->asArrayObject() : nullptr;
+    Value element;
+    while (readFastModeElement(state, array, curIndex, len, element)) {
+        if (curIndex != 0 && sep->length() > 0) {
+            if (builder.contentLength() > STRING_MAXIMUM_LENGTH - sep->length()) {
+                ErrorObject::throwBuiltinError(state, ErrorObject::RangeError, errorMessage_String_InvalidStringLength);
+            }
+            builder.appendString(sep);
+        }
+        if (!element.isEmpty() && !element.isUndefinedOrNull()) {
+            builder.appendString(element.isString() ? element.asString() : element.toString(state));
+        }
+        prevIndex = curIndex;
+        curIndex++;
+    }
+
     while (curIndex < len) {
         if (curIndex != 0 && sep->length() > 0) {
             if (static_cast<double>(builder.contentLength()) > static_cast<double>(STRING_MAXIMUM_LENGTH - (curIndex - prevIndex - 1) * (int64_t)sep->length())) {
@@ -398,6 +490,23 @@ static Value builtinArrayReverse(ExecutionState& state, Value thisValue, size_t
 {
     RESOLVE_THIS_BINDING_TO_OBJECT(O, Array, reverse);
     int64_t len = O->lengthES6(state);
+
+    if (ArrayObject* array = fastModeArray(state, O)) {
+        // swapping a hole with an element is the same delete-and-set the generic path does
+        SmallValue* data = ArrayObjectFastModeAccess::fastModeData(array);
+        bool hasHole = false;
+        for (int64_t lower = 0, upper = len - 1; lower < upper; lower++, upper--) {
+            SmallValue lowerValue = data[lower];
+            hasHole |= lowerValue.isEmpty() || data[upper].isEmpty();
+            data[lower] = data[upper];
+            data[upper] = lowerValue;
+        }
+        if (hasHole) {
+            array->ensureObjectRareData()->m_shouldUpdateEnumerateObjectData = true;
+        }
+        return O;
+    }
+
     int64_t middle = std::floor(len / 2);
     int64_t lower = 0;
     while (middle > lower) {
@@ -449,6 +558,137 @@ static Value builtinArrayReverse(ExecutionState& state, Value thisValue, size_t
     return O;
 }
 
+static bool isInt32ValuedNumber(const Value& v)
+{
+    if (v.isInt32()) {
+        return true;
+    }
+    if (!v.isDouble()) {
+        return false;
+    }
+    double d = v.asDouble();
+    return d >= INT32_MIN && d <= INT32_MAX && d == (int32_t)d && !(d == 0 && std::signbit(d));
+}
+
+static const uint64_t s_powersOf10[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000, 10000000000ULL };
+
+// Maps an int32 to an integer whose order matches the order of the decimal strings.
+// The magnitude is padded with zeros to 10 digits so that digits compare position by position,
+// the digit count breaks ties between prefixes ("1" < "10"), and negative values come first because '-' sorts before digits.
+static uint64_t int32StringOrderKey(int32_t value)
+{
+    uint64_t magnitude = value < 0 ? -(int64_t)value : value;
+    uint64_t digits = 1;
+    while (digits < 10 && magnitude >= s_powersOf10[digits]) {
+        digits++;
+    }
+    return ((uint64_t)(value >= 0) << 63) | ((magnitude * s_powersOf10[10 - digits]) << 4) | digits;
+}
+
+static int32_t int32FromStringOrderKey(uint64_t key)
+{
+    uint64_t digits = key & 0xf;
+    int64_t magnitude = ((key & ~(1ULL << 63)) >> 4) / s_powersOf10[10 - digits];
+    return (int32_t)((key >> 63) ? magnitude : -magnitude);
+}
+
+struct ArraySortEntry {
+    String* key;
+    Value value;
+};
+
+// Sorts a fast-mode array without going through Object::sort.
+// The present elements are copied out and undefined values are set aside because they always sort last.
+// A default sort of int32 values sorts integer keys that follow their string order, other default sorts convert each value
+// to a string once up front, and a user comparator is called directly on pairs of values.
+// Nothing is written back if the comparator throws.
+static void sortFastModeArray(ExecutionState& state, ArrayObject* array, int64_t length, const Value& cmpfn)
+{
+    ValueVector items;
+    items.resizeWithUninitializedValues(length);
+    size_t itemCount = 0;
+    size_t undefinedCount = 0;
+    // int32 values may also be held as doubles; -0 is left out because it cannot be told apart from 0 below
+    bool isAllInt32 = true;
+
+    SmallValue* data = ArrayObjectFastModeAccess::fastModeData(array);
+    for (int64_t i = 0; i < length; i++) {
+        Value v = data[i];
+        if (v.isEmpty()) {
+            continue;
+        }
+        if (v.isUndefined()) {
+            undefinedCount++;
+            continue;
+        }
+        isAllInt32 = isAllInt32 && isInt32ValuedNumber(v);
+        items[itemCount++] = v;
+    }
+
+    if (itemCount > 1) {
+        if (!cmpfn.isUndefined()) {
+            ValueVector scratch;
+            scratch.resizeWithUninitializedValues(itemCount / 2);
+            Value arguments[2];
+            timSort(items.data(), itemCount, scratch.data(), [&](const Value& a, const Value& b) -> bool {
+                arguments[0] = a;
+                arguments[1] = b;
+                Value result = Object::call(state, cmpfn, Value(), 2, arguments);
+                return result.isInt32() ? result.asInt32() < 0 : result.toNumber(state) < 0;
+            });
+        } else if (isAllInt32) {
+            // equal int32 values cannot be told apart, so an unstable sort is fine
+            std::vector<uint64_t> keys(itemCount);
+            for (size_t i = 0; i < itemCount; i++) {
+                keys[i] = int32StringOrderKey((int32_t)items[i].asNumber());
+            }
+            std::sort(keys.begin(), keys.end());
+            for (size_t i = 0; i < itemCount; i++) {
+                items[i] = Value(int32FromStringOrderKey(keys[i]));
+            }
+        } else {
+            std::vector<ArraySortEntry, GCUtil::gc_malloc_allocator<ArraySortEntry>> entries(itemCount);
+            for (size_t i = 0; i < itemCount; i++) {
+                entries[i].key = items[i].toString(state);
+                entries[i].value = items[i];
+            }
+            std::vector<ArraySortEntry, GCUtil::gc_malloc_allocator<ArraySortEntry>> scratch(itemCount / 2);
+            timSort(entries.data(), itemCount, scratch.data(), [](const ArraySortEntry& a, const ArraySortEntry& b) -> bool {
+                return *a.key < *b.key;
+            });
+            for (size_t i = 0; i < itemCount; i++) {
+                items[i] = entries[i].value;
+            }
+        }
+    }
+
+    // the comparator or a toString call may have changed the array
+    int64_t sortedCount = itemCount + undefinedCount;
+    if (ArrayObjectFastModeAccess::canUseFastModeAccess(state, array) && ArrayObjectFastModeAccess::getArrayLength(state, array) >= length) {
+        data = ArrayObjectFastModeAccess::fastModeData(array);
+        for (size_t i = 0; i < itemCount; i++) {
+            data[i] = items[i];
+        }
+        for (int64_t i = itemCount; i < sortedCount; i++) {
+            data[i] = Value();
+        }
+        if (sortedCount < length) {
+            for (int64_t i = sortedCount; i < length; i++) {
+                data[i] = Value(Value::EmptyValue);
+            }
+            array->ensureObjectRareData()->m_shouldUpdateEnumerateObjectData = true;
+        }
+        return;
+    }
+
+    for (int64_t i = 0; i < sortedCount; i++) {
+        array->setIndexedPropertyThrowsException(state, Value(i), (size_t)i < itemCount ? items[i] : Value());
+    }
+    for (int64_t i = sortedCount; i < length; i++) {
+        array->deleteOwnPropertyThrowsException(state, ObjectPropertyName(state, Value(i)));
+    }
+}
+
 static Value builtinArraySort(ExecutionState& state, Value thisValue, size_t argc, Value* argv, bool isNewExpression)
 {
     RESOLVE_THIS_BINDING_TO_OBJECT(thisObject, Array, sort);
@@ -460,6 +700,12 @@ static Value builtinArraySort(ExecutionState& state, Value thisValue, size_t arg
 
     int64_t len = thisObject->lengthES6(state);
 
+    ArrayObject* array = fastModeArray(state, thisObject);
+    if (array && len == ArrayObjectFastModeAccess::getArrayLength(state, array)) {
+        sortFastModeArray(state, array, len, cmpfn);
+        return thisObject;
+    }
+
     thisObject->sort(state, len, [defaultSort, &cmpfn, &state](const Value& a, const Value& b) -> bool {
         if (a.isEmpty() && b.isUndefined())
             return false;
@@ -529,6 +775,47 @@ static Value builtinArraySplice(ExecutionState& state, Value thisValue, size_t a
     // Let A be ArraySpeciesCreate(O, actualDeleteCount).
     Object* A = arraySpeciesCreate(state, O, actualDeleteCount);
 
+    Value* items = nullptr;
+    int64_t itemCount = 0;
+    if (argc > 2) {
+        items = argv + 2;
+        itemCount = argc - 2;
+    }
+
+    // Nothing below calls user code once both arrays are known to be in fast mode,
+    // so elements and holes can be moved in storage directly
+    ArrayObject* array = fastModeArray(state, O);
+    ArrayObject* arrayA = fastModeArray(state, A);
+    int64_t newLength = len - actualDeleteCount + itemCount;
+    if (array && arrayA && array != arrayA && len == ArrayObjectFastModeAccess::getArrayLength(state, array) && actualDeleteCount <= ArrayObjectFastModeAccess::getArrayLength(state, arrayA)
+        && (itemCount <= actualDeleteCount || newLength <= ESCARGOT_ARRAY_NON_FASTMODE_MIN_SIZE)) {
+        SmallValue* data = ArrayObjectFastModeAccess::fastModeData(array);
+        SmallValue* dataA = ArrayObjectFastModeAccess::fastModeData(arrayA);
+        for (int64_t k = 0; k < actualDeleteCount; k++) {
+            if (!data[actualStart + k].isEmpty()) {
+                dataA[k] = ArrayObjectFastModeAccess::unsharedElement(data[actualStart + k]);
+            }
+        }
+        ArrayObjectFastModeAccess::setArrayLength(state, arrayA, actualDeleteCount);
+
+        if (itemCount < actualDeleteCount) {
+            for (int64_t k = actualStart; k < len - actualDeleteCount; k++) {
+                data[k + itemCount] = data[k + actualDeleteCount];
+            }
+            ArrayObjectFastModeAccess::setArrayLength(state, array, newLength);
+        } else if (itemCount > actualDeleteCount) {
+            ArrayObjectFastModeAccess::setArrayLength(state, array, newLength);
+            data = ArrayObjectFastModeAccess::fastModeData(array);
+            for (int64_t k = len - actualDeleteCount; k > actualStart; k--) {
+                data[k + itemCount - 1] = data[k + actualDeleteCount - 1];
+            }
+        }
+        for (int64_t i = 0; i < itemCount; i++) {
+            data[actualStart + i] = ArrayObjectFastModeAccess::unsharedElement(items[i]);
+        }
+        return A;
+    }
+
     // Let k be 0.
     int64_t k = 0;
 
@@ -562,14 +849,6 @@ static Value builtinArraySplice(ExecutionState& state, Value thisValue, size_t a
     A->setThrowsException(state, ObjectPropertyName(state.context()->staticStrings().length), Value(actualDeleteCount), A);
 
     // Let items be an internal List whose elements are, in left to right order, the portion of the actual argument list starting with item1. The list will be empty if no such items are present.
-    Value* items = nullptr;
-    int64_t itemCount = 0;
-
-    if (argc > 2) {
-        items = argv + 2;
-        itemCount = argc - 2;
-    }
-
     // If itemCount < actualDeleteCount, then
     if (itemCount < actualDeleteCount) {
         // Let k be actualStart.
@@ -686,6 +965,20 @@ static Value builtinArrayConcat(ExecutionState& state, Value thisValue, size_t a
                 // If n + len > 2^53 - 1, throw a TypeError exception.
                 CHECK_ARRAY_LENGTH(n + len > Value::maximumLength());
 
+                ArrayObject* source = fastModeArray(state, arr);
+                ArrayObject* target = fastModeArray(state, obj);
+                if (source && target && source != target && n == ArrayObjectFastModeAccess::getArrayLength(state, target) && n + len <= ESCARGOT_ARRAY_NON_FASTMODE_MIN_SIZE) {
+                    ArrayObjectFastModeAccess::setArrayLength(state, target, n + len);
+                    SmallValue* from = ArrayObjectFastModeAccess::fastModeData(source);
+                    SmallValue* to = ArrayObjectFastModeAccess::fastModeData(target) + n;
+                    for (int64_t i = 0; i < len; i++) {
+                        if (!from[i].isEmpty()) {
+                            to[i] = ArrayObjectFastModeAccess::unsharedElement(from[i]);
+                        }
+                    }
+                    k = len;
+                }
+
                 // Repeat, while k < len
                 while (k < len) {
                     // Let exists be the result of calling the [[HasProperty]] internal method of E with P.
@@ -731,6 +1024,19 @@ static Value builtinArraySlice(ExecutionState& state, Value thisValue, size_t ar
     // Let count be max(final - k, 0).
     // Let A be ArraySpeciesCreate(O, count).
     Object* ArrayObject = arraySpeciesCreate(state, thisObject, std::max(((int64_t)finalEnd - (int64_t)k), (int64_t)0));
+
+    auto source = fastModeArray(state, thisObject);
+    auto target = fastModeArray(state, ArrayObject);
+    if (source && target && source != target && finalEnd <= ArrayObjectFastModeAccess::getArrayLength(state, source) && finalEnd - k <= ArrayObjectFastModeAccess::getArrayLength(state, target)) {
+        SmallValue* from = ArrayObjectFastModeAccess::fastModeData(source);
+        SmallValue* to = ArrayObjectFastModeAccess::fastModeData(target);
+        for (; k < finalEnd; k++, n++) {
+            if (!from[k].isEmpty()) {
+                to[n] = ArrayObjectFastModeAccess::unsharedElement(from[k]);
+            }
+        }
+    }
+
     while (k < finalEnd) {
         ObjectHasPropertyResult exists = thisObject->hasIndexedProperty(state, Value(k));
         if (exists) {
@@ -770,6 +1076,16 @@ static Value builtinArrayForEach(ExecutionState& state, Value thisValue, size_t
         T = argv[1];
 
     int64_t k = 0;
+    ArrayObject* array = thisObject->isArrayObject() ? thisObject->asArrayObject() : nullptr;
+    Value kValue;
+    while (readFastModeElement(state, array, k, len, kValue)) {
+        if (!kValue.isEmpty()) {
+            Value args[3] = { kValue, Value(k), thisObject };
+            Object::call(state, callbackfn, T, 3, args);
+        }
+        k++;
+    }
+
     while (k < len) {
         Value Pk = Value(k);
         auto res = thisObject->hasProperty(state, ObjectPropertyName(state, Pk));
@@ -831,6 +1147,19 @@ static Value builtinArrayIndexOf(ExecutionState& state, Value thisValue, size_t
     ASSERT(doubleK >= 0);
     int64_t k = doubleK;
 
+    // strict equality never calls user code, so the whole scan can stay in fast-mode storage
+    if (ArrayObject* array = fastModeArray(state, O)) {
+        SmallValue* data = ArrayObjectFastModeAccess::fastModeData(array);
+        int64_t end = std::min(len, (int64_t)ArrayObjectFastModeAccess::getArrayLength(state, array));
+        for (; k < end; k++) {
+            Value elementK = data[k];
+            if (!elementK.isEmpty() && elementK.equalsTo(state, argv[0])) {
+                return Value(k);
+            }
+        }
+        return Value(-1);
+    }
+
     // Repeat, while k<len
     while (k < len) {
         // Let kPresent be the result of calling the [[HasProperty]] internal method of O with argument ToString(k).
@@ -994,6 +1323,15 @@ static Value builtinArrayFill(ExecutionState& state, Value thisValue, size_t arg
     int64_t fin = (relativeEnd < 0) ? std::max(len + relativeEnd, 0.0) : std::min(relativeEnd, (double)len);
 
     Value value = argv[0];
+    ArrayObject* array = fastModeArray(state, O);
+    if (array && fin <= ArrayObjectFastModeAccess::getArrayLength(state, array)) {
+        SmallValue* data = ArrayObjectFastModeAccess::fastModeData(array);
+        for (; k < fin; k++) {
+            data[k] = ArrayObjectFastModeAccess::unsharedElement(value);
+        }
+        return O;
+    }
+
     while (k < fin) {
         O->setIndexedPropertyThrowsException(state, Value(k), value);
         k++;
@@ -1030,6 +1368,20 @@ static Value builtinArrayFilter(ExecutionState& state, Value thisValue, size_t a
     int64_t k = 0;
     // Let to be 0.
     int64_t to = 0;
+
+    ArrayObject* array = O->isArrayObject() ? O->asArrayObject() : nullptr;
+    Value kValue;
+    while (readFastModeElement(state, array, k, len, kValue)) {
+        if (!kValue.isEmpty()) {
+            Value v[] = { kValue, Value(k), O };
+            if (Object::call(state, callbackfn, T, 3, v).toBoolean(state)) {
+                createArrayElement(state, A, to, kValue);
+                to++;
+            }
+        }
+        k++;
+    }
+
     // Repeat, while k < len
     while (k < len) {
         // Let Pk be ToString(k).
@@ -1091,6 +1443,16 @@ static Value builtinArrayMap(ExecutionState& state, Value thisValue, size_t argc
     // Let k be 0.
     int64_t k = 0;
 
+    ArrayObject* array = O->isArrayObject() ? O->asArrayObject() : nullptr;
+    Value kValue;
+    while (readFastModeElement(state, array, k, len, kValue)) {
+        if (!kValue.isEmpty()) {
+            Value v[] = { kValue, Value(k), O };
+            createArrayElement(state, A, k, Object::call(state, callbackfn, T, 3, v));
+        }
+        k++;
+    }
+
     // Repeat, while k < len
     while (k < len) {
         // Let Pk be ToString(k).
@@ -1205,6 +1567,22 @@ static Value builtinArrayIncludes(ExecutionState& state, Value thisValue, size_t
     ASSERT(doubleK >= 0);
     int64_t k = doubleK;
 
+    if (ArrayObject* array = fastModeArray(state, O)) {
+        // holes and indexes past the current length both read undefined
+        SmallValue* data = ArrayObjectFastModeAccess::fastModeData(array);
+        int64_t end = std::min(len, (int64_t)ArrayObjectFastModeAccess::getArrayLength(state, array));
+        for (; k < end; k++) {
+            Value elementK = data[k];
+            if (elementK.isEmpty()) {
+                elementK = Value();
+            }
+            if (elementK.equalsToByTheSameValueZeroAlgorithm(state, searchElement)) {
+                return Value(true);
+            }
+        }
+        return Value(k < len && searchElement.isUndefined());
+    }
+
     // Repeat, while k < len
     while (k < len) {
         // Let elementK be the result of ? Get(O, ! ToString(k)).
@@ -1338,6 +1716,17 @@ static Value builtinArrayReduce(ExecutionState& state, Value thisValue, size_t a
         if (!kPresent)
             ErrorObject::throwBuiltinError(state, ErrorObject::TypeError, state.context()->staticStrings().Array.string(), true, state.context()->staticStrings().reduce.string(), errorMessage_GlobalObject_ReduceError);
     }
+
+    ArrayObject* array = O->isArrayObject() ? O->asArrayObject() : nullptr;
+    Value kValue;
+    while (readFastModeElement(state, array, k, len, kValue)) {
+        if (!kValue.isEmpty()) {
+            Value fnargs[] = { accumulator, kValue, Value(k), O };
+            accumulator = Object::call(state, callbackfn, Value(), 4, fnargs);
+        }
+        k++;
+    }
+
     while (k < len) { // 9
         ObjectHasPropertyResult kPresent = O->hasIndexedProperty(state, Value(k)); // 9.b
         if (kPresent) { // 9.c
@@ -1447,6 +1836,13 @@ static Value builtinArrayPop(ExecutionState& state, Value thisValue, size_t argc
     // Let len be ToUint32(lenVal).
     int64_t len = O->lengthES6(state);
 
+    ArrayObject* array = fastModeArray(state, O);
+    if (array && len > 0) {
+        Value element = ArrayObjectFastModeAccess::fastModeData(array)[len - 1];
+        ArrayObjectFastModeAccess::setArrayLength(state, array, len - 1);
+        return element.isEmpty() ? Value() : element;
+    }
+
     // If len is zero,
     if (len == 0) {
         // Call the [[Put]] internal method of O with arguments "length", 0, and true.
@@ -1481,6 +1877,17 @@ static Value builtinArrayPush(ExecutionState& state, Value thisValue, size_t arg
     // If len + argCount > 2^53 - 1, throw a TypeError exception.
     CHECK_ARRAY_LENGTH((uint64_t)n + argc > Value::maximumLength());
 
+    // growing one slot at a time never leaves fast mode
+    ArrayObject* array = fastModeArray(state, O);
+    if (array && (uint64_t)n + argc < Value::InvalidArrayIndexValue) {
+        for (size_t i = 0; i < argc; i++) {
+            ArrayObjectFastModeAccess::setArrayLength(state, array, n + 1);
+            ArrayObjectFastModeAccess::fastModeData(array)[n] = argv[i];
+            n++;
+        }
+        return Value(n);
+    }
+
     // Let items be an internal List whose elements are, in left to right order, the arguments that were passed to this function invocation.
     // Repeat, while items is not empty
     // Remove the first element from items and let E be the value of the element.
@@ -1512,6 +1919,17 @@ static Value builtinArrayShift(ExecutionState& state, Value thisValue, size_t ar
         // Return undefined.
         return Value();
     }
+
+    if (ArrayObject* array = fastModeArray(state, O)) {
+        SmallValue* data = ArrayObjectFastModeAccess::fastModeData(array);
+        Value first = data[0];
+        for (int64_t k = 1; k < len; k++) {
+            data[k - 1] = data[k];
+        }
+        ArrayObjectFastModeAccess::setArrayLength(state, array, len - 1);
+        return first.isEmpty() ? Value() : first;
+    }
+
     // Let first be the result of calling the [[Get]] internal method of O with argument "0".
     Value first = O->get(state, ObjectPropertyName(state, Value(0))).value(state, O);
     // Let k be 1.
@@ -1580,6 +1998,19 @@ static Value builtinArrayUnshift(ExecutionState& state, Value thisValue, size_t
         // If len + argCount > 2^53 - 1, throw a TypeError exception.
         CHECK_ARRAY_LENGTH(len + argCount > Value::maximumLength());
 
+        ArrayObject* array = fastModeArray(state, O);
+        if (array && len + argCount <= ESCARGOT_ARRAY_NON_FASTMODE_MIN_SIZE) {
+            ArrayObjectFastModeAccess::setArrayLength(state, array, len + argCount);
+            SmallValue* data = ArrayObjectFastModeAccess::fastModeData(array);
+            for (int64_t k = len; k > 0; k--) {
+                data[k + argCount - 1] = data[k - 1];
+            }
+            for (int64_t j = 0; j < argCount; j++) {
+                data[j] = ArrayObjectFastModeAccess::unsharedElement(argv[j]);
+            }
+            return Value(len + argCount);
+        }
+
         // Repeat, while k > 0,
         while (k > 0) {
             // Let from be ToString(k–1).
@@ -1931,8 +2362,9 @@ void GlobalObject::installArray(ExecutionState& state)
     m_arrayIteratorPrototype = m_iteratorPrototype;
     m_arrayIteratorPrototype = new ArrayIteratorPrototypeObject(state, nullptr, ArrayIteratorObject::TypeKey);
 
+    m_arrayIteratorPrototypeNext = new NativeFunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().next, builtinArrayIteratorNext, 0, NativeFunctionInfo::Strict));
     m_arrayIteratorPrototype->defineOwnPropertyThrowsException(state, ObjectPropertyName(state.context()->staticStrings().next),
-                                                               ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().next, builtinArrayIteratorNext, 0, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+                                                               ObjectPropertyDescriptor(m_arrayIteratorPrototypeNext, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
     m_arrayIteratorPrototype->defineOwnPropertyThrowsException(state, ObjectPropertyName(state, Value(state.context()->vmInstance()->globalSymbols().toStringTag)),
                                                                ObjectPropertyDescriptor(Value(String::fromASCII("Array Iterator")), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::ConfigurablePresent)));
 
@@ -65,6 +65,23 @@ static Value builtinErrorThrowTypeError(ExecutionState& state, Value thisValue,
     return Value();
 }
 
+static Value builtinErrorObjectStackInfo(ExecutionState& state, Value thisValue, size_t argc, Value* argv, bool isNewExpression)
+{
+    if (!(LIKELY(thisValue.isPointerValue() && thisValue.asPointerValue()->isErrorObject()))) {
+        ErrorObject::throwBuiltinError(state, ErrorObject::TypeError, "get Error.prototype.stack called on incompatible receiver");
+    }
+
+    ErrorObject* obj = thisValue.asObject()->asErrorObject();
+    if (obj->stackTraceData() == nullptr) {
+        return String::emptyString;
+    }
+
+    auto stackTraceData = obj->stackTraceData();
+    StringBuilder builder;
+    stackTraceData->buildStackTrace(state.context(), builder);
+    return builder.finalize();
+}
+
 static Value builtinErrorToString(ExecutionState& state, Value thisValue, size_t argc, Value* argv, bool isNewExpression)
 {
     if (!thisValue.isObject())
@@ -144,6 +161,10 @@ void GlobalObject::installError(ExecutionState& state)
     m_throwTypeError = new NativeFunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().ThrowTypeError, builtinErrorThrowTypeError, 0, NativeFunctionInfo::Strict));
     m_throwerGetterSetterData = new JSGetterSetter(m_throwTypeError, m_throwTypeError);
 
+    // getter of the own `stack` property that SandBox defines on caught error objects.
+    // the trace is formatted only when it is called
+    m_errorStackGetterSetterData = new JSGetterSetter(new NativeFunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().stack, builtinErrorObjectStackInfo, 0, NativeFunctionInfo::Strict)), Value(Value::EmptyValue));
+
 #define DEFINE_ERROR(errorname, bname)                                                                                                                                                                                                                                                                                                  \
     m_##errorname##Error = new NativeFunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().bname##Error, builtin##bname##ErrorConstructor, 1), NativeFunctionObject::__ForBuiltinConstructor__);                                                                                                                    \
     m_##errorname##Error->setPrototype(state, m_error);                                                                                                                                                                                                                                                                                 \
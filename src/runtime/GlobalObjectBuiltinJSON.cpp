@@ -27,144 +27,439 @@
 #include "BooleanObject.h"
 #include "NativeFunctionObject.h"
 
-#define RAPIDJSON_PARSE_DEFAULT_FLAGS kParseFullPrecisionFlag
-#define RAPIDJSON_ERROR_CHARTYPE char
-#include <rapidjson/document.h>
-#include <rapidjson/filereadstream.h>
-#include <rapidjson/memorystream.h>
-#include <rapidjson/internal/dtoa.h>
-#include <rapidjson/stringbuffer.h>
-#include <rapidjson/writer.h>
-#include <rapidjson/error/en.h>
+// These two must be the last because they overwrite the ASSERT macro.
+#include "double-conversion.h"
+#include "ieee.h"
 
 namespace Escargot {
 
-template <typename Encoding>
-struct JSONStringStream {
-    typedef typename Encoding::Ch Ch;
+// Builds the result of JSON.parse directly from the source text in one pass.
+// Values of arrays and objects under construction are kept on a GC-visible stack,
+// so every array and object is allocated once with its final size.
+// Objects are pre-shaped: the ObjectStructure is found by following the transitions for its key sequence,
+// which records with the same keys share, and then filled with all values at once.
+template <typename CharType>
+class JSONParser {
+public:
+    JSONParser(ExecutionState& state, String* source, const CharType* data, size_t length)
+        : m_state(state)
+        , m_source(source)
+        , m_start(data)
+        , m_cursor(data)
+        , m_end(data + length)
+    {
+    }
 
-    JSONStringStream(const Ch* src, size_t length)
-        : src_(src)
-        , head_(src)
-        , tail_(src + length)
+    Value parse()
     {
+        skipWhitespace();
+        if (UNLIKELY(m_cursor == m_end)) {
+            throwError("The document is empty.");
+        }
+        Value result = parseValue();
+        skipWhitespace();
+        if (UNLIKELY(m_cursor != m_end)) {
+            throwError("The document root must not be followed by other values.");
+        }
+        return result;
     }
 
-    Ch Peek() const
+private:
+    void throwError(const char* message)
     {
-        if (UNLIKELY(tail_ <= src_)) {
-            return 0;
+        auto strings = &m_state.context()->staticStrings();
+        ErrorObject::throwBuiltinError(m_state, ErrorObject::SyntaxError, strings->JSON.string(), true, strings->parse.string(), message);
+    }
+
+    void checkStackLimit()
+    {
+        volatile int sp;
+        size_t currentStackBase = (size_t)&sp;
+#ifdef STACK_GROWS_DOWN
+        if (UNLIKELY((m_state.stackBase() - currentStackBase) > STACK_LIMIT_FROM_BASE)) {
+#else
+        if (UNLIKELY((currentStackBase - m_state.stackBase()) > STACK_LIMIT_FROM_BASE)) {
+#endif
+            ErrorObject::throwBuiltinError(m_state, ErrorObject::RangeError, "Maximum call stack size exceeded");
         }
-        return *src_;
     }
-    Ch Take()
+
+    ALWAYS_INLINE void skipWhitespace()
     {
-        if (UNLIKELY(tail_ <= src_)) {
-            return 0;
+        while (m_cursor != m_end && (*m_cursor == ' ' || *m_cursor == '\n' || *m_cursor == '\r' || *m_cursor == '\t')) {
+            m_cursor++;
         }
-        return *src_++;
     }
-    size_t Tell() const { return static_cast<size_t>(src_ - head_); }
-    Ch* PutBegin()
+
+    ALWAYS_INLINE bool consume(char c)
     {
-        RAPIDJSON_ASSERT(false);
-        return 0;
+        if (m_cursor != m_end && *m_cursor == c) {
+            m_cursor++;
+            return true;
+        }
+        return false;
     }
-    void Put(Ch) { RAPIDJSON_ASSERT(false); }
-    void Flush() { RAPIDJSON_ASSERT(false); }
-    size_t PutEnd(Ch*)
+
+    bool consumeLiteral(const char* literal, size_t length)
     {
-        RAPIDJSON_ASSERT(false);
-        return 0;
+        if ((size_t)(m_end - m_cursor) < length) {
+            return false;
+        }
+        for (size_t i = 0; i < length; i++) {
+            if (m_cursor[i] != (CharType)literal[i]) {
+                return false;
+            }
+        }
+        m_cursor += length;
+        return true;
     }
 
-    const Ch* src_; //!< Current read position.
-    const Ch* head_; //!< Original head of the string.
-    const Ch* tail_;
-};
+    Value parseValue()
+    {
+        if (UNLIKELY(m_cursor == m_end)) {
+            throwError("Invalid value.");
+        }
 
-template <typename CharType, typename JSONCharType>
-static Value parseJSONWorker(ExecutionState& state, rapidjson::GenericValue<JSONCharType>& value)
-{
-    volatile int sp;
-    size_t currentStackBase = (size_t)&sp;
-#ifdef STACK_GROWS_DOWN
-    if (UNLIKELY((state.stackBase() - currentStackBase) > STACK_LIMIT_FROM_BASE)) {
-#else
-    if (UNLIKELY((currentStackBase - state.stackBase()) > STACK_LIMIT_FROM_BASE)) {
-#endif
-        ErrorObject::throwBuiltinError(state, ErrorObject::RangeError, "Maximum call stack size exceeded");
-    }
-
-    if (value.IsBool()) {
-        return Value(value.GetBool());
-    } else if (value.IsInt()) {
-        return Value(value.GetInt());
-    } else if (value.IsUint()) {
-        return Value(value.GetUint());
-    } else if (value.IsInt64()) {
-        return Value(value.GetInt64());
-    } else if (value.IsUint64()) {
-        return Value(value.GetUint64());
-    } else if (value.IsDouble()) {
-        return Value(value.GetDouble());
-    } else if (value.IsNull()) {
-        return Value(Value::Null);
-    } else if (value.IsString()) {
-        if (std::is_same<CharType, char16_t>::value) {
-            const char16_t* chars = (const char16_t*)value.GetString();
-            unsigned len = value.GetStringLength();
-            if (isAllLatin1(chars, len)) {
-                return new Latin1String(chars, len);
-            } else {
-                return new UTF16String(chars, len);
+        switch (*m_cursor) {
+        case '{':
+            m_cursor++;
+            return parseObject();
+        case '[':
+            m_cursor++;
+            return parseArray();
+        case '"':
+            m_cursor++;
+            return parseString();
+        case 't':
+            if (consumeLiteral("true", 4)) {
+                return Value(true);
             }
-        } else {
-            const char* valueAsString = (const char*)value.GetString();
-            if (isAllASCII(valueAsString, strlen(valueAsString))) {
-                return new ASCIIString(valueAsString);
-            } else {
-                return new UTF16String(utf8StringToUTF16String(valueAsString, strlen(valueAsString)));
+            break;
+        case 'f':
+            if (consumeLiteral("false", 5)) {
+                return Value(false);
+            }
+            break;
+        case 'n':
+            if (consumeLiteral("null", 4)) {
+                return Value(Value::Null);
             }
+            break;
+        default:
+            if (*m_cursor == '-' || (*m_cursor >= '0' && *m_cursor <= '9')) {
+                return parseNumber();
+            }
+            break;
         }
-    } else if (value.IsArray()) {
-        ArrayObject* arr = new ArrayObject(state);
-        size_t i = 0;
-        auto iter = value.Begin();
-        while (iter != value.End()) {
-            arr->defineOwnProperty(state, ObjectPropertyName(state, Value(i++)), ObjectPropertyDescriptor(parseJSONWorker<CharType, JSONCharType>(state, *iter), ObjectPropertyDescriptor::AllPresent));
-            iter++;
-        }
-        return arr;
-    } else if (value.IsObject()) {
-        Object* obj = new Object(state);
-        auto iter = value.MemberBegin();
-        while (iter != value.MemberEnd()) {
-            Value propertyName = parseJSONWorker<CharType, JSONCharType>(state, iter->name);
-            ASSERT(propertyName.isString());
-            obj->defineOwnProperty(state, ObjectPropertyName(state, propertyName), ObjectPropertyDescriptor(parseJSONWorker<CharType, JSONCharType>(state, iter->value), ObjectPropertyDescriptor::AllPresent));
-            iter++;
-        }
-        return obj;
-    } else {
+        throwError("Invalid value.");
         RELEASE_ASSERT_NOT_REACHED();
     }
-}
 
-template <typename CharType, typename JSONCharType>
-Value parseJSON(ExecutionState& state, const CharType* data, size_t length)
-{
-    auto strings = &state.context()->staticStrings();
-    rapidjson::GenericDocument<JSONCharType> jsonDocument;
+    Value parseArray()
+    {
+        checkStackLimit();
 
-    JSONStringStream<JSONCharType> stringStream(data, length);
-    jsonDocument.ParseStream(stringStream);
-    if (jsonDocument.HasParseError()) {
-        ErrorObject::throwBuiltinError(state, ErrorObject::SyntaxError, strings->JSON.string(), true, strings->parse.string(), rapidjson::GetParseError_En(jsonDocument.GetParseError()));
+        size_t base = m_values.size();
+        skipWhitespace();
+        if (!consume(']')) {
+            while (true) {
+                m_values.pushBack(parseValue());
+                skipWhitespace();
+                if (consume(']')) {
+                    break;
+                }
+                if (UNLIKELY(!consume(','))) {
+                    throwError("Missing a comma or ']' after an array element.");
+                }
+                skipWhitespace();
+            }
+        }
+
+        ArrayObject* array = new ArrayObject(m_state, m_values.data() + base, m_values.size() - base);
+        m_values.resizeWithUninitializedValues(base);
+        return array;
     }
 
-    return parseJSONWorker<CharType, JSONCharType>(state, jsonDocument);
-}
+    Value parseObject()
+    {
+        checkStackLimit();
+
+        size_t base = m_values.size();
+        size_t keyBase = m_keys.size();
+        skipWhitespace();
+        if (!consume('}')) {
+            while (true) {
+                if (UNLIKELY(!consume('"'))) {
+                    throwError("Missing a name for object member.");
+                }
+                m_keys.pushBack(parseKey());
+                skipWhitespace();
+                if (UNLIKELY(!consume(':'))) {
+                    throwError("Missing a colon after a name of object member.");
+                }
+                skipWhitespace();
+                m_values.pushBack(parseValue());
+                skipWhitespace();
+                if (consume('}')) {
+                    break;
+                }
+                if (UNLIKELY(!consume(','))) {
+                    throwError("Missing a comma or '}' after an object member.");
+                }
+                skipWhitespace();
+            }
+        }
+
+        Object* object = createObject(keyBase, base, m_values.size() - base);
+        m_keys.resizeWithUninitializedValues(keyBase);
+        m_values.resizeWithUninitializedValues(base);
+        return object;
+    }
+
+    Object* createObject(size_t keyBase, size_t base, size_t count)
+    {
+        ObjectStructure* structure = m_state.context()->defaultStructureForObject();
+        for (size_t i = 0; i < count; i++) {
+            const PropertyName& name = m_keys[keyBase + i];
+            if (UNLIKELY(structure->findProperty(name) != SIZE_MAX)) {
+                // a duplicated key overwrites the earlier value in place
+                Object* object = new Object(m_state);
+                for (size_t j = 0; j < count; j++) {
+                    object->defineOwnProperty(m_state, ObjectPropertyName(m_state, m_keys[keyBase + j]), ObjectPropertyDescriptor(m_values[base + j], ObjectPropertyDescriptor::AllPresent));
+                }
+                return object;
+            }
+            structure = structure->addProperty(m_state, name, ObjectStructurePropertyDescriptor::createDataDescriptor(ObjectStructurePropertyDescriptor::AllPresent));
+        }
+        return new Object(m_state, structure, m_values.data() + base);
+    }
+
+    // returns the end of the string body starting at m_cursor without escapes,
+    // stopping at the closing quotation mark, a backslash or an invalid character
+    ALWAYS_INLINE const CharType* scanPlainCharacters()
+    {
+        return m_cursor + StringConversion::jsonPlainPrefixLength(m_cursor, m_end - m_cursor);
+    }
+
+    String* createString(const LChar* chars, size_t length)
+    {
+        if (isAllASCII((const char*)chars, length)) {
+            return new ASCIIString((const char*)chars, length);
+        }
+        return new Latin1String(chars, length);
+    }
+
+    String* createString(const char16_t* chars, size_t length)
+    {
+        if (isAllASCII(chars, length)) {
+            return new ASCIIString(chars, length);
+        } else if (isAllLatin1(chars, length)) {
+            return new Latin1String(chars, length);
+        }
+        return new UTF16String(chars, length);
+    }
+
+    String* parseString()
+    {
+        const CharType* begin = m_cursor;
+        const CharType* p = scanPlainCharacters();
+        if (LIKELY(p != m_end && *p == '"')) {
+            m_cursor = p + 1;
+            if (p == begin) {
+                return String::emptyString;
+            }
+            return createString(begin, p - begin);
+        }
+
+        m_buffer.assign(begin, p);
+        m_cursor = p;
+        parseEscapedRest();
+        return createString(m_buffer.data(), m_buffer.length());
+    }
+
+    // the body of a string was copied into m_buffer up to m_cursor; decodes the rest of it
+    void parseEscapedRest()
+    {
+        while (true) {
+            const CharType* p = scanPlainCharacters();
+            m_buffer.append(m_cursor, p);
+            m_cursor = p;
+            if (UNLIKELY(m_cursor == m_end)) {
+                throwError("Missing a closing quotation mark in string.");
+            }
+            CharType c = *m_cursor++;
+            if (c == '"') {
+                return;
+            } else if (c != '\\') {
+                throwError("Invalid encoding in string.");
+            }
+            if (UNLIKELY(m_cursor == m_end)) {
+                throwError("Missing a closing quotation mark in string.");
+            }
+            switch (*m_cursor++) {
+            case '"':
+                m_buffer.push_back('"');
+                break;
+            case '\\':
+                m_buffer.push_back('\\');
+                break;
+            case '/':
+                m_buffer.push_back('/');
+                break;
+            case 'b':
+                m_buffer.push_back('\b');
+                break;
+            case 'f':
+                m_buffer.push_back('\f');
+                break;
+            case 'n':
+                m_buffer.push_back('\n');
+                break;
+            case 'r':
+                m_buffer.push_back('\r');
+                break;
+            case 't':
+                m_buffer.push_back('\t');
+                break;
+            case 'u': {
+                // lone surrogates are valid code units in ECMAScript strings
+                char16_t unit = 0;
+                for (size_t i = 0; i < 4; i++) {
+                    int digit = m_cursor == m_end ? -1 : hexValue(*m_cursor++);
+                    if (UNLIKELY(digit < 0)) {
+                        throwError("Incorrect hex digit after \\u escape in string.");
+                    }
+                    unit = (unit << 4) | digit;
+                }
+                m_buffer.push_back(unit);
+                break;
+            }
+            default:
+                throwError("Invalid escape character in string.");
+            }
+        }
+    }
+
+    static int hexValue(CharType c)
+    {
+        if (c >= '0' && c <= '9') {
+            return c - '0';
+        } else if (c >= 'a' && c <= 'f') {
+            return c - 'a' + 10;
+        } else if (c >= 'A' && c <= 'F') {
+            return c - 'A' + 10;
+        }
+        return -1;
+    }
+
+    PropertyName parseKey()
+    {
+        const CharType* begin = m_cursor;
+        const CharType* p = scanPlainCharacters();
+        if (UNLIKELY(p == m_end || *p != '"')) {
+            m_buffer.assign(begin, p);
+            m_cursor = p;
+            parseEscapedRest();
+            return PropertyName(m_state, Value(createString(m_buffer.data(), m_buffer.length())));
+        }
+        m_cursor = p + 1;
+
+        size_t length = p - begin;
+        if (length == 0) {
+            return PropertyName(AtomicString());
+        }
+        // same rules as PropertyName(ExecutionState&, const Value&)
+        char16_t c = *begin;
+        if (UNLIKELY((c == '.' || (c >= '0' && c <= '9')) && length > 16)) {
+            return PropertyName(m_state, Value(createString(begin, length)));
+        }
+        if (length == 1 && c < ESCARGOT_ASCII_TABLE_MAX) {
+            return PropertyName(m_state.context()->staticStrings().asciiTable[c]);
+        }
+        // look the key up in the atomic string table without allocating a string for it
+        StringView key(m_source, begin - m_start, p - m_start);
+        return PropertyName(AtomicString(m_state.context(), key));
+    }
+
+    Value parseNumber()
+    {
+        const CharType* begin = m_cursor;
+        bool negative = consume('-');
+
+        const CharType* digitsBegin = m_cursor;
+        if (!consume('0')) {
+            if (UNLIKELY(m_cursor == m_end || *m_cursor < '1' || *m_cursor > '9')) {
+                throwError("Invalid value.");
+            }
+            while (m_cursor != m_end && *m_cursor >= '0' && *m_cursor <= '9') {
+                m_cursor++;
+            }
+        }
+        size_t integerDigits = m_cursor - digitsBegin;
+
+        bool isInteger = true;
+        if (consume('.')) {
+            isInteger = false;
+            if (UNLIKELY(m_cursor == m_end || *m_cursor < '0' || *m_cursor > '9')) {
+                throwError("Missing fraction part in number.");
+            }
+            while (m_cursor != m_end && *m_cursor >= '0' && *m_cursor <= '9') {
+                m_cursor++;
+            }
+        }
+        if (m_cursor != m_end && (*m_cursor == 'e' || *m_cursor == 'E')) {
+            isInteger = false;
+            m_cursor++;
+            if (!consume('+')) {
+                consume('-');
+            }
+            if (UNLIKELY(m_cursor == m_end || *m_cursor < '0' || *m_cursor > '9')) {
+                throwError("Missing exponent in number.");
+            }
+            while (m_cursor != m_end && *m_cursor >= '0' && *m_cursor <= '9') {
+                m_cursor++;
+            }
+        }
+
+        // integers of up to 15 digits are exact in a double
+        if (isInteger && integerDigits <= 15) {
+            int64_t value = 0;
+            for (const CharType* p = digitsBegin; p != m_cursor; p++) {
+                value = value * 10 + (*p - '0');
+            }
+            if (negative) {
+                return Value(value ? (double)-value : -0.0);
+            }
+            return Value((double)value);
+        }
+
+        int processed;
+        double_conversion::StringToDoubleConverter converter(double_conversion::StringToDoubleConverter::NO_FLAGS, 0.0, double_conversion::Double::NaN(), "Infinity", "NaN");
+        double value = toDouble(converter, begin, m_cursor - begin, &processed);
+        ASSERT((size_t)processed == (size_t)(m_cursor - begin));
+        return Value(value);
+    }
+
+    static double toDouble(double_conversion::StringToDoubleConverter& converter, const LChar* chars, size_t length, int* processed)
+    {
+        return converter.StringToDouble((const char*)chars, length, processed);
+    }
+
+    static double toDouble(double_conversion::StringToDoubleConverter& converter, const char16_t* chars, size_t length, int* processed)
+    {
+        return converter.StringToDouble((const uint16_t*)chars, length, processed);
+    }
+
+    ExecutionState& m_state;
+    String* m_source;
+    const CharType* m_start;
+    const CharType* m_cursor;
+    const CharType* m_end;
+    ValueVector m_values;
+    Vector<PropertyName, GCUtil::gc_malloc_allocator<PropertyName>> m_keys;
+    // decoded body of the current string when it has escapes
+    UTF16StringDataNonGCStd m_buffer;
+};
 
 String* codePointTo4digitString(int codepoint)
 {
@@ -197,17 +492,11 @@ static Value builtinJSONParse(ExecutionState& state, Value thisValue, size_t arg
     String* JText = argv[0].toString(state);
     Value unfiltered;
 
-    if (JText->has8BitContent()) {
-        size_t len = JText->length();
-        char16_t* char16Buf = new char16_t[len];
-        std::unique_ptr<char16_t[]> buf(char16Buf);
-        const LChar* srcBuf = JText->characters8();
-        for (size_t i = 0; i < len; i++) {
-            char16Buf[i] = srcBuf[i];
-        }
-        unfiltered = parseJSON<char16_t, rapidjson::UTF16<char16_t>>(state, buf.get(), JText->length());
+    const auto& data = JText->bufferAccessData();
+    if (data.has8BitContent) {
+        unfiltered = JSONParser<LChar>(state, JText, (const LChar*)data.buffer, data.length).parse();
     } else {
-        unfiltered = parseJSON<char16_t, rapidjson::UTF16<char16_t>>(state, JText->characters16(), JText->length());
+        unfiltered = JSONParser<char16_t>(state, JText, (const char16_t*)data.buffer, data.length).parse();
     }
 
     // 4
@@ -309,6 +598,422 @@ static void builtinJSONArrayReplacerHelper(ExecutionState& state, ObjectProperty
     propertyList.push_back(ObjectPropertyName(state, Value(item)));
 }
 
+// Growable output buffer for JSONStringifier.
+// It stays 8-bit until a code unit above 0xFF is appended.
+class JSONStringBuffer {
+public:
+    JSONStringBuffer()
+        : m_is8Bit(true)
+    {
+    }
+
+    void appendChar(char c)
+    {
+        if (m_is8Bit) {
+            m_latin1.push_back(c);
+        } else {
+            m_utf16.push_back(c);
+        }
+    }
+
+    void appendASCII(const char* s, size_t length)
+    {
+        append((const LChar*)s, length);
+    }
+
+    void append(const LChar* s, size_t length)
+    {
+        if (m_is8Bit) {
+            m_latin1.append(s, length);
+        } else {
+            size_t oldLength = m_utf16.length();
+            m_utf16.resize(oldLength + length);
+            StringConversion::widen(s, &m_utf16[oldLength], length);
+        }
+    }
+
+    void append(const char16_t* s, size_t length)
+    {
+        if (m_is8Bit) {
+            if (StringConversion::latin1PrefixLength(s, length) == length) {
+                size_t oldLength = m_latin1.length();
+                m_latin1.resize(oldLength + length);
+                StringConversion::narrow(s, &m_latin1[oldLength], length);
+                return;
+            }
+            convertInto16Bit();
+        }
+        m_utf16.append(s, length);
+    }
+
+    void append(String* str)
+    {
+        const auto& data = str->bufferAccessData();
+        if (data.has8BitContent) {
+            append((const LChar*)data.buffer, data.length);
+        } else {
+            append((const char16_t*)data.buffer, data.length);
+        }
+    }
+
+    // https://www.ecma-international.org/ecma-262/6.0/#sec-quotejsonstring
+    void appendQuoted(String* str)
+    {
+        const auto& data = str->bufferAccessData();
+        appendChar('"');
+        if (data.has8BitContent) {
+            appendQuotedCharacters((const LChar*)data.buffer, data.length);
+        } else {
+            appendQuotedCharacters((const char16_t*)data.buffer, data.length);
+        }
+        appendChar('"');
+    }
+
+    size_t length() const
+    {
+        return m_is8Bit ? m_latin1.length() : m_utf16.length();
+    }
+
+    void truncate(size_t length)
+    {
+        if (m_is8Bit) {
+            m_latin1.resize(length);
+        } else {
+            m_utf16.resize(length);
+        }
+    }
+
+    String* finalize(ExecutionState& state)
+    {
+        if (UNLIKELY(length() > STRING_MAXIMUM_LENGTH)) {
+            ErrorObject::throwBuiltinError(state, ErrorObject::RangeError, errorMessage_String_InvalidStringLength);
+        }
+        if (m_is8Bit) {
+            return new Latin1String(m_latin1.data(), m_latin1.length());
+        }
+        return new UTF16String(m_utf16.data(), m_utf16.length());
+    }
+
+private:
+    void convertInto16Bit()
+    {
+        ASSERT(m_is8Bit);
+        m_utf16.resize(m_latin1.length());
+        StringConversion::widen(m_latin1.data(), &m_utf16[0], m_latin1.length());
+        m_latin1.clear();
+        m_latin1.shrink_to_fit();
+        m_is8Bit = false;
+    }
+
+    template <typename CharType>
+    void appendQuotedCharacters(const CharType* chars, size_t length)
+    {
+        size_t i = 0;
+        while (true) {
+            size_t plainLength = StringConversion::jsonPlainPrefixLength(chars + i, length - i);
+            append(chars + i, plainLength);
+            i += plainLength;
+            if (i == length) {
+                break;
+            }
+            appendEscaped(chars[i++]);
+        }
+    }
+
+    void appendEscaped(char16_t c)
+    {
+        switch (c) {
+        case '"':
+            appendASCII("\\\"", 2);
+            break;
+        case '\\':
+            appendASCII("\\\\", 2);
+            break;
+        case '\b':
+            appendASCII("\\b", 2);
+            break;
+        case '\f':
+            appendASCII("\\f", 2);
+            break;
+        case '\n':
+            appendASCII("\\n", 2);
+            break;
+        case '\r':
+            appendASCII("\\r", 2);
+            break;
+        case '\t':
+            appendASCII("\\t", 2);
+            break;
+        default: {
+            ASSERT(c < 0x20);
+            const char* hexDigits = "0123456789abcdef";
+            char escaped[6] = { '\\', 'u', '0', '0', hexDigits[c >> 4], hexDigits[c & 0xF] };
+            appendASCII(escaped, 6);
+            break;
+        }
+        }
+    }
+
+    bool m_is8Bit;
+    Latin1StringDataNonGCStd m_latin1;
+    UTF16StringDataNonGCStd m_utf16;
+};
+
+// Serializes plain data objects and fast-mode arrays without going through the generic SerializeJSONProperty steps.
+// It never calls back into JavaScript, so when it meets anything whose output could depend on user code
+// (a toJSON method, an accessor, a proxy, a wrapper object, a cycle...) it gives up
+// and builtinJSONStringify starts over with the generic algorithm.
+// The quoted keys of each ObjectStructure are built once per call and reused for every object of that shape.
+class JSONStringifier {
+public:
+    explicit JSONStringifier(ExecutionState& state)
+        : m_state(state)
+        , m_objectPrototype(state.context()->globalObject()->objectPrototype()->asObject())
+        , m_arrayPrototype(state.context()->globalObject()->arrayPrototype()->asObject())
+        , m_lastStructure(nullptr)
+        , m_lastLayout(0)
+    {
+    }
+
+    // returns nullptr when the generic algorithm has to be used
+    String* stringify(Object* root)
+    {
+        if (!canUseFastPath()) {
+            return nullptr;
+        }
+        if (!serializeObject(root)) {
+            return nullptr;
+        }
+        return m_output.finalize(m_state);
+    }
+
+private:
+    bool canUseFastPath()
+    {
+        // toJSON could only be found on the default prototypes
+        PropertyName toJSON(m_state.context()->staticStrings().toJSON);
+        return m_objectPrototype->getPrototypeObject(m_state) == nullptr
+            && m_arrayPrototype->getPrototypeObject(m_state) == m_objectPrototype
+            && m_objectPrototype->structure()->findProperty(toJSON) == SIZE_MAX
+            && m_arrayPrototype->structure()->findProperty(toJSON) == SIZE_MAX;
+    }
+
+    void checkStackLimit()
+    {
+        volatile int sp;
+        size_t currentStackBase = (size_t)&sp;
+#ifdef STACK_GROWS_DOWN
+        if (UNLIKELY((m_state.stackBase() - currentStackBase) > STACK_LIMIT_FROM_BASE)) {
+#else
+        if (UNLIKELY((currentStackBase - m_state.stackBase()) > STACK_LIMIT_FROM_BASE)) {
+#endif
+            ErrorObject::throwBuiltinError(m_state, ErrorObject::RangeError, "Maximum call stack size exceeded");
+        }
+    }
+
+    enum ValueKind {
+        Serialized,
+        Skipped, // undefined, functions and symbols are left out of objects and become null in arrays
+        Unsupported,
+    };
+
+    ValueKind serializeValue(const Value& value)
+    {
+        if (value.isString()) {
+            m_output.appendQuoted(value.asString());
+        } else if (value.isInt32()) {
+            appendInt32(value.asInt32());
+        } else if (value.isNumber()) {
+            double d = value.asNumber();
+            if (std::isfinite(d)) {
+                m_output.append(value.toString(m_state));
+            } else {
+                m_output.appendASCII("null", 4);
+            }
+        } else if (value.isNull()) {
+            m_output.appendASCII("null", 4);
+        } else if (value.isBoolean()) {
+            if (value.asBoolean()) {
+                m_output.appendASCII("true", 4);
+            } else {
+                m_output.appendASCII("false", 5);
+            }
+        } else if (value.isUndefined() || value.isSymbol()) {
+            return Skipped;
+        } else if (value.isObject() && !value.isCallable()) {
+            if (!serializeObject(value.asObject())) {
+                return Unsupported;
+            }
+        } else {
+            return Unsupported;
+        }
+        return Serialized;
+    }
+
+    bool serializeObject(Object* object)
+    {
+        for (size_t i = 0; i < m_stack.size(); i++) {
+            if (m_stack[i] == object) {
+                // let the generic algorithm throw the TypeError
+                return false;
+            }
+        }
+        checkStackLimit();
+
+        bool result;
+        m_stack.push_back(object);
+        if (object->hasTag(g_objectTag)) {
+            result = object->getPrototypeObject(m_state) == m_objectPrototype && serializePlainObject(object);
+        } else if (object->hasTag(g_arrayObjectTag)) {
+            ArrayObject* array = object->asArrayObject();
+            result = array->isFastModeArray() && array->getPrototypeObject(m_state) == m_arrayPrototype && serializeArray(array);
+        } else {
+            result = false;
+        }
+        m_stack.pop_back();
+        return result;
+    }
+
+    bool serializePlainObject(Object* object)
+    {
+        ObjectStructure* structure = object->structure();
+        size_t layout = keyLayout(structure);
+        if (layout == SIZE_MAX) {
+            return false;
+        }
+
+        m_output.appendChar('{');
+        bool isFirst = true;
+        size_t count = structure->propertyCount();
+        for (size_t i = 0; i < count; i++) {
+            size_t keyIndex = m_keyLayouts[layout + i];
+            if (keyIndex == SIZE_MAX) {
+                continue;
+            }
+            size_t position = m_output.length();
+            if (!isFirst) {
+                m_output.appendChar(',');
+            }
+            m_output.append(m_quotedKeys[keyIndex]);
+            ValueKind kind = serializeValue(object->m_values[i]);
+            if (kind == Unsupported) {
+                return false;
+            } else if (kind == Skipped) {
+                m_output.truncate(position);
+            } else {
+                isFirst = false;
+            }
+        }
+        m_output.appendChar('}');
+        return true;
+    }
+
+    bool serializeArray(ArrayObject* array)
+    {
+        if (array->structure()->findProperty(PropertyName(m_state.context()->staticStrings().toJSON)) != SIZE_MAX) {
+            return false;
+        }
+
+        uint32_t length = array->getArrayLength(m_state);
+        m_output.appendChar('[');
+        for (uint32_t i = 0; i < length; i++) {
+            if (i) {
+                m_output.appendChar(',');
+            }
+            Value element = array->m_fastModeData[i];
+            if (element.isEmpty()) {
+                // a hole reads through the prototype chain
+                return false;
+            }
+            ValueKind kind = serializeValue(element);
+            if (kind == Unsupported) {
+                return false;
+            } else if (kind == Skipped) {
+                m_output.appendASCII("null", 4);
+            }
+        }
+        m_output.appendChar(']');
+        return true;
+    }
+
+    // Returns where the layout of `structure` starts in m_keyLayouts. For each property the layout holds
+    // the index of its quoted "key": prefix in m_quotedKeys, or SIZE_MAX when the property is not serialized.
+    // Returns SIZE_MAX when an object of this structure needs the generic algorithm.
+    size_t keyLayout(ObjectStructure* structure)
+    {
+        if (structure == m_lastStructure) {
+            return m_lastLayout;
+        }
+
+        size_t layout;
+        auto iter = m_layoutCache.find(structure);
+        if (iter != m_layoutCache.end()) {
+            layout = iter->second;
+        } else {
+            layout = buildKeyLayout(structure);
+            m_layoutCache.insert(std::make_pair(structure, layout));
+        }
+        m_lastStructure = structure;
+        m_lastLayout = layout;
+        return layout;
+    }
+
+    size_t buildKeyLayout(ObjectStructure* structure)
+    {
+        size_t count = structure->propertyCount();
+        size_t layout = m_keyLayouts.size();
+        for (size_t i = 0; i < count; i++) {
+            const ObjectStructureItem& item = structure->readProperty(m_state, i);
+            // toJSON is looked up with [[Get]], so it counts even when it is not enumerable
+            if (item.m_propertyName == PropertyName(m_state.context()->staticStrings().toJSON)) {
+                m_keyLayouts.resize(layout);
+                return SIZE_MAX;
+            }
+            if (item.m_propertyName.isSymbol() || !item.m_descriptor.isEnumerable()) {
+                m_keyLayouts.push_back(SIZE_MAX);
+                continue;
+            }
+            if (!item.m_descriptor.isPlainDataProperty()) {
+                m_keyLayouts.resize(layout);
+                return SIZE_MAX;
+            }
+            JSONStringBuffer quotedKey;
+            quotedKey.appendQuoted(item.m_propertyName.plainString());
+            quotedKey.appendChar(':');
+            m_keyLayouts.push_back(m_quotedKeys.size());
+            m_quotedKeys.pushBack(quotedKey.finalize(m_state));
+        }
+        return layout;
+    }
+
+    void appendInt32(int32_t value)
+    {
+        char buffer[12];
+        char* end = buffer + sizeof(buffer);
+        char* p = end;
+        uint32_t magnitude = value < 0 ? -(uint32_t)value : value;
+        do {
+            *--p = '0' + magnitude % 10;
+            magnitude /= 10;
+        } while (magnitude);
+        if (value < 0) {
+            *--p = '-';
+        }
+        m_output.appendASCII(p, end - p);
+    }
+
+    ExecutionState& m_state;
+    Object* m_objectPrototype;
+    Object* m_arrayPrototype;
+    JSONStringBuffer m_output;
+    std::vector<Object*> m_stack;
+    StringVector m_quotedKeys;
+    std::vector<size_t> m_keyLayouts;
+    std::unordered_map<ObjectStructure*, size_t> m_layoutCache;
+    ObjectStructure* m_lastStructure;
+    size_t m_lastLayout;
+};
+
 static Value builtinJSONStringify(ExecutionState& state, Value thisValue, size_t argc, Value* argv, bool isNewExpression)
 {
     auto strings = &state.context()->staticStrings();
@@ -390,6 +1095,13 @@ static Value builtinJSONStringify(ExecutionState& state, Value thisValue, size_t
         }
     }
 
+    if (replacerFunc.isUndefined() && !propertyListTouched && gap->length() == 0 && value.isObject()) {
+        String* result = JSONStringifier(state).stringify(value.asObject());
+        if (result) {
+            return result;
+        }
+    }
+
     std::function<Value(ObjectPropertyName key, Object * holder)> Str;
     std::function<String*(Object*)> JA;
     std::function<String*(Object*)> JO;
@@ -64,13 +64,12 @@ Value builtinMapConstructor(ExecutionState& state, Value thisValue, size_t argc,
     // Repeat
     while (true) {
         // Let next be ? IteratorStep(iter).
-        Value next = iteratorStep(state, iter);
         // If next is false(done is true), return map.
-        if (next.isFalse()) {
+        // Let nextItem be ? IteratorValue(next).
+        Value nextItem;
+        if (!iteratorStepValue(state, iter, nextItem)) {
             return map;
         }
-        // Let nextItem be ? IteratorValue(next).
-        Value nextItem = iteratorValue(state, next);
 
         try {
             // If Type(nextItem) is not Object, then
@@ -264,8 +263,9 @@ void GlobalObject::installMap(ExecutionState& state)
     m_mapIteratorPrototype = m_iteratorPrototype;
     m_mapIteratorPrototype = new MapIteratorObject(state, nullptr, MapIteratorObject::TypeKey);
 
+    m_mapIteratorPrototypeNext = new NativeFunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().next, builtinMapIteratorNext, 0, NativeFunctionInfo::Strict));
     m_mapIteratorPrototype->defineOwnPropertyThrowsException(state, ObjectPropertyName(state.context()->staticStrings().next),
-                                                             ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().next, builtinMapIteratorNext, 0, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+                                                             ObjectPropertyDescriptor(m_mapIteratorPrototypeNext, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 
     m_mapIteratorPrototype->defineOwnPropertyThrowsException(state, ObjectPropertyName(state, Value(state.context()->vmInstance()->globalSymbols().toStringTag)),
                                                              ObjectPropertyDescriptor(Value(String::fromASCII("Map Iterator")), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::ConfigurablePresent)));
@@ -301,7 +301,7 @@ static Value builtinRegExpSplit(ExecutionState& state, Value thisValue, size_t a
                     break;
                 }
                 // Let T be a String value equal to the substring of S consisting of the elements at indices p (inclusive) through q (exclusive).
-                String* T = S->substring(p, matchStart);
+                String* T = S->substring(state, p, matchStart);
                 // Perform CreateDataProperty(A, ToString(lengthA), T).
                 A->defineOwnPropertyThrowsException(state, ObjectPropertyName(state, Value(lengthA).toString(state)), ObjectPropertyDescriptor(T, (ObjectPropertyDescriptor::AllPresent)));
                 // Let lengthA be lengthA + 1.
@@ -337,7 +337,7 @@ static Value builtinRegExpSplit(ExecutionState& state, Value thisValue, size_t a
     }
 
     // Let T be a String value equal to the substring of S consisting of the elements at indices p (inclusive) through size (exclusive).
-    String* T = S->substring(p, size);
+    String* T = S->substring(state, p, size);
     // Perform CreateDataProperty(A, ToString(lengthA), T ).
     A->defineOwnPropertyThrowsException(state, ObjectPropertyName(state, Value(lengthA).toString(state)), ObjectPropertyDescriptor(T, ObjectPropertyDescriptor::AllPresent));
     // Return A.
@@ -66,13 +66,12 @@ Value builtinSetConstructor(ExecutionState& state, Value thisValue, size_t argc,
     // Repeat
     while (true) {
         // Let next be ? IteratorStep(iter).
-        Value next = iteratorStep(state, iter);
         // If next is false, return set.
-        if (next.isFalse()) {
+        // Let nextValue be ? IteratorValue(next).
+        Value nextValue;
+        if (!iteratorStepValue(state, iter, nextValue)) {
             return set;
         }
-        // Let nextValue be ? IteratorValue(next).
-        Value nextValue = iteratorValue(state, next);
 
         // Let status be Call(adder, set, « nextValue.[[Value]] »).
         try {
@@ -236,8 +235,9 @@ void GlobalObject::installSet(ExecutionState& state)
     m_setIteratorPrototype = m_iteratorPrototype;
     m_setIteratorPrototype = new SetIteratorObject(state, nullptr, SetIteratorObject::TypeKey);
 
+    m_setIteratorPrototypeNext = new NativeFunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().next, builtinSetIteratorNext, 0, NativeFunctionInfo::Strict));
     m_setIteratorPrototype->defineOwnPropertyThrowsException(state, ObjectPropertyName(state.context()->staticStrings().next),
-                                                             ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().next, builtinSetIteratorNext, 0, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+                                                             ObjectPropertyDescriptor(m_setIteratorPrototypeNext, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 
     m_setIteratorPrototype->defineOwnPropertyThrowsException(state, ObjectPropertyName(state, Value(state.context()->vmInstance()->globalSymbols().toStringTag)),
                                                              ObjectPropertyDescriptor(Value(String::fromASCII("Set Iterator")), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::ConfigurablePresent)));
@@ -170,7 +170,7 @@ static Value builtinStringSubstring(ExecutionState& state, Value thisValue, size
                 return state.context()->staticStrings().asciiTable[c].string();
             }
         }
-        return str->substring(from, to);
+        return str->substring(state, from, to);
     }
 }
 
@@ -603,7 +603,7 @@ static Value builtinStringSplit(ExecutionState& state, Value thisValue, size_t a
                 if (result.m_matchResults[0][0].m_start >= S->length())
                     break;
 
-                String* T = S->substring(p, result.m_matchResults[0][0].m_start);
+                String* T = S->substring(state, p, result.m_matchResults[0][0].m_start);
                 A->defineOwnProperty(state, ObjectPropertyName(state, Value(lengthA++)), ObjectPropertyDescriptor(T, ObjectPropertyDescriptor::AllPresent));
                 if (lengthA == lim)
                     return A;
@@ -616,29 +616,46 @@ static Value builtinStringSplit(ExecutionState& state, Value thisValue, size_t a
         }
     } else {
         String* R = P->asString();
-        while (q != s) {
-            Value e = splitMatchUsingStr(S, q, R);
-            if (e == Value(false))
-                q++;
-            else {
-                if ((size_t)e.asInt32() == p)
+        size_t r = R->length();
+        if (r) {
+            // jump between occurrences of the separator instead of testing every position
+            while (q != s) {
+                size_t e = S->find(R, q);
+                if (e == SIZE_MAX)
+                    break;
+
+                String* T = S->substring(state, p, e);
+                A->defineOwnProperty(state, ObjectPropertyName(state, Value(lengthA++)), ObjectPropertyDescriptor(T, ObjectPropertyDescriptor::AllPresent));
+                if (lengthA == lim)
+                    return A;
+                p = e + r;
+                q = p;
+            }
+        } else {
+            while (q != s) {
+                Value e = splitMatchUsingStr(S, q, R);
+                if (e == Value(false))
                     q++;
                 else {
-                    if (q >= S->length())
-                        break;
-
-                    String* T = S->substring(p, q);
-                    A->defineOwnProperty(state, ObjectPropertyName(state, Value(lengthA++)), ObjectPropertyDescriptor(T, ObjectPropertyDescriptor::AllPresent));
-                    if (lengthA == lim)
-                        return A;
-                    p = e.asInt32();
-                    q = p;
+                    if ((size_t)e.asInt32() == p)
+                        q++;
+                    else {
+                        if (q >= S->length())
+                            break;
+
+                        String* T = S->substring(state, p, q);
+                        A->defineOwnProperty(state, ObjectPropertyName(state, Value(lengthA++)), ObjectPropertyDescriptor(T, ObjectPropertyDescriptor::AllPresent));
+                        if (lengthA == lim)
+                            return A;
+                        p = e.asInt32();
+                        q = p;
+                    }
                 }
             }
         }
     }
 
-    String* T = S->substring(p, s);
+    String* T = S->substring(state, p, s);
     A->defineOwnProperty(state, ObjectPropertyName(state, Value(lengthA)), ObjectPropertyDescriptor(T, ObjectPropertyDescriptor::AllPresent));
     return A;
 }
@@ -648,17 +665,11 @@ static Value builtinStringCharCodeAt(ExecutionState& state, Value thisValue, siz
     RESOLVE_THIS_BINDING_TO_STRING(str, String, charCodeAt);
     int position = argv[0].toInteger(state);
     Value ret;
-    const auto& data = str->bufferAccessData();
-    if (position < 0 || position >= (int)data.length)
+    // NOTE use charAt instead of bufferAccessData so that a RopeString is not flattened for a single character
+    if (position < 0 || position >= (int)str->length())
         ret = Value(std::numeric_limits<double>::quiet_NaN());
     else {
-        char16_t c;
-        if (data.has8BitContent) {
-            c = ((LChar*)data.buffer)[position];
-        } else {
-            c = ((char16_t*)data.buffer)[position];
-        }
-        ret = Value(c);
+        ret = Value(str->charAt(position));
     }
     return ret;
 }
@@ -669,28 +680,17 @@ static Value builtinStringCodePointAt(ExecutionState& state, Value thisValue, si
     RESOLVE_THIS_BINDING_TO_STRING(str, String, codePointAt);
     int position = argv[0].toInteger(state);
     Value ret;
-    const auto& data = str->bufferAccessData();
-    const int size = (int)data.length;
+    const int size = (int)str->length();
     if (position < 0 || position >= size)
         return Value();
 
-    char16_t first;
-    if (data.has8BitContent) {
-        first = ((LChar*)data.buffer)[position];
-    } else {
-        first = ((char16_t*)data.buffer)[position];
-    }
+    char16_t first = str->charAt(position);
 
     if (first < 0xD800 || first > 0xDBFF || (position + 1) == size) {
         return Value(first);
     }
 
-    char16_t second;
-    if (data.has8BitContent) {
-        second = ((LChar*)data.buffer)[position + 1];
-    } else {
-        second = ((char16_t*)data.buffer)[position + 1];
-    }
+    char16_t second = str->charAt(position + 1);
 
     if (second < 0xDC00 || second > 0xDFFF) {
         return Value(first);
@@ -713,15 +713,8 @@ static Value builtinStringCharAt(ExecutionState& state, Value thisValue, size_t
         return Value(String::emptyString);
     }
 
-    const auto& accessData = str->bufferAccessData();
-
-    if (LIKELY(0 <= position && position < (int64_t)accessData.length)) {
-        char16_t c;
-        if (accessData.has8BitContent) {
-            c = ((LChar*)accessData.buffer)[position];
-        } else {
-            c = ((char16_t*)accessData.buffer)[position];
-        }
+    if (LIKELY(0 <= position && position < (int64_t)str->length())) {
+        char16_t c = str->charAt(position);
         if (LIKELY(c < ESCARGOT_ASCII_TABLE_MAX)) {
             return state.context()->staticStrings().asciiTable[c].string();
         } else {
@@ -796,7 +789,7 @@ static Value builtinStringSlice(ExecutionState& state, Value thisValue, size_t a
     int from = (start < 0) ? std::max(len + start, 0.0) : std::min(start, (double)len);
     int to = (end < 0) ? std::max(len + end, 0.0) : std::min(end, (double)len);
     int span = std::max(to - from, 0);
-    return str->substring(from, from + span);
+    return str->substring(state, from, from + span);
 }
 
 static Value builtinStringToLowerCase(ExecutionState& state, Value thisValue, size_t argc, Value* argv, bool isNewExpression)
@@ -808,13 +801,17 @@ static Value builtinStringToLowerCase(ExecutionState& state, Value thisValue, si
         newStr.resizeWithUninitializedValues(len);
         const LChar* buf = str->characters8();
         bool result = true;
-        for (size_t i = 0; i < len; i++) {
+        for (size_t i = 0; i < len;) {
+            i += StringConversion::toLowerASCII(buf + i, newStr.data() + i, len - i);
+            if (i == len) {
+                break;
+            }
             char32_t u2 = u_tolower(buf[i]);
             if (UNLIKELY(u2 > 255)) {
                 result = false;
                 break;
             }
-            newStr[i] = u2;
+            newStr[i++] = u2;
         }
         if (result)
             return new Latin1String(std::move(newStr));
@@ -823,15 +820,16 @@ static Value builtinStringToLowerCase(ExecutionState& state, Value thisValue, si
     size_t len = str->length();
     UTF16StringData newStr;
     if (str->has8BitContent()) {
-        const LChar* buf = str->characters8();
         newStr.resizeWithUninitializedValues(len);
-        for (size_t i = 0; i < len; i++) {
-            newStr[i] = buf[i];
-        }
+        StringConversion::widen(str->characters8(), newStr.data(), len);
     } else
         newStr = UTF16StringData(str->characters16(), len);
     char16_t* buf = newStr.data();
     for (size_t i = 0; i < len;) {
+        i += StringConversion::toLowerASCII(buf + i, buf + i, len - i);
+        if (i == len) {
+            break;
+        }
         char32_t c;
         size_t iBefore = i;
         U16_NEXT(buf, i, len, c);
@@ -856,13 +854,17 @@ static Value builtinStringToUpperCase(ExecutionState& state, Value thisValue, si
         newStr.resizeWithUninitializedValues(len);
         const LChar* buf = str->characters8();
         bool result = true;
-        for (size_t i = 0; i < len; i++) {
+        for (size_t i = 0; i < len;) {
+            i += StringConversion::toUpperASCII(buf + i, newStr.data() + i, len - i);
+            if (i == len) {
+                break;
+            }
             char32_t u2 = u_toupper(buf[i]);
             if (UNLIKELY(u2 > 255)) {
                 result = false;
                 break;
             }
-            newStr[i] = u2;
+            newStr[i++] = u2;
         }
         if (result)
             return new Latin1String(std::move(newStr));
@@ -871,15 +873,16 @@ static Value builtinStringToUpperCase(ExecutionState& state, Value thisValue, si
     size_t len = str->length();
     UTF16StringData newStr;
     if (str->has8BitContent()) {
-        const LChar* buf = str->characters8();
         newStr.resizeWithUninitializedValues(len);
-        for (size_t i = 0; i < len; i++) {
-            newStr[i] = buf[i];
-        }
+        StringConversion::widen(str->characters8(), newStr.data(), len);
     } else
         newStr = UTF16StringData(str->characters16(), len);
     char16_t* buf = newStr.data();
     for (size_t i = 0; i < len;) {
+        i += StringConversion::toUpperASCII(buf + i, buf + i, len - i);
+        if (i == len) {
+            break;
+        }
         char32_t c;
         size_t iBefore = i;
         U16_NEXT(buf, i, len, c);
@@ -910,16 +913,30 @@ static Value builtinStringToLocaleUpperCase(ExecutionState& state, Value thisVal
 static Value builtinStringTrim(ExecutionState& state, Value thisValue, size_t argc, Value* argv, bool isNewExpression)
 {
     RESOLVE_THIS_BINDING_TO_STRING(str, String, trim);
-    int64_t s, e;
-    for (s = 0; s < (int64_t)str->length(); s++) {
-        if (!EscargotLexer::isWhiteSpaceOrLineTerminator((*str)[s]))
+    const auto& data = str->bufferAccessData();
+    size_t len = data.length;
+    size_t s, e;
+    if (data.has8BitContent) {
+        s = StringConversion::asciiWhitespacePrefixLength((const LChar*)data.buffer, len);
+    } else {
+        s = StringConversion::asciiWhitespacePrefixLength((const char16_t*)data.buffer, len);
+    }
+    for (; s < len; s++) {
+        if (!EscargotLexer::isWhiteSpaceOrLineTerminator(data.charAt(s)))
             break;
     }
-    for (e = ((int64_t)str->length()) - 1; e >= s; e--) {
-        if (!EscargotLexer::isWhiteSpaceOrLineTerminator((*str)[e]))
+
+    if (data.has8BitContent) {
+        e = len - StringConversion::asciiWhitespaceSuffixLength((const LChar*)data.buffer + s, len - s);
+    } else {
+        e = len - StringConversion::asciiWhitespaceSuffixLength((const char16_t*)data.buffer + s, len - s);
+    }
+    for (; e > s; e--) {
+        if (!EscargotLexer::isWhiteSpaceOrLineTerminator(data.charAt(e - 1)))
             break;
     }
-    return new StringView(str, s, e + 1);
+
+    return str->substring(state, s, e);
 }
 
 static Value builtinStringValueOf(ExecutionState& state, Value thisValue, size_t argc, Value* argv, bool isNewExpression)
@@ -1170,7 +1187,7 @@ static Value builtinStringSubstr(ExecutionState& state, Value thisValue, size_t
     if (resultLength <= 0)
         return String::emptyString;
 
-    return str->substring(intStart, intStart + resultLength);
+    return str->substring(state, intStart, intStart + resultLength);
 }
 
 
@@ -1432,8 +1449,9 @@ void GlobalObject::installString(ExecutionState& state)
     m_stringIteratorPrototype = m_iteratorPrototype;
     m_stringIteratorPrototype = new StringIteratorObject(state, nullptr);
 
+    m_stringIteratorPrototypeNext = new NativeFunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().next, builtinStringIteratorNext, 0, NativeFunctionInfo::Strict));
     m_stringIteratorPrototype->defineOwnPropertyThrowsException(state, ObjectPropertyName(state.context()->staticStrings().next),
-                                                                ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().next, builtinStringIteratorNext, 0, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+                                                                ObjectPropertyDescriptor(m_stringIteratorPrototypeNext, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 
     m_stringIteratorPrototype->defineOwnPropertyThrowsException(state, ObjectPropertyName(state, Value(state.context()->vmInstance()->globalSymbols().toStringTag)),
                                                                 ObjectPropertyDescriptor(Value(String::fromASCII("String Iterator")), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::ConfigurablePresent)));
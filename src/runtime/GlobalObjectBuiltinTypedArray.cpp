@@ -138,18 +138,14 @@ static Value TypedArrayFrom(ExecutionState& state, const Value& constructor, con
         // Let values be a new empty List.
         ValueVector values;
         // Let next be true.
-        Value next(Value::True);
         // Repeat, while next is not false
-        while (!next.isFalse()) {
-            // Let next be IteratorStep(iterator).
-            next = iteratorStep(state, iterator);
-            // If next is not false, then
-            if (!next.isFalse()) {
-                // Let nextValue be IteratorValue(next).
-                Value nextValue = iteratorValue(state, next);
-                // Append nextValue to the end of the List values.
-                values.push_back(nextValue);
-            }
+        //   Let next be IteratorStep(iterator).
+        //   If next is not false, then
+        //     Let nextValue be IteratorValue(next).
+        //     Append nextValue to the end of the List values.
+        Value nextValue;
+        while (iteratorStepValue(state, iterator, nextValue)) {
+            values.push_back(nextValue);
         }
         // Let len be the number of elements in values.
         size_t len = values.size();
@@ -228,6 +224,14 @@ static ArrayBufferObject* validateTypedArray(ExecutionState& state, Object* this
     return buffer;
 }
 
+// user code run while converting the arguments may have detached the buffer
+static void throwIfDetachedBuffer(ExecutionState& state, ArrayBufferView* wrapper, String* func)
+{
+    if (wrapper->buffer()->isDetachedBuffer()) {
+        ErrorObject::throwBuiltinError(state, ErrorObject::TypeError, state.context()->staticStrings().TypedArray.string(), true, func, errorMessage_GlobalObject_DetachedBuffer);
+    }
+}
+
 static Value getDefaultTypedArrayConstructor(ExecutionState& state, const TypedArrayType type)
 {
     GlobalObject* glob = state.context()->globalObject();
@@ -528,38 +532,14 @@ static Value builtinTypedArrayCopyWithin(ExecutionState& state, Value thisValue,
 
     // Let count be min(final-from, len-to).
     double count = std::min(finalEnd - from, len - to);
-    int8_t direction;
-    // If from<to and to<from+count
-    if (from < to && to < from + count) {
-        // Let direction be -1.
-        direction = -1;
-        // Let from be from + count -1.
-        from = from + count - 1;
-        // Let to be to + count -1.
-        to = to + count - 1;
-    } else {
-        // Let direction = 1.
-        direction = 1;
-    }
-
-    // Repeat, while count > 0
-    while (count > 0) {
-        // Let fromPresent be HasProperty(O, fromKey).
-        ObjectGetResult fromValue = O->getIndexedProperty(state, Value(from));
-        // If fromPresent is true, then
-        if (fromValue.hasValue()) {
-            // Let setStatus be Set(O, toKey, fromVal, true).
-            O->setIndexedPropertyThrowsException(state, Value(to), fromValue.value(state, O));
-        } else {
-            // Let deleteStatus be DeletePropertyOrThrow(O, toKey).
-            O->deleteOwnPropertyThrowsException(state, ObjectPropertyName(state, Value(to)));
-        }
-        // Let from be from + direction.
-        from = from + direction;
-        // Let to be to + direction.
-        to = to + direction;
-        // Let count be count − 1.
-        count = count - 1;
+    // If count > 0, then
+    if (count > 0) {
+        ArrayBufferView* wrapper = O->asArrayBufferView();
+        throwIfDetachedBuffer(state, wrapper, state.context()->staticStrings().copyWithin.string());
+        // Every element is present, so the copy is a move of the raw bytes, which also handles overlapping ranges.
+        size_t elementSize = ArrayBufferView::getElementSize(wrapper->typedArrayType());
+        uint8_t* raw = wrapper->rawBuffer();
+        memmove(raw + (size_t)to * elementSize, raw + (size_t)from * elementSize, (size_t)count * elementSize);
     }
     // return O.
     return O;
@@ -608,26 +588,12 @@ static Value builtinTypedArrayIndexOf(ExecutionState& state, Value thisValue, si
         }
     }
 
-    // Repeat, while k<len
-    while (k < len) {
-        // Let kPresent be the result of calling the [[HasProperty]] internal method of O with argument ToString(k).
-        ObjectGetResult kPresent = O->getIndexedProperty(state, Value(k));
-        RELEASE_ASSERT(kPresent.hasValue());
-        // If kPresent is true, then
-        // Let elementK be the result of calling the [[Get]] internal method of O with the argument ToString(k).
-        Value elementK = kPresent.value(state, O);
-
-        // Let same be the result of applying the Strict Equality Comparison Algorithm to searchElement and elementK.
-        if (elementK.equalsTo(state, argv[0])) {
-            // If same is true, return k.
-            return Value(k);
-        }
-        // Increase k by 1.
-        k++;
+    // Every element is a Number, so only a Number can be strictly equal to one of them.
+    if (!argv[0].isNumber()) {
+        return Value(-1);
     }
-
-    // Return -1.
-    return Value(-1);
+    throwIfDetachedBuffer(state, O->asArrayBufferView(), state.context()->staticStrings().indexOf.string());
+    return Value(O->asArrayBufferView()->indexOfElement(argv[0].asNumber(), k));
 }
 
 static Value builtinTypedArrayLastIndexOf(ExecutionState& state, Value thisValue, size_t argc, Value* argv, bool isNewExpression)
@@ -664,32 +630,12 @@ static Value builtinTypedArrayLastIndexOf(ExecutionState& state, Value thisValue
         k = len - std::abs(n);
     }
 
-    // Repeat, while k≥ 0
-    while (k >= 0) {
-        // Let kPresent be the result of calling the [[HasProperty]] internal method of O with argument ToString(k).
-        ObjectGetResult kPresent = O->getIndexedProperty(state, Value(k));
-        // If kPresent is true, then
-        if (kPresent.hasValue()) {
-            // Let elementK be the result of calling the [[Get]] internal method of O with the argument ToString(k).
-            Value elementK = kPresent.value(state, O);
-
-            // Let same be the result of applying the Strict Equality Comparison Algorithm to searchElement and elementK.
-            if (elementK.equalsTo(state, argv[0])) {
-                // If same is true, return k.
-                return Value(k);
-            }
-        } else {
-            int64_t result;
-            Object::nextIndexBackward(state, O, k, -1, result);
-            k = result;
-            continue;
-        }
-        // Decrease k by 1.
-        k--;
+    // Every element is a Number, so only a Number can be strictly equal to one of them.
+    if (k < 0 || !argv[0].isNumber()) {
+        return Value(-1);
     }
-
-    // Return -1.
-    return Value(-1);
+    throwIfDetachedBuffer(state, O->asArrayBufferView(), state.context()->staticStrings().lastIndexOf.string());
+    return Value(O->asArrayBufferView()->lastIndexOfElement(argv[0].asNumber(), k));
 }
 
 static Value builtinTypedArraySet(ExecutionState& state, Value thisValue, size_t argc, Value* argv, bool isNewExpression)
@@ -743,6 +689,15 @@ static Value builtinTypedArraySet(ExecutionState& state, Value thisValue, size_t
             const StaticStrings* strings = &state.context()->staticStrings();
             ErrorObject::throwBuiltinError(state, ErrorObject::RangeError, strings->TypedArray.string(), true, strings->set.string(), errorMessage_GlobalObject_InvalidArrayLength);
         }
+        if (wrapper->typedArrayType() == arg0Wrapper->typedArrayType()) {
+            if (srcBuffer->isDetachedBuffer() || targetBuffer->isDetachedBuffer()) {
+                const StaticStrings* strings = &state.context()->staticStrings();
+                ErrorObject::throwBuiltinError(state, ErrorObject::TypeError, strings->TypedArray.string(), true, strings->set.string(), errorMessage_GlobalObject_DetachedBuffer);
+            }
+            // the elements can be copied as bytes, and memmove also handles two views on the same buffer
+            memmove(wrapper->rawBuffer() + (size_t)offset * targetElementSize, arg0Wrapper->rawBuffer(), (size_t)srcLength * targetElementSize);
+            return Value();
+        }
         int srcByteIndex = 0;
         ArrayBufferObject* oldSrcBuffer = srcBuffer;
         unsigned oldSrcByteoffset = arg0Wrapper->byteOffset();
@@ -841,6 +796,13 @@ static Value builtinTypedArraySort(ExecutionState& state, Value thisValue, size_
     }
     bool defaultSort = (argc == 0) || cmpfn.isUndefined();
 
+    if (defaultSort) {
+        // 22.2.3.25.3-10 only compare numbers, so the elements are sorted in place as their own type
+        throwIfDetachedBuffer(state, O->asArrayBufferView(), state.context()->staticStrings().sort.string());
+        O->asArrayBufferView()->sortElements();
+        return O;
+    }
+
     // [defaultSort, &cmpfn, &state, &buffer]
     O->sort(state, len, [&](const Value& x, const Value& y) -> bool {
         ASSERT(x.isNumber() && y.isNumber());
@@ -977,6 +939,9 @@ static Value builtinTypedArrayFill(ExecutionState& state, Value thisValue, size_
     // in place of performing a [[Get]] of "length"
     double len = O->asArrayBufferView()->arrayLength();
 
+    // Let value be ToNumber(value).
+    Value value(argv[0].toNumber(state));
+
     // Let relativeStart be ToInteger(start).
     double relativeStart = 0;
     if (argc > 1) {
@@ -995,10 +960,9 @@ static Value builtinTypedArrayFill(ExecutionState& state, Value thisValue, size_
     // If relativeEnd < 0, let final be max((len + relativeEnd),0); else let final be min(relativeEnd, len).
     unsigned fin = (relativeEnd < 0) ? std::max(len + relativeEnd, 0.0) : std::min(relativeEnd, len);
 
-    Value value = argv[0];
-    while (k < fin) {
-        O->setIndexedPropertyThrowsException(state, Value(k), value);
-        k++;
+    if (k < fin) {
+        throwIfDetachedBuffer(state, O->asArrayBufferView(), state.context()->staticStrings().fill.string());
+        O->asArrayBufferView()->fillElements(state, value, k, fin);
     }
     // return O.
     return O;
@@ -1393,28 +1357,9 @@ static Value builtinTypedArrayReverse(ExecutionState& state, Value thisValue, si
     // Array.prototype.reverse as defined in 22.1.3.20 except
     // that the this object’s [[ArrayLength]] internal slot is accessed
     // in place of performing a [[Get]] of "length"
-    unsigned len = O->asArrayBufferView()->arrayLength();
-    unsigned middle = std::floor(len / 2);
-    unsigned lower = 0;
-    while (middle > lower) {
-        unsigned upper = len - lower - 1;
-
-        ObjectGetResult upperResult = O->getIndexedProperty(state, Value(upper));
-        ObjectGetResult lowerResult = O->getIndexedProperty(state, Value(lower));
-        RELEASE_ASSERT(upperResult.hasValue() && lowerResult.hasValue());
-
-        Value upperValue = upperResult.value(state, O);
-        Value lowerValue = lowerResult.value(state, O);
-
-        if (!O->setIndexedProperty(state, Value(lower), upperValue)) {
-            ErrorObject::throwBuiltinError(state, ErrorObject::TypeError, state.context()->staticStrings().TypedArray.string(), false, String::emptyString, errorMessage_DefineProperty_NotWritable);
-        }
-        if (!O->setIndexedProperty(state, Value(upper), lowerValue)) {
-            ErrorObject::throwBuiltinError(state, ErrorObject::TypeError, state.context()->staticStrings().TypedArray.string(), false, String::emptyString, errorMessage_DefineProperty_NotWritable);
-        }
-
-        lower++;
-    }
+    // Every element is present and writable, so the elements are swapped in place.
+    throwIfDetachedBuffer(state, O->asArrayBufferView(), state.context()->staticStrings().reverse.string());
+    O->asArrayBufferView()->reverseElements();
     return O;
 }
 
@@ -1464,18 +1409,12 @@ static Value builtinTypedArraySlice(ExecutionState& state, Value thisValue, size
         if (srcBuffer->isDetachedBuffer()) {
             ErrorObject::throwBuiltinError(state, ErrorObject::TypeError, state.context()->staticStrings().TypedArray.string(), false, String::emptyString, errorMessage_GlobalObject_DetachedBuffer);
         }
-        ArrayBufferObject* targetBuffer = targetWrapper->buffer();
         unsigned elementSize = ArrayBufferView::getElementSize(srcWrapper->typedArrayType());
-        unsigned srcByteOffset = srcWrapper->byteOffset();
-        unsigned targetByteIndex = 0;
-        unsigned srcByteIndex = k * elementSize + srcByteOffset;
-
-        while (targetByteIndex < count * elementSize) {
-            Value value = srcWrapper->getValueFromBuffer<uint8_t>(state, srcByteIndex);
-            targetWrapper->setValueInBuffer<Uint8Adaptor>(state, targetByteIndex, value);
-            srcByteIndex++;
-            targetByteIndex++;
+        if (targetWrapper->arrayLength() < count || targetWrapper->buffer()->isDetachedBuffer()) {
+            ErrorObject::throwBuiltinError(state, ErrorObject::TypeError, state.context()->staticStrings().TypedArray.string(), true, state.context()->staticStrings().slice.string(), errorMessage_GlobalObject_InvalidArrayLength);
         }
+        // the species constructor may return a view on the same buffer
+        memmove(targetWrapper->rawBuffer(), srcWrapper->rawBuffer() + (size_t)k * elementSize, (size_t)count * elementSize);
     }
     // Return A.
     return A;
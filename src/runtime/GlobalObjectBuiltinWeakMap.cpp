@@ -65,13 +65,12 @@ Value builtinWeakMapConstructor(ExecutionState& state, Value thisValue, size_t a
     // Repeat
     while (true) {
         // Let next be ? IteratorStep(iter).
-        Value next = iteratorStep(state, iter);
         // If next is false(done is true), return map.
-        if (next.isFalse()) {
+        // Let nextItem be ? IteratorValue(next).
+        Value nextItem;
+        if (!iteratorStepValue(state, iter, nextItem)) {
             return map;
         }
-        // Let nextItem be ? IteratorValue(next).
-        Value nextItem = iteratorValue(state, next);
 
         try {
             // If Type(nextItem) is not Object, then
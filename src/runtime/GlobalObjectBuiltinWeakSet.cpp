@@ -67,13 +67,12 @@ Value builtinWeakSetConstructor(ExecutionState& state, Value thisValue, size_t a
     // Repeat
     while (true) {
         // Let next be ? IteratorStep(iter).
-        Value next = iteratorStep(state, iter);
         // If next is false, return set.
-        if (next.isFalse()) {
+        // Let nextValue be ? IteratorValue(next).
+        Value nextValue;
+        if (!iteratorStepValue(state, iter, nextValue)) {
             return set;
         }
-        // Let nextValue be ? IteratorValue(next).
-        Value nextValue = iteratorValue(state, next);
 
         // Let status be Call(adder, set, « nextValue.[[Value]] »).
         try {
@@ -24,6 +24,8 @@
 #include "runtime/Object.h"
 #include "runtime/FunctionObject.h"
 #include "runtime/ErrorObject.h"
+#include "runtime/GlobalObject.h"
+#include "runtime/IteratorObject.h"
 
 namespace Escargot {
 
@@ -90,6 +92,56 @@ Value iteratorStep(ExecutionState& state, const Value& iterator)
     return done ? Value(Value::False) : result;
 }
 
+// whether func is the original next method for the kind of built-in iterator that iterator is,
+// in which case calling it is the same as advancing the iterator directly
+static bool isBuiltinIteratorNext(ExecutionState& state, Object* iterator, const Value& func)
+{
+    if (!iterator->isIteratorObject() || !func.isObject()) {
+        return false;
+    }
+    IteratorObject* iter = iterator->asIteratorObject();
+    GlobalObject* globalObject = state.context()->globalObject();
+    Object* next = func.asObject();
+    if (iter->isArrayIteratorObject()) {
+        return next == globalObject->arrayIteratorPrototypeNext() && !iter->isArrayIteratorPrototypeObject();
+    } else if (iter->isStringIteratorObject()) {
+        return next == globalObject->stringIteratorPrototypeNext();
+    } else if (iter->isMapIteratorObject()) {
+        return next == globalObject->mapIteratorPrototypeNext();
+    } else if (iter->isSetIteratorObject()) {
+        return next == globalObject->setIteratorPrototypeNext();
+    }
+    return false;
+}
+
+// IteratorStep followed by IteratorValue; returns false when the iterator is done
+// Built-in array, string, Map and Set iterators whose next method is unmodified are advanced
+// without creating iterator result objects
+bool iteratorStepValue(ExecutionState& state, const Value& iterator, Value& value)
+{
+    Object* obj = iterator.toObject(state);
+    Value func = obj->get(state, ObjectPropertyName(state.context()->staticStrings().next)).value(state, obj);
+
+    if (isBuiltinIteratorNext(state, obj, func)) {
+        std::pair<Value, bool> result = obj->asIteratorObject()->advance(state);
+        if (result.second) {
+            return false;
+        }
+        value = result.first;
+        return true;
+    }
+
+    Value result = Object::call(state, func, iterator, 0, nullptr);
+    if (!result.isObject()) {
+        ErrorObject::throwBuiltinError(state, ErrorObject::TypeError, "result is not an object");
+    }
+    if (iteratorComplete(state, result)) {
+        return false;
+    }
+    value = iteratorValue(state, result);
+    return true;
+}
+
 // https://www.ecma-international.org/ecma-262/6.0/#sec-iteratorclose
 Value iteratorClose(ExecutionState& state, const Value& iterator, const Value& completionValue, bool hasThrowOnCompletionType)
 {
@@ -176,9 +176,71 @@ Value NativeFunctionObject::processNativeFunctionCall(ExecutionState& state, con
     }
 }
 
+static bool unboxFastCallArguments(CallNativeFunctionData* data, Value* argv, FastCallValue* fastArgv)
+{
+    for (size_t i = 0; i < data->m_fastArgumentCount; i++) {
+        const Value& v = argv[i];
+        switch (data->m_fastArgumentTypes[i]) {
+        case FastCallType::Bool:
+            if (!v.isBoolean()) {
+                return false;
+            }
+            fastArgv[i].m_bool = v.asBoolean();
+            break;
+        case FastCallType::Int32:
+            if (!v.isInt32()) {
+                return false;
+            }
+            fastArgv[i].m_int32 = v.asInt32();
+            break;
+        case FastCallType::Double:
+            if (!v.isNumber()) {
+                return false;
+            }
+            fastArgv[i].m_double = v.asNumber();
+            break;
+        case FastCallType::String:
+            if (!v.isString()) {
+                return false;
+            }
+            fastArgv[i].m_string = v.asString();
+            break;
+        default:
+            RELEASE_ASSERT_NOT_REACHED();
+        }
+    }
+    return true;
+}
+
+static Value boxFastCallResult(FastCallType type, const FastCallValue& result)
+{
+    switch (type) {
+    case FastCallType::Void:
+        return Value();
+    case FastCallType::Bool:
+        return Value(result.m_bool);
+    case FastCallType::Int32:
+        return Value(result.m_int32);
+    case FastCallType::Double:
+        return Value(result.m_double);
+    case FastCallType::String:
+        return Value(result.m_string);
+    default:
+        RELEASE_ASSERT_NOT_REACHED();
+    }
+}
+
 Value NativeFunctionObject::call(ExecutionState& state, const Value& thisValue, const size_t argc, NULLABLE Value* argv)
 {
     ASSERT(codeBlock()->hasCallNativeFunctionCode());
+    CallNativeFunctionData* code = m_codeBlock->nativeFunctionData();
+    if (code->m_fastFn && argc >= code->m_fastArgumentCount) {
+        // the typed entry point gets no receiver and no ExecutionState, so there is nothing to set up
+        FastCallValue fastArgv[ESCARGOT_FAST_CALL_ARGUMENT_MAX];
+        if (LIKELY(unboxFastCallArguments(code, argv, fastArgv))) {
+            return boxFastCallResult(code->m_fastReturnType, code->m_fastFn(code, fastArgv));
+        }
+    }
     return processNativeFunctionCall<false>(state, thisValue, argc, argv, nullptr);
 }
 
@@ -439,6 +439,17 @@ Object::Object(ExecutionState& state)
     initPlainObject(state);
 }
 
+Object::Object(ExecutionState& state, ObjectStructure* structure, const Value* values)
+    : m_structure(structure)
+{
+    size_t count = structure->propertyCount();
+    m_values.resizeWithUninitializedValues(0, count);
+    for (size_t i = 0; i < count; i++) {
+        m_values[i] = values[i];
+    }
+    initPlainObject(state);
+}
+
 // https://www.ecma-international.org/ecma-262/6.0/#sec-isconcatspreadable
 bool Object::isConcatSpreadable(ExecutionState& state)
 {
@@ -702,10 +702,14 @@ class Object : public PointerValue {
     friend class GlobalObject;
     friend class ByteCodeInterpreter;
     friend struct ObjectRareData;
+    friend class JSONStringifier;
     static Object* createBuiltinObjectPrototype(ExecutionState& state);
 
 public:
     explicit Object(ExecutionState& state);
+    // creates a plain object laid out by `structure`, which must hold only data properties;
+    // `values` has one entry per property of `structure`
+    Object(ExecutionState& state, ObjectStructure* structure, const Value* values);
     static Object* createFunctionPrototypeObject(ExecutionState& state, FunctionObject* function);
 
     virtual bool isObjectByVTable() const override
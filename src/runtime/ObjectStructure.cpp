@@ -30,6 +30,7 @@ void* ObjectStructure::operator new(size_t size)
         GC_word obj_bitmap[GC_BITMAP_SIZE(ObjectStructure)] = { 0 };
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ObjectStructure, m_properties));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ObjectStructure, m_transitionTable));
+        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ObjectStructure, m_cachedEnumerateObjectKeyData));
         descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(ObjectStructure));
         typeInited = true;
     }
@@ -45,6 +46,7 @@ void* ObjectStructureWithFastAccess::operator new(size_t size)
         GC_word obj_bitmap[len] = { 0 };
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ObjectStructureWithFastAccess, m_properties));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ObjectStructureWithFastAccess, m_transitionTable));
+        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ObjectStructureWithFastAccess, m_cachedEnumerateObjectKeyData));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ObjectStructureWithFastAccess, m_propertyNameMap));
         descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(ObjectStructureWithFastAccess));
         typeInited = true;
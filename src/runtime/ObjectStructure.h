@@ -28,6 +28,7 @@
 namespace Escargot {
 
 class ObjectStructure;
+class EnumerateObjectKeyData;
 
 struct ObjectStructureItem : public gc {
     ObjectStructureItem(const PropertyName& as, const ObjectStructurePropertyDescriptor& desc)
@@ -68,6 +69,7 @@ public:
         , m_hasIndexPropertyName(false)
         , m_needsTransitionTable(needsTransitionTable)
         , m_isStructureWithFastAccess(false)
+        , m_cachedEnumerateObjectKeyData(nullptr)
     {
     }
 
@@ -77,6 +79,7 @@ public:
         , m_needsTransitionTable(needsTransitionTable)
         , m_isStructureWithFastAccess(false)
         , m_properties(std::move(properties))
+        , m_cachedEnumerateObjectKeyData(nullptr)
     {
     }
 
@@ -147,6 +150,18 @@ public:
         return m_isProtectedByTransitionTable;
     }
 
+    // keys of the last for-in loop over an object with this structure
+    // every change to the properties of an object gives it a new structure, so they stay valid for plain objects
+    EnumerateObjectKeyData* cachedEnumerateObjectKeyData()
+    {
+        return m_cachedEnumerateObjectKeyData;
+    }
+
+    void setCachedEnumerateObjectKeyData(EnumerateObjectKeyData* data)
+    {
+        m_cachedEnumerateObjectKeyData = data;
+    }
+
     size_t propertyCount() const
     {
         return m_properties.size();
@@ -164,6 +179,7 @@ protected:
     bool m_isStructureWithFastAccess : 1;
     ObjectStructureItemVector m_properties;
     ObjectStructureTransitionTableVector m_transitionTable;
+    EnumerateObjectKeyData* m_cachedEnumerateObjectKeyData;
 
     size_t searchTransitionTable(const PropertyName& s, const ObjectStructurePropertyDescriptor& desc)
     {
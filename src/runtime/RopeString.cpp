@@ -76,42 +76,209 @@ String* RopeString::createRopeString(String* lstr, String* rstr, ExecutionState*
     }
 
     RopeString* rope = new RopeString();
-    rope->m_contentLength = llen + rlen;
-    rope->m_left = lstr;
-    rope->m_right = rstr;
+    rope->initRopeNode(lstr, rstr);
+    /*
+    bool has8 = true;
+    if (!lstr->has8BitContent()) {
+        if (!isAllLatin1((char16_t*)lstr->bufferAccessData().buffer, llen)) {
+            has8 = false;
+        }
+    }
+
+    if (has8 && !rstr->has8BitContent()) {
+        if (!isAllLatin1((char16_t*)rstr->bufferAccessData().buffer, rlen)) {
+            has8 = false;
+        }
+    }
+
+    rope->m_has8BitContent = has8;
+    */
+    return rope;
+}
+
+void RopeString::initRopeNode(String* lstr, String* rstr)
+{
+    m_contentLength = lstr->length() + rstr->length();
+    m_left = lstr;
+    m_right = rstr;
 
     bool l8bit;
+    size_t ldepth = 0;
     if (lstr->isRopeString()) {
         l8bit = ((RopeString*)lstr)->m_has8BitContent;
+        if (((RopeString*)lstr)->m_right) {
+            ldepth = ((RopeString*)lstr)->m_depth;
+        }
     } else {
         l8bit = lstr->has8BitContent();
     }
 
     bool r8bit;
+    size_t rdepth = 0;
     if (rstr->isRopeString()) {
         r8bit = ((RopeString*)rstr)->m_has8BitContent;
+        if (((RopeString*)rstr)->m_right) {
+            rdepth = ((RopeString*)rstr)->m_depth;
+        }
     } else {
         r8bit = rstr->has8BitContent();
     }
 
-    rope->m_has8BitContent = l8bit & r8bit;
-    /*
-    bool has8 = true;
-    if (!lstr->has8BitContent()) {
-        if (!isAllLatin1((char16_t*)lstr->bufferAccessData().buffer, llen)) {
-            has8 = false;
+    m_has8BitContent = l8bit & r8bit;
+    // depth saturates at 255, rebalance() recomputes it from the rebuilt tree
+    m_depth = std::min<size_t>(std::max(ldepth, rdepth) + 1, std::numeric_limits<uint8_t>::max());
+}
+
+bool RopeString::shouldAccessWithoutFlattening()
+{
+    if (!m_right) {
+        return false;
+    }
+
+    // a rope read over and over (e.g. a charAt loop) is cheaper to flatten once
+    if (m_accessCount >= ROPE_STRING_ACCESS_COUNT_BEFORE_FLATTEN) {
+        flattenRopeString();
+        return false;
+    }
+    m_accessCount++;
+
+    if (UNLIKELY(m_depth > ROPE_STRING_MAX_DEPTH)) {
+        rebalance();
+    }
+    return m_right;
+}
+
+char16_t RopeString::charAt(const size_t idx) const
+{
+    RopeString* self = const_cast<RopeString*>(this);
+    if (!self->shouldAccessWithoutFlattening()) {
+        return m_left->charAt(idx);
+    }
+
+    String* cur = self;
+    size_t index = idx;
+    while (cur->isRopeString()) {
+        RopeString* rope = (RopeString*)cur;
+        if (!rope->m_right) {
+            cur = rope->m_left;
+            break;
+        }
+        size_t leftLength = rope->m_left->length();
+        if (index < leftLength) {
+            cur = rope->m_left;
+        } else {
+            index -= leftLength;
+            cur = rope->m_right;
         }
     }
+    return cur->charAt(index);
+}
 
-    if (has8 && !rstr->has8BitContent()) {
-        if (!isAllLatin1((char16_t*)rstr->bufferAccessData().buffer, rlen)) {
-            has8 = false;
+String* RopeString::substring(size_t from, size_t to)
+{
+    ASSERT(from <= to && to <= length());
+    if (from == 0 && to == length()) {
+        return this;
+    }
+
+    if (!shouldAccessWithoutFlattening()) {
+        return m_left->substring(from, to);
+    }
+
+    size_t leftLength = m_left->length();
+    if (to <= leftLength) {
+        return m_left->substring(from, to);
+    } else if (from >= leftLength) {
+        return m_right->substring(from - leftLength, to - leftLength);
+    }
+
+    String* leftPart = m_left->substring(from, leftLength);
+    String* rightPart = m_right->substring(0, to - leftLength);
+    if (to - from > STRING_SUB_STRING_MIN_VIEW_LENGTH) {
+        return createRopeString(leftPart, rightPart);
+    }
+
+    StringBuilder builder;
+    builder.appendString(leftPart);
+    builder.appendString(rightPart);
+    return builder.finalize();
+}
+
+static String* buildBalancedRope(String** leaves, size_t count)
+{
+    if (count == 1) {
+        return leaves[0];
+    }
+    size_t half = count / 2;
+    return RopeString::createRopeString(buildBalancedRope(leaves, half), buildBalancedRope(leaves + half, count - half));
+}
+
+void RopeString::rebalance()
+{
+    ASSERT(m_right);
+
+    // collect leaves in order, merging runs of short leaves into flat strings
+    // NOTE merged leaves are reachable only from `leaves` until the tree is rebuilt,
+    // so it must be visible to GC
+    StringVector leaves;
+    StringBuilder builder;
+    size_t pendingCount = 0;
+    String* pendingFirst = nullptr;
+    auto flushPending = [&]() {
+        if (pendingCount == 1) {
+            leaves.pushBack(pendingFirst);
+            builder.clear();
+        } else if (pendingCount > 1) {
+            leaves.pushBack(builder.finalize());
+        }
+        pendingCount = 0;
+    };
+
+    std::vector<String*> stack;
+    stack.push_back(m_right);
+    stack.push_back(m_left);
+    while (!stack.empty()) {
+        String* cur = stack.back();
+        stack.pop_back();
+        if (cur->isRopeString()) {
+            RopeString* rope = (RopeString*)cur;
+            if (rope->m_right) {
+                stack.push_back(rope->m_right);
+                stack.push_back(rope->m_left);
+                continue;
+            }
+            cur = rope->m_left;
         }
+
+        size_t len = cur->length();
+        if (len >= ROPE_STRING_LEAF_MERGE_LENGTH) {
+            flushPending();
+            leaves.pushBack(cur);
+            continue;
+        }
+
+        if (builder.contentLength() + len > ROPE_STRING_LEAF_MERGE_LENGTH) {
+            flushPending();
+        }
+        if (pendingCount++ == 0) {
+            pendingFirst = cur;
+        }
+        builder.appendString(cur);
     }
+    flushPending();
 
-    rope->m_has8BitContent = has8;
-    */
-    return rope;
+    ASSERT(leaves.size());
+    if (leaves.size() == 1) {
+        m_left = leaves[0];
+        m_right = nullptr;
+        m_depth = 0;
+        return;
+    }
+
+    size_t half = leaves.size() / 2;
+    String* lstr = buildBalancedRope(leaves.data(), half);
+    String* rstr = buildBalancedRope(leaves.data() + half, leaves.size() - half);
+    initRopeNode(lstr, rstr);
 }
 
 template <typename A, typename B>
@@ -157,6 +324,7 @@ void RopeString::flattenRopeStringWorker()
     }
     m_left = new B(std::move(result));
     m_right = nullptr;
+    m_depth = 0;
 }
 
 void RopeString::flattenRopeString()
@@ -35,6 +35,8 @@ public:
         m_right = String::emptyString;
         m_contentLength = 0;
         m_has8BitContent = true;
+        m_depth = 0;
+        m_accessCount = 0;
         m_bufferAccessData.hasSpecialImpl = true;
     }
 
@@ -48,10 +50,10 @@ public:
     {
         return m_contentLength;
     }
-    virtual char16_t charAt(const size_t idx) const
-    {
-        return normalString()->charAt(idx);
-    }
+    // charAt and substring walk the tree instead of flattening it
+    // until the same rope has been accessed ROPE_STRING_ACCESS_COUNT_BEFORE_FLATTEN times
+    virtual char16_t charAt(const size_t idx) const;
+    String* substring(size_t from, size_t to);
     virtual UTF16StringData toUTF16StringData() const
     {
         return normalString()->toUTF16StringData();
@@ -97,6 +99,10 @@ protected:
     void flattenRopeStringWorker();
     void flattenRopeString();
 
+    bool shouldAccessWithoutFlattening();
+    void initRopeNode(String* lstr, String* rstr);
+    void rebalance();
+
 private:
     String* m_left;
     String* m_right;
@@ -108,6 +114,8 @@ private:
         size_t m_contentLength : 63;
 #endif
     };
+    uint8_t m_depth;
+    uint8_t m_accessCount;
 #if !defined(COMPILER_MSVC)
     static_assert(STRING_MAXIMUM_LENGTH < (std::numeric_limits<size_t>::max() / 2), "");
 #endif
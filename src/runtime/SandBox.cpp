@@ -43,6 +43,43 @@ SandBox::~SandBox()
     m_context->vmInstance()->m_currentSandBox = m_oldSandBox;
 }
 
+static String* stackTraceInfoString(CodeBlock* cb)
+{
+    if (cb->isInterpretedCodeBlock() && cb->asInterpretedCodeBlock()->script()) {
+        return cb->asInterpretedCodeBlock()->script()->src();
+    }
+
+    StringBuilder builder;
+    builder.appendString("function ");
+    builder.appendString(cb->functionName().string());
+    builder.appendString("() { ");
+    builder.appendString("[native function]");
+    builder.appendString(" } ");
+    return builder.finalize();
+}
+
+SandBox::StackTraceData SandBox::symbolicate(const StackTraceRawData& rawData)
+{
+    StackTraceData traceData;
+    CodeBlock* cb = rawData.codeBlock;
+    if (rawData.byteCodeBlock) {
+        traceData.loc = rawData.byteCodeBlock->computeNodeLOCFromByteCode(m_context, rawData.byteCodePosition, rawData.byteCodeBlock->m_codeBlock);
+    }
+    traceData.src = stackTraceInfoString(cb);
+    if (rawData.byteCodeBlock || (!rawData.isFunction && !cb->asInterpretedCodeBlock()->isEvalCodeInFunction())) {
+        traceData.sourceCode = cb->asInterpretedCodeBlock()->script()->sourceCode();
+    }
+    if (rawData.isFunction) {
+        traceData.functionName = cb->functionName().string();
+    }
+    traceData.isFunction = rawData.isFunction;
+    traceData.isConstructor = rawData.isConstructor;
+    traceData.isAssociatedWithJavaScriptCode = cb->isInterpretedCodeBlock();
+    traceData.isEval = !rawData.isFunction;
+
+    return traceData;
+}
+
 void SandBox::processCatch(const Value& error, SandBoxResult& result)
 {
     // when exception occurred, an undefined value is allocated for result value which will be never used.
@@ -53,25 +90,7 @@ void SandBox::processCatch(const Value& error, SandBoxResult& result)
     fillStackDataIntoErrorObject(error);
 
     for (size_t i = 0; i < m_stackTraceData.size(); i++) {
-        if ((size_t)m_stackTraceData[i].second.loc.index == SIZE_MAX && (size_t)m_stackTraceData[i].second.loc.actualCodeBlock != SIZE_MAX) {
-            // this means loc not computed yet.
-            ExtendedNodeLOC loc = m_stackTraceData[i].second.loc.actualCodeBlock->computeNodeLOCFromByteCode(m_context,
-                                                                                                             m_stackTraceData[i].second.loc.byteCodePosition, m_stackTraceData[i].second.loc.actualCodeBlock->m_codeBlock);
-            StackTraceData traceData;
-            traceData.loc = loc;
-            InterpretedCodeBlock* cb = m_stackTraceData[i].second.loc.actualCodeBlock->m_codeBlock;
-            traceData.src = cb->script()->src();
-            traceData.sourceCode = cb->script()->sourceCode();
-            traceData.functionName = m_stackTraceData[i].second.functionName;
-            traceData.isFunction = m_stackTraceData[i].second.isFunction;
-            traceData.isConstructor = m_stackTraceData[i].second.isConstructor;
-            traceData.isAssociatedWithJavaScriptCode = m_stackTraceData[i].second.isAssociatedWithJavaScriptCode;
-            traceData.isEval = m_stackTraceData[i].second.isEval;
-
-            result.stackTraceData.pushBack(traceData);
-        } else {
-            result.stackTraceData.pushBack(m_stackTraceData[i].second);
-        }
+        result.stackTraceData.pushBack(symbolicate(m_stackTraceData[i]));
     }
 }
 
@@ -101,8 +120,10 @@ SandBox::SandBoxResult SandBox::run(const std::function<Value()>& scriptRunner)
 
 void SandBox::throwException(ExecutionState& state, Value exception)
 {
+    // only code blocks and bytecode positions are recorded here.
+    // the exception is often caught and dropped without anyone looking at its stack
     ExecutionState* pstate = &state;
-    while (pstate) {
+    while (pstate && m_stackTraceData.size() < STACK_TRACE_CAPTURE_DEPTH_MAX) {
         FunctionObject* callee = pstate->resolveCallee();
         ExecutionState* es = pstate;
 
@@ -120,80 +141,47 @@ void SandBox::throwException(ExecutionState& state, Value exception)
 
         bool alreadyExists = false;
 
-        for (size_t i = 0; i < m_stackTraceData.size(); i++) {
-            if (m_stackTraceData[i].first == es) {
+        // states of the same function are adjacent, so search from the last frame
+        for (size_t i = m_stackTraceData.size(); i > 0; i--) {
+            if (m_stackTraceData[i - 1].executionState == es) {
                 alreadyExists = true;
                 break;
             }
         }
 
         if (!alreadyExists) {
+            StackTraceRawData data;
+            data.executionState = es;
             if (!callee && es && es->lexicalEnvironment()) {
                 // can be null on module outer env
                 CodeBlock* cb = es->lexicalEnvironment()->record()->asGlobalEnvironmentRecord()->globalCodeBlock();
                 if (cb) {
-                    ByteCodeBlock* b = cb->asInterpretedCodeBlock()->byteCodeBlock();
-                    ExtendedNodeLOC loc(SIZE_MAX, SIZE_MAX, SIZE_MAX);
                     ASSERT(!pstate->m_isNativeFunctionObjectExecutionContext);
+                    data.codeBlock = cb;
                     if (pstate->m_programCounter != nullptr) {
-                        loc.byteCodePosition = *pstate->m_programCounter - (size_t)b->m_code.data();
-                        loc.actualCodeBlock = b;
+                        ByteCodeBlock* b = cb->asInterpretedCodeBlock()->byteCodeBlock();
+                        data.byteCodeBlock = b;
+                        data.byteCodePosition = *pstate->m_programCounter - (size_t)b->m_code.data();
                     }
-                    SandBox::StackTraceData data;
-                    data.loc = loc;
-                    data.src = cb->asInterpretedCodeBlock()->script()->src();
-                    data.sourceCode = cb->asInterpretedCodeBlock()->script()->sourceCode();
-                    data.isEval = true;
-                    data.isFunction = false;
-                    data.isAssociatedWithJavaScriptCode = true;
-                    data.isConstructor = false;
-
-                    m_stackTraceData.pushBack(std::make_pair(es, data));
+                    m_stackTraceData.pushBack(data);
                 }
             } else if (pstate->codeBlock() && pstate->codeBlock()->isInterpretedCodeBlock() && pstate->codeBlock()->asInterpretedCodeBlock()->isEvalCodeInFunction()) {
-                CodeBlock* cb = pstate->codeBlock();
-                ExtendedNodeLOC loc(SIZE_MAX, SIZE_MAX, SIZE_MAX);
-                SandBox::StackTraceData data;
-                data.loc = loc;
-                data.src = cb->asInterpretedCodeBlock()->script()->src();
-                data.sourceCode = String::emptyString;
-                data.isEval = true;
-                data.isFunction = false;
-                data.isAssociatedWithJavaScriptCode = true;
-                data.isConstructor = false;
-
-                m_stackTraceData.pushBack(std::make_pair(es, data));
+                data.codeBlock = pstate->codeBlock();
+                m_stackTraceData.pushBack(data);
             } else if (callee) {
                 CodeBlock* cb = callee->codeBlock();
-                ExtendedNodeLOC loc(SIZE_MAX, SIZE_MAX, SIZE_MAX);
+                data.codeBlock = cb;
                 if (cb->isInterpretedCodeBlock()) {
-                    ByteCodeBlock* b = cb->asInterpretedCodeBlock()->byteCodeBlock();
                     ASSERT(!pstate->m_isNativeFunctionObjectExecutionContext);
                     if (pstate->m_programCounter != nullptr) {
-                        loc.byteCodePosition = *pstate->m_programCounter - (size_t)b->m_code.data();
-                        loc.actualCodeBlock = b;
+                        ByteCodeBlock* b = cb->asInterpretedCodeBlock()->byteCodeBlock();
+                        data.byteCodeBlock = b;
+                        data.byteCodePosition = *pstate->m_programCounter - (size_t)b->m_code.data();
                     }
                 }
-                SandBox::StackTraceData data;
-                data.loc = loc;
-                if (cb->isInterpretedCodeBlock() && cb->asInterpretedCodeBlock()->script()) {
-                    data.src = cb->asInterpretedCodeBlock()->script()->src();
-                } else {
-                    StringBuilder builder;
-                    builder.appendString("function ");
-                    builder.appendString(cb->functionName().string());
-                    builder.appendString("() { ");
-                    builder.appendString("[native function]");
-                    builder.appendString(" } ");
-                    data.src = builder.finalize();
-                }
-                data.functionName = cb->functionName().string();
-                data.isEval = false;
                 data.isFunction = true;
-                data.isAssociatedWithJavaScriptCode = cb->isInterpretedCodeBlock();
                 data.isConstructor = callee->isConstructor();
-                data.sourceCode = String::emptyString;
-                m_stackTraceData.pushBack(std::make_pair(es, data));
+                m_stackTraceData.pushBack(data);
             }
         }
 
@@ -211,23 +199,6 @@ void SandBox::throwException(ExecutionState& state, Value exception)
     throw exception;
 }
 
-static Value builtinErrorObjectStackInfo(ExecutionState& state, Value thisValue, size_t argc, Value* argv, bool isNewExpression)
-{
-    if (!(LIKELY(thisValue.isPointerValue() && thisValue.asPointerValue()->isErrorObject()))) {
-        ErrorObject::throwBuiltinError(state, ErrorObject::TypeError, "get Error.prototype.stack called on incompatible receiver");
-    }
-
-    ErrorObject* obj = thisValue.asObject()->asErrorObject();
-    if (obj->stackTraceData() == nullptr) {
-        return String::emptyString;
-    }
-
-    auto stackTraceData = obj->stackTraceData();
-    StringBuilder builder;
-    stackTraceData->buildStackTrace(state.context(), builder);
-    return builder.finalize();
-}
-
 ErrorObject::StackTraceData* ErrorObject::StackTraceData::create(SandBox* sandBox)
 {
     ErrorObject::StackTraceData* data = new ErrorObject::StackTraceData();
@@ -236,11 +207,12 @@ ErrorObject::StackTraceData* ErrorObject::StackTraceData::create(SandBox* sandBo
     data->exception = sandBox->m_exception;
 
     for (size_t i = 0; i < sandBox->m_stackTraceData.size(); i++) {
-        if ((size_t)sandBox->m_stackTraceData[i].second.loc.index == SIZE_MAX && (size_t)sandBox->m_stackTraceData[i].second.loc.actualCodeBlock != SIZE_MAX) {
-            data->gcValues[i].byteCodeBlock = sandBox->m_stackTraceData[i].second.loc.actualCodeBlock;
-            data->nonGCValues[i].byteCodePosition = sandBox->m_stackTraceData[i].second.loc.byteCodePosition;
+        const SandBox::StackTraceRawData& rawData = sandBox->m_stackTraceData[i];
+        if (rawData.byteCodeBlock) {
+            data->gcValues[i].byteCodeBlock = rawData.byteCodeBlock;
+            data->nonGCValues[i].byteCodePosition = rawData.byteCodePosition;
         } else {
-            data->gcValues[i].infoString = sandBox->m_stackTraceData[i].second.src;
+            data->gcValues[i].codeBlock = rawData.codeBlock;
             data->nonGCValues[i].byteCodePosition = SIZE_MAX;
         }
     }
@@ -270,7 +242,7 @@ void ErrorObject::StackTraceData::buildStackTrace(Context* context, StringBuilde
     for (size_t i = 0; i < gcValues.size(); i++) {
         builder.appendString("at ");
         if (nonGCValues[i].byteCodePosition == SIZE_MAX) {
-            builder.appendString(gcValues[i].infoString);
+            builder.appendString(stackTraceInfoString(gcValues[i].codeBlock));
         } else {
             ExtendedNodeLOC loc = gcValues[i].byteCodeBlock->computeNodeLOCFromByteCode(context,
                                                                                         nonGCValues[i].byteCodePosition, gcValues[i].byteCodeBlock->m_codeBlock);
@@ -343,10 +315,7 @@ void SandBox::fillStackDataIntoErrorObject(const Value& e)
         obj->setStackTraceData(data);
 
         ExecutionState state(m_context);
-        JSGetterSetter gs(
-            new NativeFunctionObject(state, NativeFunctionInfo(m_context->staticStrings().stack, builtinErrorObjectStackInfo, 0, NativeFunctionInfo::Strict)),
-            Value(Value::EmptyValue));
-        ObjectPropertyDescriptor desc(gs, ObjectPropertyDescriptor::ConfigurablePresent);
+        ObjectPropertyDescriptor desc(*m_context->globalObject()->errorStackGetterSetterData(), ObjectPropertyDescriptor::ConfigurablePresent);
         obj->defineOwnProperty(state, ObjectPropertyName(m_context->staticStrings().stack), desc);
     }
 }
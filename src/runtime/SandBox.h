@@ -55,7 +55,27 @@ public:
         }
     };
 
-    typedef Vector<std::pair<ExecutionState*, StackTraceData>, GCUtil::gc_malloc_allocator<std::pair<ExecutionState*, StackTraceData>>> StackTraceDataVector;
+    // frame recorded when an exception is thrown.
+    // source location and strings are resolved from it only when a stack trace is requested
+    struct StackTraceRawData {
+        ExecutionState* executionState;
+        CodeBlock* codeBlock;
+        ByteCodeBlock* byteCodeBlock; // nullptr if there is no program counter for this frame
+        size_t byteCodePosition;
+        bool isFunction;
+        bool isConstructor;
+        StackTraceRawData()
+            : executionState(nullptr)
+            , codeBlock(nullptr)
+            , byteCodeBlock(nullptr)
+            , byteCodePosition(SIZE_MAX)
+            , isFunction(false)
+            , isConstructor(false)
+        {
+        }
+    };
+
+    typedef Vector<StackTraceRawData, GCUtil::gc_malloc_allocator<StackTraceRawData>> StackTraceRawDataVector;
 
     struct SandBoxResult {
         Value result;
@@ -77,14 +97,21 @@ public:
         return m_context;
     }
 
+    // no other SandBox is running below this one
+    bool isOutermost()
+    {
+        return !m_oldSandBox;
+    }
+
 protected:
     void processCatch(const Value& error, SandBoxResult& result);
     void fillStackDataIntoErrorObject(const Value& e);
+    StackTraceData symbolicate(const StackTraceRawData& rawData);
 
 private:
     Context* m_context;
     SandBox* m_oldSandBox;
-    StackTraceDataVector m_stackTraceData;
+    StackTraceRawDataVector m_stackTraceData;
     Value m_exception; // To avoid accidential GC of exception value
 };
 }
@@ -45,7 +45,9 @@
 
 #include "Escargot.h"
 #include "String.h"
+#include "StringSearch.h"
 #include "Value.h"
+#include "VMInstance.h"
 
 #include "fast-dtoa.h"
 #include "bignum-dtoa.h"
@@ -104,32 +106,17 @@ bool isAllSpecialCharacters(const std::string& s, bool (*fn)(char))
 
 bool isAllASCII(const char* buf, const size_t len)
 {
-    for (unsigned i = 0; i < len; i++) {
-        if ((buf[i] & 0x80) != 0) {
-            return false;
-        }
-    }
-    return true;
+    return StringConversion::asciiPrefixLength((const LChar*)buf, len) == len;
 }
 
 bool isAllASCII(const char16_t* buf, const size_t len)
 {
-    for (unsigned i = 0; i < len; i++) {
-        if (buf[i] >= 128) {
-            return false;
-        }
-    }
-    return true;
+    return StringConversion::asciiPrefixLength(buf, len) == len;
 }
 
 bool isAllLatin1(const char16_t* buf, const size_t len)
 {
-    for (unsigned i = 0; i < len; i++) {
-        if (buf[i] >= 256) {
-            return false;
-        }
-    }
-    return true;
+    return StringConversion::latin1PrefixLength(buf, len) == len;
 }
 
 bool isIndexString(String* str)
@@ -210,12 +197,28 @@ char32_t readUTF8Sequence(const char*& sequence, bool& valid, int& charlen)
 }
 
 UTF16StringData utf8StringToUTF16String(const char* buf, const size_t len)
+{
+    UTF16StringDataNonGCStd str = utf8StringToUTF16StringNonGC(buf, len);
+    return UTF16StringData(str.data(), str.length());
+}
+
+UTF16StringDataNonGCStd utf8StringToUTF16StringNonGC(const char* buf, const size_t len)
 {
     UTF16StringDataNonGCStd str;
+    str.reserve(len);
     const char* source = buf;
     int charlen;
     bool valid;
     while (source < buf + len) {
+        size_t asciiLength = StringConversion::asciiPrefixLength((const LChar*)source, buf + len - source);
+        if (asciiLength) {
+            size_t oldLength = str.length();
+            str.resize(oldLength + asciiLength);
+            StringConversion::widen((const LChar*)source, &str[oldLength], asciiLength);
+            source += asciiLength;
+            continue;
+        }
+
         char32_t ch = readUTF8Sequence(source, valid, charlen);
         if (!valid) { // Invalid sequence
             str += 0xFFFD;
@@ -235,17 +238,15 @@ UTF16StringData utf8StringToUTF16String(const char* buf, const size_t len)
         }
     }
 
-    return UTF16StringData(str.data(), str.length());
+    return str;
 }
 
 ASCIIStringData utf16StringToASCIIString(const char16_t* buf, const size_t len)
 {
+    ASSERT(isAllASCII(buf, len));
     ASCIIStringData str;
     str.resizeWithUninitializedValues(len);
-    for (unsigned i = 0; i < len; i++) {
-        ASSERT(buf[i] < 128);
-        str[i] = buf[i];
-    }
+    StringConversion::narrow(buf, (LChar*)str.data(), len);
     return ASCIIStringData(std::move(str));
 }
 
@@ -313,14 +314,7 @@ size_t utf32ToUtf8(char32_t uc, char* UTF8)
 
 bool StringBufferAccessData::equals16Bit(const char16_t* c1, const char* c2, size_t len)
 {
-    while (len > 0) {
-        if (*c1++ != *c2++) {
-            return false;
-        }
-        len--;
-    }
-
-    return true;
+    return StringSearch::equals(c1, (const LChar*)c2, len);
 }
 
 UTF16StringData ASCIIString::toUTF16StringData() const
@@ -328,9 +322,7 @@ UTF16StringData ASCIIString::toUTF16StringData() const
     UTF16StringData ret;
     size_t len = length();
     ret.resizeWithUninitializedValues(len);
-    for (size_t i = 0; i < len; i++) {
-        ret[i] = charAt(i);
-    }
+    StringConversion::widen(characters8(), ret.data(), len);
     return ret;
 }
 
@@ -349,44 +341,18 @@ UTF16StringData Latin1String::toUTF16StringData() const
     UTF16StringData ret;
     size_t len = length();
     ret.resizeWithUninitializedValues(len);
-    for (size_t i = 0; i < len; i++) {
-        ret[i] = charAt(i);
-    }
+    StringConversion::widen(characters8(), ret.data(), len);
     return ret;
 }
 
 UTF8StringData Latin1String::toUTF8StringData() const
 {
-    UTF8StringData ret;
-    size_t len = length();
-    for (size_t i = 0; i < len; i++) {
-        uint8_t ch = m_bufferAccessData.uncheckedCharAtFor8Bit(i); /* assume that code points above 0xff are impossible since latin-1 is 8-bit */
-        if (ch < 0x80) {
-            ret.append((char*)&ch, 1);
-        } else {
-            char buf[8];
-            auto len = utf32ToUtf8(ch, buf);
-            ret.append(buf, len);
-        }
-    }
-    return ret;
+    return bufferAccessData().toUTF8String<UTF8StringData, UTF8StringDataNonGCStd>();
 }
 
 UTF8StringDataNonGCStd Latin1String::toNonGCUTF8StringData() const
 {
-    UTF8StringDataNonGCStd ret;
-    size_t len = length();
-    for (size_t i = 0; i < len; i++) {
-        uint8_t ch = m_bufferAccessData.uncheckedCharAtFor8Bit(i); /* assume that code points above 0xff are impossible since latin-1 is 8-bit */
-        if (ch < 0x80) {
-            ret.append((char*)&ch, 1);
-        } else {
-            char buf[8];
-            auto len = utf32ToUtf8(ch, buf);
-            ret.append(buf, len);
-        }
-    }
-    return ret;
+    return bufferAccessData().toUTF8String<UTF8StringDataNonGCStd>();
 }
 
 UTF16StringData UTF16String::toUTF16StringData() const
@@ -581,22 +547,35 @@ String* String::fromUTF8(const char* src, size_t len)
         return new ASCIIString(src, len);
     } else {
         auto s = utf8StringToUTF16String(src, len);
+        if (isAllLatin1(s.data(), s.length())) {
+            Latin1StringData latin1;
+            latin1.resizeWithUninitializedValues(s.length());
+            StringConversion::narrow(s.data(), latin1.data(), s.length());
+            return new Latin1String(std::move(latin1));
+        }
         return new UTF16String(std::move(s));
     }
 }
 
 int String::stringCompare(size_t l1, size_t l2, const String* c1, const String* c2)
 {
-    size_t s = 0;
-    const unsigned lmin = l1 < l2 ? l1 : l2;
-    unsigned pos = 0;
-    while (pos < lmin && c1->charAt(s) == c2->charAt(s)) {
-        ++s;
-        ++pos;
+    const auto& data1 = c1->bufferAccessData();
+    const auto& data2 = c2->bufferAccessData();
+    const size_t lmin = l1 < l2 ? l1 : l2;
+
+    size_t pos;
+    if (data1.has8BitContent && data2.has8BitContent) {
+        pos = StringSearch::mismatch((const LChar*)data1.buffer, (const LChar*)data2.buffer, lmin);
+    } else if (data1.has8BitContent) {
+        pos = StringSearch::mismatch((const char16_t*)data2.buffer, (const LChar*)data1.buffer, lmin);
+    } else if (data2.has8BitContent) {
+        pos = StringSearch::mismatch((const char16_t*)data1.buffer, (const LChar*)data2.buffer, lmin);
+    } else {
+        pos = StringSearch::mismatch((const char16_t*)data1.buffer, (const char16_t*)data2.buffer, lmin);
     }
 
     if (pos < lmin)
-        return (c1->charAt(s) > c2->charAt(s)) ? 1 : -1;
+        return (data1.charAt(pos) > data2.charAt(pos)) ? 1 : -1;
 
     if (l1 == l2)
         return 0;
@@ -616,13 +595,13 @@ bool String::equals(const String* src) const
     bool srcIs8Bit = srcData.has8BitContent;
 
     if (LIKELY(myIs8Bit && srcIs8Bit)) {
-        return stringEqual((const LChar*)myData.buffer, (const LChar*)srcData.buffer, myData.length);
+        return StringSearch::equals((const LChar*)myData.buffer, (const LChar*)srcData.buffer, myData.length);
     } else if (myIs8Bit && !srcIs8Bit) {
-        return stringEqual((const char16_t*)srcData.buffer, (const LChar*)myData.buffer, myData.length);
+        return StringSearch::equals((const char16_t*)srcData.buffer, (const LChar*)myData.buffer, myData.length);
     } else if (!myIs8Bit && srcIs8Bit) {
-        return stringEqual((const char16_t*)myData.buffer, (const LChar*)srcData.buffer, myData.length);
+        return StringSearch::equals((const char16_t*)myData.buffer, (const LChar*)srcData.buffer, myData.length);
     } else {
-        return stringEqual((const char16_t*)myData.buffer, (const char16_t*)srcData.buffer, myData.length);
+        return StringSearch::equals((const char16_t*)myData.buffer, (const char16_t*)srcData.buffer, myData.length);
     }
 }
 
@@ -708,84 +687,83 @@ uint64_t String::tryToUseAsIndex() const
 
 size_t String::find(String* str, size_t pos)
 {
-    const size_t srcStrLen = str->length();
-    const size_t size = length();
-
-    if (srcStrLen == 0)
-        return pos <= size ? pos : SIZE_MAX;
-
-    if (srcStrLen <= size) {
-        char32_t src0 = str->charAt(0);
-        const auto& data = bufferAccessData();
-        if (data.has8BitContent) {
-            for (; pos <= size - srcStrLen; ++pos) {
-                if (((const LChar*)data.buffer)[pos] == src0) {
-                    bool same = true;
-                    for (size_t k = 1; k < srcStrLen; k++) {
-                        if (((const LChar*)data.buffer)[pos + k] != str->charAt(k)) {
-                            same = false;
-                            break;
-                        }
-                    }
-                    if (same)
-                        return pos;
-                }
-            }
-        } else {
-            for (; pos <= size - srcStrLen; ++pos) {
-                if (((const char16_t*)data.buffer)[pos] == src0) {
-                    bool same = true;
-                    for (size_t k = 1; k < srcStrLen; k++) {
-                        if (((const char16_t*)data.buffer)[pos + k] != str->charAt(k)) {
-                            same = false;
-                            break;
-                        }
-                    }
-                    if (same)
-                        return pos;
-                }
-            }
+    const auto& data = bufferAccessData();
+    const auto& srcData = str->bufferAccessData();
+
+    if (data.has8BitContent) {
+        if (srcData.has8BitContent) {
+            return StringSearch::find((const LChar*)data.buffer, data.length, (const LChar*)srcData.buffer, srcData.length, pos);
+        }
+        return StringSearch::find((const LChar*)data.buffer, data.length, (const char16_t*)srcData.buffer, srcData.length, pos);
+    } else {
+        if (srcData.has8BitContent) {
+            return StringSearch::find((const char16_t*)data.buffer, data.length, (const LChar*)srcData.buffer, srcData.length, pos);
         }
+        return StringSearch::find((const char16_t*)data.buffer, data.length, (const char16_t*)srcData.buffer, srcData.length, pos);
     }
-    return SIZE_MAX;
 }
 
 size_t String::rfind(String* str, size_t pos)
 {
-    const size_t srcStrLen = str->length();
-    const size_t size = length();
-    if (srcStrLen == 0)
-        return pos <= size ? pos : -1;
-    if (srcStrLen <= size) {
-        do {
-            bool same = true;
-            if (pos >= size) {
-                continue;
-            }
-            for (size_t k = 0; k < srcStrLen; k++) {
-                if (charAt(pos + k) != str->charAt(k)) {
-                    same = false;
-                    break;
-                }
-            }
-            if (same)
-                return pos;
-        } while (pos-- > 0);
+    const auto& data = bufferAccessData();
+    const auto& srcData = str->bufferAccessData();
+
+    if (data.has8BitContent) {
+        if (srcData.has8BitContent) {
+            return StringSearch::rfind((const LChar*)data.buffer, data.length, (const LChar*)srcData.buffer, srcData.length, pos);
+        }
+        return StringSearch::rfind((const LChar*)data.buffer, data.length, (const char16_t*)srcData.buffer, srcData.length, pos);
+    } else {
+        if (srcData.has8BitContent) {
+            return StringSearch::rfind((const char16_t*)data.buffer, data.length, (const LChar*)srcData.buffer, srcData.length, pos);
+        }
+        return StringSearch::rfind((const char16_t*)data.buffer, data.length, (const char16_t*)srcData.buffer, srcData.length, pos);
     }
-    return SIZE_MAX;
 }
 
 String* String::substring(size_t from, size_t to)
 {
-    if (to - from > STRING_SUB_STRING_MIN_VIEW_LENGTH) {
-        StringView* str = new StringView(this, from, to);
-        return str;
+    if (UNLIKELY(isRopeString())) {
+        return ((RopeString*)this)->substring(from, to);
     }
+
+    const size_t length = to - from;
+    if (length == this->length()) {
+        return this;
+    }
+
+    // view the underlying string directly so that views never chain
+    String* parent = this;
+    if (isStringView()) {
+        StringView* view = (StringView*)this;
+        size_t start = view->start();
+        parent = view->string();
+        from += start;
+        to += start;
+    }
+
+    if (length > STRING_SUB_STRING_MIN_VIEW_LENGTH) {
+        return new StringView(parent, from, to);
+    }
+
     StringBuilder builder;
-    builder.appendSubString(this, from, to);
+    builder.appendSubString(parent, from, to);
     return builder.finalize();
 }
 
+String* String::substring(ExecutionState& state, size_t from, size_t to)
+{
+    String* result = substring(from, to);
+    if (result != this && result->isStringView()) {
+        StringView* view = (StringView*)result;
+        size_t parentLength = view->string()->length();
+        if (parentLength > STRING_SUB_STRING_VIEW_COMPACT_PARENT_LENGTH && view->length() < parentLength / STRING_SUB_STRING_VIEW_MAX_PARENT_RATIO) {
+            state.context()->vmInstance()->trackSmallStringView(view);
+        }
+    }
+    return result;
+}
+
 // https://www.ecma-international.org/ecma-262/6.0/#sec-advancestringindex
 size_t String::advanceStringIndex(size_t index, bool unicode)
 {
@@ -21,6 +21,7 @@
 #define __EscargotString__
 
 #include "runtime/PointerValue.h"
+#include "runtime/StringConversion.h"
 #include "util/BasicString.h"
 #include <string>
 #include "util/Vector.h"
@@ -56,6 +57,8 @@ bool isAllLatin1(const char16_t* buf, const size_t len);
 bool isIndexString(String* str);
 char32_t readUTF8Sequence(const char*& sequence, bool& valid, int& charlen);
 UTF16StringData utf8StringToUTF16String(const char* buf, const size_t len);
+// does not touch GC heap, so it can be called from any thread
+UTF16StringDataNonGCStd utf8StringToUTF16StringNonGC(const char* buf, const size_t len);
 UTF8StringData utf16StringToUTF8String(const char16_t* buf, const size_t len);
 ASCIIStringData utf16StringToASCIIString(const char16_t* buf, const size_t len);
 ASCIIStringData dtoa(double number);
@@ -120,6 +123,31 @@ struct StringBufferAccessData {
         }
     }
 
+    // appends the ASCII code units starting at `start` to the UTF-8 output and returns how many there were
+    template <typename OutputType>
+    size_t appendASCIIPrefix(OutputType& ret, size_t start) const
+    {
+        if (has8BitContent) {
+            const LChar* src = (const LChar*)buffer + start;
+            size_t asciiLength = StringConversion::asciiPrefixLength(src, length - start);
+            if (asciiLength) {
+                ret.append((const char*)src, asciiLength);
+            }
+            return asciiLength;
+        }
+
+        const char16_t* src = (const char16_t*)buffer + start;
+        size_t asciiLength = StringConversion::asciiPrefixLength(src, length - start);
+        LChar chunk[128];
+        for (size_t done = 0; done < asciiLength;) {
+            size_t chunkLength = std::min(asciiLength - done, sizeof(chunk));
+            StringConversion::narrow(src + done, chunk, chunkLength);
+            ret.append((const char*)chunk, chunkLength);
+            done += chunkLength;
+        }
+        return asciiLength;
+    }
+
     template <typename OutputType, typename ComputingType>
     OutputType toUTF8String() const
     {
@@ -133,31 +161,32 @@ struct StringBufferAccessData {
         OutputType ret;
         const auto& accessData = *this;
         for (size_t i = 0; i < accessData.length; i++) {
+            i += appendASCIIPrefix(ret, i);
+            if (i == accessData.length) {
+                break;
+            }
+
             char32_t ch = (uint16_t)accessData.charAt(i);
-            if (ch < 0x80) {
-                ret.append((char*)&ch, 1);
-            } else {
-                char32_t finalCh;
-                if (U16_IS_LEAD(ch)) {
-                    if (i + 1 == accessData.length) {
-                        finalCh = ch;
+            char32_t finalCh;
+            if (U16_IS_LEAD(ch)) {
+                if (i + 1 == accessData.length) {
+                    finalCh = ch;
+                } else {
+                    char16_t c2;
+                    if (U16_IS_TRAIL(c2 = accessData.charAt(i + 1))) {
+                        finalCh = U16_GET_SUPPLEMENTARY(ch, c2);
+                        i++;
                     } else {
-                        char16_t c2;
-                        if (U16_IS_TRAIL(c2 = accessData.charAt(i + 1))) {
-                            finalCh = U16_GET_SUPPLEMENTARY(ch, c2);
-                            i++;
-                        } else {
-                            finalCh = 0xFFFD;
-                        }
+                        finalCh = 0xFFFD;
                     }
-                } else {
-                    finalCh = ch;
                 }
-
-                char buf[8];
-                auto len = utf32ToUtf8(finalCh, buf);
-                ret.append(buf, len);
+            } else {
+                finalCh = ch;
             }
+
+            char buf[8];
+            auto len = utf32ToUtf8(finalCh, buf);
+            ret.append(buf, len);
         }
         return ret;
     }
@@ -183,6 +212,11 @@ public:
         return false;
     }
 
+    virtual bool isStringView()
+    {
+        return false;
+    }
+
     bool has8BitContent() const
     {
         return bufferAccessData().has8BitContent;
@@ -238,6 +272,9 @@ public:
     size_t rfind(String* str, size_t pos);
 
     String* substring(size_t from, size_t to);
+    // also remembers a small view of a large string in the VMInstance, so that it is compacted later.
+    // see STRING_SUB_STRING_VIEW_COMPACT_PARENT_LENGTH
+    String* substring(ExecutionState& state, size_t from, size_t to);
 
     template <typename T>
     static inline size_t stringHash(T* src, size_t length)
@@ -332,22 +369,6 @@ private:
 protected:
     StringBufferAccessData m_bufferAccessData;
     static int stringCompare(size_t l1, size_t l2, const String* c1, const String* c2);
-
-    template <typename T>
-    static ALWAYS_INLINE bool stringEqual(const T* s, const T* s1, const size_t len)
-    {
-        return memcmp(s, s1, sizeof(T) * len) == 0;
-    }
-
-    static ALWAYS_INLINE bool stringEqual(const char16_t* s, const LChar* s1, const size_t len)
-    {
-        for (size_t i = 0; i < len; i++) {
-            if (s[i] != s1[i]) {
-                return false;
-            }
-        }
-        return true;
-    }
 };
 
 inline bool operator<(const String& a, const String& b)
@@ -540,6 +561,11 @@ public:
     void* operator new[](size_t size) = delete;
 
 protected:
+    // for subclasses which set up m_bufferAccessData by themselves
+    Latin1String()
+        : String()
+    {
+    }
 };
 
 class UTF16String : public String {
@@ -603,6 +629,11 @@ public:
     void* operator new[](size_t size) = delete;
 
 protected:
+    // for subclasses which set up m_bufferAccessData by themselves
+    UTF16String()
+        : String()
+    {
+    }
 };
 
 inline String* String::fromCharCode(char32_t code)
@@ -0,0 +1,544 @@
+/*
+ * Copyright (c) 2016-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#include "Escargot.h"
+#include "StringConversion.h"
+
+#if (defined(COMPILER_GCC) || defined(COMPILER_CLANG)) && defined(__SSE2__)
+#define ESCARGOT_STRING_CONVERSION_USE_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace Escargot {
+
+#if defined(ESCARGOT_STRING_CONVERSION_USE_SSE2)
+static ALWAYS_INLINE size_t firstSetBit(uint32_t mask)
+{
+    return __builtin_ctz(mask);
+}
+
+static ALWAYS_INLINE size_t lastSetBit(uint32_t mask)
+{
+    return 31 - __builtin_clz(mask);
+}
+
+// lanes are compared as signed values, so bytes >= 0x80 and code units >= 0x8000 never fall in [lo, hi]
+static ALWAYS_INLINE __m128i inRange8(__m128i v, char lo, char hi)
+{
+    return _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(lo - 1)), _mm_cmplt_epi8(v, _mm_set1_epi8(hi + 1)));
+}
+
+static ALWAYS_INLINE __m128i inRange16(__m128i v, char16_t lo, char16_t hi)
+{
+    return _mm_and_si128(_mm_cmpgt_epi16(v, _mm_set1_epi16(lo - 1)), _mm_cmplt_epi16(v, _mm_set1_epi16(hi + 1)));
+}
+
+static ALWAYS_INLINE uint32_t whitespaceMask8(__m128i v)
+{
+    return _mm_movemask_epi8(_mm_or_si128(inRange8(v, 0x09, 0x0D), _mm_cmpeq_epi8(v, _mm_set1_epi8(0x20))));
+}
+
+static ALWAYS_INLINE uint32_t whitespaceMask16(__m128i v)
+{
+    return _mm_movemask_epi8(_mm_or_si128(inRange16(v, 0x09, 0x0D), _mm_cmpeq_epi16(v, _mm_set1_epi16(0x20))));
+}
+
+// bytes that are '"', '\\' or below 0x20
+static ALWAYS_INLINE uint32_t jsonSpecialMask8(__m128i v)
+{
+    __m128i control = _mm_cmpeq_epi8(_mm_min_epu8(v, _mm_set1_epi8(0x1F)), v);
+    __m128i quoteOrBackslash = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('"')), _mm_cmpeq_epi8(v, _mm_set1_epi8('\\')));
+    return _mm_movemask_epi8(_mm_or_si128(control, quoteOrBackslash));
+}
+
+static ALWAYS_INLINE uint32_t jsonSpecialMask16(__m128i v)
+{
+    __m128i control = _mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16((short)0xFFE0)), _mm_setzero_si128());
+    __m128i quoteOrBackslash = _mm_or_si128(_mm_cmpeq_epi16(v, _mm_set1_epi16('"')), _mm_cmpeq_epi16(v, _mm_set1_epi16('\\')));
+    return _mm_movemask_epi8(_mm_or_si128(control, quoteOrBackslash));
+}
+
+// bytes that are [A-Za-z0-9$_]
+static ALWAYS_INLINE uint32_t identifierPartMask8(__m128i v)
+{
+    __m128i alpha = inRange8(_mm_or_si128(v, _mm_set1_epi8(0x20)), 'a', 'z');
+    __m128i digitOrSign = _mm_or_si128(inRange8(v, '0', '9'), _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('$')), _mm_cmpeq_epi8(v, _mm_set1_epi8('_'))));
+    return _mm_movemask_epi8(_mm_or_si128(alpha, digitOrSign));
+}
+
+static ALWAYS_INLINE uint32_t identifierPartMask16(__m128i v)
+{
+    __m128i alpha = inRange16(_mm_or_si128(v, _mm_set1_epi16(0x20)), 'a', 'z');
+    __m128i digitOrSign = _mm_or_si128(inRange16(v, '0', '9'), _mm_or_si128(_mm_cmpeq_epi16(v, _mm_set1_epi16('$')), _mm_cmpeq_epi16(v, _mm_set1_epi16('_'))));
+    return _mm_movemask_epi8(_mm_or_si128(alpha, digitOrSign));
+}
+
+static ALWAYS_INLINE uint32_t blankMask8(__m128i v)
+{
+    __m128i tabOrSpace = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(0x09)), _mm_cmpeq_epi8(v, _mm_set1_epi8(0x20)));
+    return _mm_movemask_epi8(_mm_or_si128(tabOrSpace, inRange8(v, 0x0B, 0x0C)));
+}
+
+static ALWAYS_INLINE uint32_t blankMask16(__m128i v)
+{
+    __m128i tabOrSpace = _mm_or_si128(_mm_cmpeq_epi16(v, _mm_set1_epi16(0x09)), _mm_cmpeq_epi16(v, _mm_set1_epi16(0x20)));
+    return _mm_movemask_epi8(_mm_or_si128(tabOrSpace, inRange16(v, 0x0B, 0x0C)));
+}
+
+// bytes that are '\n', '\r', stop1 or stop2
+static ALWAYS_INLINE uint32_t lineTerminatorOrStopMask8(__m128i v, __m128i stop1, __m128i stop2)
+{
+    __m128i newline = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\n')), _mm_cmpeq_epi8(v, _mm_set1_epi8('\r')));
+    __m128i stop = _mm_or_si128(_mm_cmpeq_epi8(v, stop1), _mm_cmpeq_epi8(v, stop2));
+    return _mm_movemask_epi8(_mm_or_si128(newline, stop));
+}
+
+// code units that are '\n', '\r', U+2028, U+2029, stop1 or stop2
+static ALWAYS_INLINE uint32_t lineTerminatorOrStopMask16(__m128i v, __m128i stop1, __m128i stop2)
+{
+    __m128i newline = _mm_or_si128(_mm_cmpeq_epi16(v, _mm_set1_epi16('\n')), _mm_cmpeq_epi16(v, _mm_set1_epi16('\r')));
+    __m128i separator = _mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16((short)0xFFFE)), _mm_set1_epi16(0x2028));
+    __m128i stop = _mm_or_si128(_mm_cmpeq_epi16(v, stop1), _mm_cmpeq_epi16(v, stop2));
+    return _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(newline, separator), stop));
+}
+
+// bit set for each byte of a 16-bit lane that has any bit of `bits` set
+static ALWAYS_INLINE uint32_t hasBitsMask16(__m128i v, short bits)
+{
+    return _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16(bits)), _mm_setzero_si128())) ^ 0xFFFF;
+}
+#endif
+
+static ALWAYS_INLINE bool isASCIIWhitespace(char16_t c)
+{
+    return c == 0x20 || (c >= 0x09 && c <= 0x0D);
+}
+
+static ALWAYS_INLINE bool isJSONSpecialCharacter(char16_t c)
+{
+    return c < 0x20 || c == '"' || c == '\\';
+}
+
+static ALWAYS_INLINE bool isASCIIIdentifierPart(char16_t c)
+{
+    char16_t lower = c | 0x20;
+    return (lower >= 'a' && lower <= 'z') || (c >= '0' && c <= '9') || c == '$' || c == '_';
+}
+
+static ALWAYS_INLINE bool isASCIIBlank(char16_t c)
+{
+    return c == 0x20 || c == 0x09 || c == 0x0B || c == 0x0C;
+}
+
+static ALWAYS_INLINE bool isLineTerminatorOrStop(char16_t c, char16_t stop1, char16_t stop2)
+{
+    return c == '\n' || c == '\r' || (c & 0xFFFE) == 0x2028 || c == stop1 || c == stop2;
+}
+
+size_t StringConversion::asciiPrefixLength(const LChar* s, size_t len)
+{
+    size_t i = 0;
+#if defined(ESCARGOT_STRING_CONVERSION_USE_SSE2)
+    for (; i + 16 <= len; i += 16) {
+        uint32_t mask = _mm_movemask_epi8(_mm_loadu_si128((const __m128i*)(s + i)));
+        if (mask) {
+            return i + firstSetBit(mask);
+        }
+    }
+#endif
+    for (; i < len; i++) {
+        if (s[i] >= 0x80) {
+            break;
+        }
+    }
+    return i;
+}
+
+size_t StringConversion::asciiPrefixLength(const char16_t* s, size_t len)
+{
+    size_t i = 0;
+#if defined(ESCARGOT_STRING_CONVERSION_USE_SSE2)
+    for (; i + 8 <= len; i += 8) {
+        uint32_t mask = hasBitsMask16(_mm_loadu_si128((const __m128i*)(s + i)), (short)0xFF80);
+        if (mask) {
+            return i + firstSetBit(mask) / 2;
+        }
+    }
+#endif
+    for (; i < len; i++) {
+        if (s[i] >= 0x80) {
+            break;
+        }
+    }
+    return i;
+}
+
+size_t StringConversion::latin1PrefixLength(const char16_t* s, size_t len)
+{
+    size_t i = 0;
+#if defined(ESCARGOT_STRING_CONVERSION_USE_SSE2)
+    for (; i + 8 <= len; i += 8) {
+        uint32_t mask = hasBitsMask16(_mm_loadu_si128((const __m128i*)(s + i)), (short)0xFF00);
+        if (mask) {
+            return i + firstSetBit(mask) / 2;
+        }
+    }
+#endif
+    for (; i < len; i++) {
+        if (s[i] >= 0x100) {
+            break;
+        }
+    }
+    return i;
+}
+
+void StringConversion::widen(const LChar* src, char16_t* dst, size_t len)
+{
+    size_t i = 0;
+#if defined(ESCARGOT_STRING_CONVERSION_USE_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= len; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(src + i));
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_unpacklo_epi8(v, zero));
+        _mm_storeu_si128((__m128i*)(dst + i + 8), _mm_unpackhi_epi8(v, zero));
+    }
+#endif
+    for (; i < len; i++) {
+        dst[i] = src[i];
+    }
+}
+
+void StringConversion::narrow(const char16_t* src, LChar* dst, size_t len)
+{
+    size_t i = 0;
+#if defined(ESCARGOT_STRING_CONVERSION_USE_SSE2)
+    for (; i + 16 <= len; i += 16) {
+        __m128i lo = _mm_loadu_si128((const __m128i*)(src + i));
+        __m128i hi = _mm_loadu_si128((const __m128i*)(src + i + 8));
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi16(lo, hi));
+    }
+#endif
+    for (; i < len; i++) {
+        ASSERT(src[i] < 0x100);
+        dst[i] = (LChar)src[i];
+    }
+}
+
+template <char from, char to>
+static size_t convertCaseASCII(const LChar* src, LChar* dst, size_t len)
+{
+    size_t i = 0;
+#if defined(ESCARGOT_STRING_CONVERSION_USE_SSE2)
+    const __m128i delta = _mm_set1_epi8((char)(to - from));
+    for (; i + 16 <= len; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(src + i));
+        if (_mm_movemask_epi8(v)) {
+            break;
+        }
+        v = _mm_add_epi8(v, _mm_and_si128(inRange8(v, from, from + 25), delta));
+        _mm_storeu_si128((__m128i*)(dst + i), v);
+    }
+#endif
+    for (; i < len; i++) {
+        LChar c = src[i];
+        if (c >= 0x80) {
+            break;
+        }
+        dst[i] = (c >= from && c <= from + 25) ? (LChar)(c + (to - from)) : c;
+    }
+    return i;
+}
+
+template <char from, char to>
+static size_t convertCaseASCII(const char16_t* src, char16_t* dst, size_t len)
+{
+    size_t i = 0;
+#if defined(ESCARGOT_STRING_CONVERSION_USE_SSE2)
+    const __m128i delta = _mm_set1_epi16((short)(to - from));
+    for (; i + 8 <= len; i += 8) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(src + i));
+        if (hasBitsMask16(v, (short)0xFF80)) {
+            break;
+        }
+        v = _mm_add_epi16(v, _mm_and_si128(inRange16(v, from, from + 25), delta));
+        _mm_storeu_si128((__m128i*)(dst + i), v);
+    }
+#endif
+    for (; i < len; i++) {
+        char16_t c = src[i];
+        if (c >= 0x80) {
+            break;
+        }
+        dst[i] = (c >= from && c <= from + 25) ? (char16_t)(c + (to - from)) : c;
+    }
+    return i;
+}
+
+size_t StringConversion::toLowerASCII(const LChar* src, LChar* dst, size_t len)
+{
+    return convertCaseASCII<'A', 'a'>(src, dst, len);
+}
+
+size_t StringConversion::toLowerASCII(const char16_t* src, char16_t* dst, size_t len)
+{
+    return convertCaseASCII<'A', 'a'>(src, dst, len);
+}
+
+size_t StringConversion::toUpperASCII(const LChar* src, LChar* dst, size_t len)
+{
+    return convertCaseASCII<'a', 'A'>(src, dst, len);
+}
+
+size_t StringConversion::toUpperASCII(const char16_t* src, char16_t* dst, size_t len)
+{
+    return convertCaseASCII<'a', 'A'>(src, dst, len);
+}
+
+size_t StringConversion::asciiWhitespacePrefixLength(const LChar* s, size_t len)
+{
+    size_t i = 0;
+#if defined(ESCARGOT_STRING_CONVERSION_USE_SSE2)
+    for (; i + 16 <= len; i += 16) {
+        uint32_t mask = whitespaceMask8(_mm_loadu_si128((const __m128i*)(s + i))) ^ 0xFFFF;
+        if (mask) {
+            return i + firstSetBit(mask);
+        }
+    }
+#endif
+    for (; i < len; i++) {
+        if (!isASCIIWhitespace(s[i])) {
+            break;
+        }
+    }
+    return i;
+}
+
+size_t StringConversion::asciiWhitespacePrefixLength(const char16_t* s, size_t len)
+{
+    size_t i = 0;
+#if defined(ESCARGOT_STRING_CONVERSION_USE_SSE2)
+    for (; i + 8 <= len; i += 8) {
+        uint32_t mask = whitespaceMask16(_mm_loadu_si128((const __m128i*)(s + i))) ^ 0xFFFF;
+        if (mask) {
+            return i + firstSetBit(mask) / 2;
+        }
+    }
+#endif
+    for (; i < len; i++) {
+        if (!isASCIIWhitespace(s[i])) {
+            break;
+        }
+    }
+    return i;
+}
+
+size_t StringConversion::asciiWhitespaceSuffixLength(const LChar* s, size_t len)
+{
+    size_t i = len;
+#if defined(ESCARGOT_STRING_CONVERSION_USE_SSE2)
+    for (; i >= 16; i -= 16) {
+        uint32_t mask = whitespaceMask8(_mm_loadu_si128((const __m128i*)(s + i - 16))) ^ 0xFFFF;
+        if (mask) {
+            return len - (i - 16 + lastSetBit(mask)) - 1;
+        }
+    }
+#endif
+    for (; i > 0; i--) {
+        if (!isASCIIWhitespace(s[i - 1])) {
+            break;
+        }
+    }
+    return len - i;
+}
+
+size_t StringConversion::asciiWhitespaceSuffixLength(const char16_t* s, size_t len)
+{
+    size_t i = len;
+#if defined(ESCARGOT_STRING_CONVERSION_USE_SSE2)
+    for (; i >= 8; i -= 8) {
+        uint32_t mask = whitespaceMask16(_mm_loadu_si128((const __m128i*)(s + i - 8))) ^ 0xFFFF;
+        if (mask) {
+            return len - (i - 8 + lastSetBit(mask) / 2) - 1;
+        }
+    }
+#endif
+    for (; i > 0; i--) {
+        if (!isASCIIWhitespace(s[i - 1])) {
+            break;
+        }
+    }
+    return len - i;
+}
+
+size_t StringConversion::jsonPlainPrefixLength(const LChar* s, size_t len)
+{
+    size_t i = 0;
+#if defined(ESCARGOT_STRING_CONVERSION_USE_SSE2)
+    for (; i + 16 <= len; i += 16) {
+        uint32_t mask = jsonSpecialMask8(_mm_loadu_si128((const __m128i*)(s + i)));
+        if (mask) {
+            return i + firstSetBit(mask);
+        }
+    }
+#endif
+    for (; i < len; i++) {
+        if (isJSONSpecialCharacter(s[i])) {
+            break;
+        }
+    }
+    return i;
+}
+
+size_t StringConversion::jsonPlainPrefixLength(const char16_t* s, size_t len)
+{
+    size_t i = 0;
+#if defined(ESCARGOT_STRING_CONVERSION_USE_SSE2)
+    for (; i + 8 <= len; i += 8) {
+        uint32_t mask = jsonSpecialMask16(_mm_loadu_si128((const __m128i*)(s + i)));
+        if (mask) {
+            return i + firstSetBit(mask) / 2;
+        }
+    }
+#endif
+    for (; i < len; i++) {
+        if (isJSONSpecialCharacter(s[i])) {
+            break;
+        }
+    }
+    return i;
+}
+
+size_t StringConversion::asciiIdentifierPartPrefixLength(const LChar* s, size_t len)
+{
+    size_t i = 0;
+#if defined(ESCARGOT_STRING_CONVERSION_USE_SSE2)
+    for (; i + 16 <= len; i += 16) {
+        uint32_t mask = identifierPartMask8(_mm_loadu_si128((const __m128i*)(s + i))) ^ 0xFFFF;
+        if (mask) {
+            return i + firstSetBit(mask);
+        }
+    }
+#endif
+    for (; i < len; i++) {
+        if (!isASCIIIdentifierPart(s[i])) {
+            break;
+        }
+    }
+    return i;
+}
+
+size_t StringConversion::asciiIdentifierPartPrefixLength(const char16_t* s, size_t len)
+{
+    size_t i = 0;
+#if defined(ESCARGOT_STRING_CONVERSION_USE_SSE2)
+    for (; i + 8 <= len; i += 8) {
+        uint32_t mask = identifierPartMask16(_mm_loadu_si128((const __m128i*)(s + i))) ^ 0xFFFF;
+        if (mask) {
+            return i + firstSetBit(mask) / 2;
+        }
+    }
+#endif
+    for (; i < len; i++) {
+        if (!isASCIIIdentifierPart(s[i])) {
+            break;
+        }
+    }
+    return i;
+}
+
+size_t StringConversion::asciiBlankPrefixLength(const LChar* s, size_t len)
+{
+    size_t i = 0;
+#if defined(ESCARGOT_STRING_CONVERSION_USE_SSE2)
+    for (; i + 16 <= len; i += 16) {
+        uint32_t mask = blankMask8(_mm_loadu_si128((const __m128i*)(s + i))) ^ 0xFFFF;
+        if (mask) {
+            return i + firstSetBit(mask);
+        }
+    }
+#endif
+    for (; i < len; i++) {
+        if (!isASCIIBlank(s[i])) {
+            break;
+        }
+    }
+    return i;
+}
+
+size_t StringConversion::asciiBlankPrefixLength(const char16_t* s, size_t len)
+{
+    size_t i = 0;
+#if defined(ESCARGOT_STRING_CONVERSION_USE_SSE2)
+    for (; i + 8 <= len; i += 8) {
+        uint32_t mask = blankMask16(_mm_loadu_si128((const __m128i*)(s + i))) ^ 0xFFFF;
+        if (mask) {
+            return i + firstSetBit(mask) / 2;
+        }
+    }
+#endif
+    for (; i < len; i++) {
+        if (!isASCIIBlank(s[i])) {
+            break;
+        }
+    }
+    return i;
+}
+
+size_t StringConversion::lineTerminatorFreePrefixLength(const LChar* s, size_t len, char stop1, char stop2)
+{
+    size_t i = 0;
+#if defined(ESCARGOT_STRING_CONVERSION_USE_SSE2)
+    const __m128i stopVector1 = _mm_set1_epi8(stop1);
+    const __m128i stopVector2 = _mm_set1_epi8(stop2);
+    for (; i + 16 <= len; i += 16) {
+        uint32_t mask = lineTerminatorOrStopMask8(_mm_loadu_si128((const __m128i*)(s + i)), stopVector1, stopVector2);
+        if (mask) {
+            return i + firstSetBit(mask);
+        }
+    }
+#endif
+    for (; i < len; i++) {
+        if (isLineTerminatorOrStop(s[i], stop1, stop2)) {
+            break;
+        }
+    }
+    return i;
+}
+
+size_t StringConversion::lineTerminatorFreePrefixLength(const char16_t* s, size_t len, char stop1, char stop2)
+{
+    size_t i = 0;
+#if defined(ESCARGOT_STRING_CONVERSION_USE_SSE2)
+    const __m128i stopVector1 = _mm_set1_epi16(stop1);
+    const __m128i stopVector2 = _mm_set1_epi16(stop2);
+    for (; i + 8 <= len; i += 8) {
+        uint32_t mask = lineTerminatorOrStopMask16(_mm_loadu_si128((const __m128i*)(s + i)), stopVector1, stopVector2);
+        if (mask) {
+            return i + firstSetBit(mask) / 2;
+        }
+    }
+#endif
+    for (; i < len; i++) {
+        if (isLineTerminatorOrStop(s[i], stop1, stop2)) {
+            break;
+        }
+    }
+    return i;
+}
+} // namespace Escargot
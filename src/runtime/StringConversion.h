@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2016-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#ifndef __EscargotStringConversion__
+#define __EscargotStringConversion__
+
+namespace Escargot {
+
+typedef unsigned char LChar;
+
+// Bulk kernels for the ASCII/Latin1 parts of case mapping, trimming, transcoding and lexing.
+// They use SSE2 on x86 when the compiler targets it and scalar loops elsewhere.
+// Callers handle everything outside the ASCII (or Latin1) range with the existing per-character code.
+class StringConversion {
+public:
+    // number of leading code units below 0x80
+    static size_t asciiPrefixLength(const LChar* s, size_t len);
+    static size_t asciiPrefixLength(const char16_t* s, size_t len);
+    // number of leading code units below 0x100
+    static size_t latin1PrefixLength(const char16_t* s, size_t len);
+
+    // Latin1 -> UTF-16 zero extension
+    static void widen(const LChar* src, char16_t* dst, size_t len);
+    // UTF-16 -> Latin1 truncation; every code unit must be below 0x100
+    static void narrow(const char16_t* src, LChar* dst, size_t len);
+
+    // Converts the leading ASCII code units of src into dst (src == dst is allowed)
+    // and returns how many were converted. Conversion stops at the first non-ASCII code unit.
+    static size_t toLowerASCII(const LChar* src, LChar* dst, size_t len);
+    static size_t toLowerASCII(const char16_t* src, char16_t* dst, size_t len);
+    static size_t toUpperASCII(const LChar* src, LChar* dst, size_t len);
+    static size_t toUpperASCII(const char16_t* src, char16_t* dst, size_t len);
+
+    // number of leading/trailing code units in \t \n \v \f \r and space
+    static size_t asciiWhitespacePrefixLength(const LChar* s, size_t len);
+    static size_t asciiWhitespacePrefixLength(const char16_t* s, size_t len);
+    static size_t asciiWhitespaceSuffixLength(const LChar* s, size_t len);
+    static size_t asciiWhitespaceSuffixLength(const char16_t* s, size_t len);
+
+    // number of leading code units that appear unescaped inside a JSON string literal
+    // (everything except '"', '\\' and code units below 0x20)
+    static size_t jsonPlainPrefixLength(const LChar* s, size_t len);
+    static size_t jsonPlainPrefixLength(const char16_t* s, size_t len);
+
+    // number of leading code units in [A-Za-z0-9$_]
+    static size_t asciiIdentifierPartPrefixLength(const LChar* s, size_t len);
+    static size_t asciiIdentifierPartPrefixLength(const char16_t* s, size_t len);
+
+    // number of leading code units in \t \v \f and space (ASCII whitespace that does not end a line)
+    static size_t asciiBlankPrefixLength(const LChar* s, size_t len);
+    static size_t asciiBlankPrefixLength(const char16_t* s, size_t len);
+
+    // number of leading code units before the first line terminator (\n \r U+2028 U+2029), stop1 or stop2
+    // the lexer uses this to skip comment bodies and plain runs of string literals
+    static size_t lineTerminatorFreePrefixLength(const LChar* s, size_t len, char stop1, char stop2);
+    static size_t lineTerminatorFreePrefixLength(const char16_t* s, size_t len, char stop1, char stop2);
+};
+} // namespace Escargot
+
+#endif
@@ -0,0 +1,426 @@
+/*
+ * Copyright (c) 2016-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#include "Escargot.h"
+#include "StringSearch.h"
+
+#if (defined(COMPILER_GCC) || defined(COMPILER_CLANG)) && defined(__SSE2__)
+#define ESCARGOT_STRING_SEARCH_USE_SSE2
+#include <emmintrin.h>
+#if defined(__AVX2__)
+#define ESCARGOT_STRING_SEARCH_USE_AVX2
+#include <immintrin.h>
+#endif
+#endif
+
+namespace Escargot {
+
+// needles shorter than this always use first-character scanning
+#define STRING_SEARCH_HORSPOOL_MIN_NEEDLE_LENGTH 8
+
+#if defined(ESCARGOT_STRING_SEARCH_USE_SSE2)
+static ALWAYS_INLINE size_t firstSetBit(uint32_t mask)
+{
+    return __builtin_ctz(mask);
+}
+
+static ALWAYS_INLINE size_t lastSetBit(uint32_t mask)
+{
+    return 31 - __builtin_clz(mask);
+}
+
+// zero-extends 8 Latin1 characters into 8 UTF-16 lanes
+static ALWAYS_INLINE __m128i loadLatin1As16Bit(const LChar* s)
+{
+    return _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)s), _mm_setzero_si128());
+}
+#endif
+
+size_t StringSearch::findChar(const LChar* s, size_t len, char16_t ch)
+{
+    if (ch > 0xFF) {
+        return SIZE_MAX;
+    }
+
+    size_t i = 0;
+#if defined(ESCARGOT_STRING_SEARCH_USE_AVX2)
+    const __m256i wideNeedle = _mm256_set1_epi8((char)ch);
+    for (; i + 32 <= len; i += 32) {
+        __m256i chunk = _mm256_loadu_si256((const __m256i*)(s + i));
+        uint32_t mask = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, wideNeedle));
+        if (mask) {
+            return i + firstSetBit(mask);
+        }
+    }
+#endif
+#if defined(ESCARGOT_STRING_SEARCH_USE_SSE2)
+    const __m128i needle = _mm_set1_epi8((char)ch);
+    for (; i + 16 <= len; i += 16) {
+        __m128i chunk = _mm_loadu_si128((const __m128i*)(s + i));
+        uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, needle));
+        if (mask) {
+            return i + firstSetBit(mask);
+        }
+    }
+#endif
+    for (; i < len; i++) {
+        if (s[i] == ch) {
+            return i;
+        }
+    }
+    return SIZE_MAX;
+}
+
+size_t StringSearch::findChar(const char16_t* s, size_t len, char16_t ch)
+{
+    size_t i = 0;
+#if defined(ESCARGOT_STRING_SEARCH_USE_AVX2)
+    const __m256i wideNeedle = _mm256_set1_epi16((short)ch);
+    for (; i + 16 <= len; i += 16) {
+        __m256i chunk = _mm256_loadu_si256((const __m256i*)(s + i));
+        uint32_t mask = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi16(chunk, wideNeedle));
+        if (mask) {
+            return i + firstSetBit(mask) / 2;
+        }
+    }
+#endif
+#if defined(ESCARGOT_STRING_SEARCH_USE_SSE2)
+    const __m128i needle = _mm_set1_epi16((short)ch);
+    for (; i + 8 <= len; i += 8) {
+        __m128i chunk = _mm_loadu_si128((const __m128i*)(s + i));
+        uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi16(chunk, needle));
+        if (mask) {
+            return i + firstSetBit(mask) / 2;
+        }
+    }
+#endif
+    for (; i < len; i++) {
+        if (s[i] == ch) {
+            return i;
+        }
+    }
+    return SIZE_MAX;
+}
+
+size_t StringSearch::findLastChar(const LChar* s, size_t len, char16_t ch)
+{
+    if (ch > 0xFF) {
+        return SIZE_MAX;
+    }
+
+    size_t i = len;
+#if defined(ESCARGOT_STRING_SEARCH_USE_SSE2)
+    const __m128i needle = _mm_set1_epi8((char)ch);
+    for (; i >= 16; i -= 16) {
+        __m128i chunk = _mm_loadu_si128((const __m128i*)(s + i - 16));
+        uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, needle));
+        if (mask) {
+            return i - 16 + lastSetBit(mask);
+        }
+    }
+#endif
+    while (i > 0) {
+        i--;
+        if (s[i] == ch) {
+            return i;
+        }
+    }
+    return SIZE_MAX;
+}
+
+size_t StringSearch::findLastChar(const char16_t* s, size_t len, char16_t ch)
+{
+    size_t i = len;
+#if defined(ESCARGOT_STRING_SEARCH_USE_SSE2)
+    const __m128i needle = _mm_set1_epi16((short)ch);
+    for (; i >= 8; i -= 8) {
+        __m128i chunk = _mm_loadu_si128((const __m128i*)(s + i - 8));
+        uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi16(chunk, needle));
+        if (mask) {
+            return i - 8 + lastSetBit(mask) / 2;
+        }
+    }
+#endif
+    while (i > 0) {
+        i--;
+        if (s[i] == ch) {
+            return i;
+        }
+    }
+    return SIZE_MAX;
+}
+
+bool StringSearch::equals(const LChar* a, const LChar* b, size_t len)
+{
+    // the platform memcmp is already vectorized for same-width buffers
+    return memcmp(a, b, len) == 0;
+}
+
+bool StringSearch::equals(const char16_t* a, const char16_t* b, size_t len)
+{
+    return memcmp(a, b, sizeof(char16_t) * len) == 0;
+}
+
+bool StringSearch::equals(const char16_t* a, const LChar* b, size_t len)
+{
+    return mismatch(a, b, len) == len;
+}
+
+size_t StringSearch::mismatch(const LChar* a, const LChar* b, size_t len)
+{
+    size_t i = 0;
+#if defined(ESCARGOT_STRING_SEARCH_USE_AVX2)
+    for (; i + 32 <= len; i += 32) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+        uint32_t mask = ~(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y));
+        if (mask) {
+            return i + firstSetBit(mask);
+        }
+    }
+#endif
+#if defined(ESCARGOT_STRING_SEARCH_USE_SSE2)
+    for (; i + 16 <= len; i += 16) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(b + i));
+        uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(x, y)) ^ 0xFFFF;
+        if (mask) {
+            return i + firstSetBit(mask);
+        }
+    }
+#endif
+    for (; i < len; i++) {
+        if (a[i] != b[i]) {
+            return i;
+        }
+    }
+    return len;
+}
+
+size_t StringSearch::mismatch(const char16_t* a, const char16_t* b, size_t len)
+{
+    size_t i = 0;
+#if defined(ESCARGOT_STRING_SEARCH_USE_AVX2)
+    for (; i + 16 <= len; i += 16) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+        uint32_t mask = ~(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi16(x, y));
+        if (mask) {
+            return i + firstSetBit(mask) / 2;
+        }
+    }
+#endif
+#if defined(ESCARGOT_STRING_SEARCH_USE_SSE2)
+    for (; i + 8 <= len; i += 8) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(b + i));
+        uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi16(x, y)) ^ 0xFFFF;
+        if (mask) {
+            return i + firstSetBit(mask) / 2;
+        }
+    }
+#endif
+    for (; i < len; i++) {
+        if (a[i] != b[i]) {
+            return i;
+        }
+    }
+    return len;
+}
+
+size_t StringSearch::mismatch(const char16_t* a, const LChar* b, size_t len)
+{
+    size_t i = 0;
+#if defined(ESCARGOT_STRING_SEARCH_USE_SSE2)
+    for (; i + 8 <= len; i += 8) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i y = loadLatin1As16Bit(b + i);
+        uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi16(x, y)) ^ 0xFFFF;
+        if (mask) {
+            return i + firstSetBit(mask) / 2;
+        }
+    }
+#endif
+    for (; i < len; i++) {
+        if (a[i] != b[i]) {
+            return i;
+        }
+    }
+    return len;
+}
+
+static ALWAYS_INLINE size_t mismatchOf(const LChar* a, const LChar* b, size_t len)
+{
+    return StringSearch::mismatch(a, b, len);
+}
+
+static ALWAYS_INLINE size_t mismatchOf(const char16_t* a, const char16_t* b, size_t len)
+{
+    return StringSearch::mismatch(a, b, len);
+}
+
+static ALWAYS_INLINE size_t mismatchOf(const char16_t* a, const LChar* b, size_t len)
+{
+    return StringSearch::mismatch(a, b, len);
+}
+
+static ALWAYS_INLINE size_t mismatchOf(const LChar* a, const char16_t* b, size_t len)
+{
+    return StringSearch::mismatch(b, a, len);
+}
+
+// Boyer-Moore-Horspool with the bad character table keyed by the low byte of each code unit.
+// Code units sharing a low byte share the smallest shift, which keeps the shift safe for 16-bit content.
+template <typename HaystackChar, typename NeedleChar>
+static size_t horspoolFind(const HaystackChar* haystack, size_t haystackLength, const NeedleChar* needle, size_t needleLength, size_t from)
+{
+    ASSERT(needleLength >= 2 && needleLength <= haystackLength);
+    const size_t last = haystackLength - needleLength;
+    const size_t lastIndexOfNeedle = needleLength - 1;
+
+    size_t shift[256];
+    for (size_t i = 0; i < 256; i++) {
+        shift[i] = needleLength;
+    }
+    for (size_t i = 0; i < lastIndexOfNeedle; i++) {
+        shift[needle[i] & 0xFF] = lastIndexOfNeedle - i;
+    }
+
+    const NeedleChar lastChar = needle[lastIndexOfNeedle];
+    size_t pos = from;
+    while (pos <= last) {
+        HaystackChar c = haystack[pos + lastIndexOfNeedle];
+        if (c == lastChar && mismatchOf(haystack + pos, needle, lastIndexOfNeedle) == lastIndexOfNeedle) {
+            return pos;
+        }
+        pos += shift[c & 0xFF];
+    }
+    return SIZE_MAX;
+}
+
+// Scans for the first character of the needle with the vectorized findChar, then verifies the candidate.
+// When verification keeps failing after long partial matches, the remaining range is searched with Horspool.
+template <typename HaystackChar, typename NeedleChar>
+static size_t findImpl(const HaystackChar* haystack, size_t haystackLength, const NeedleChar* needle, size_t needleLength, size_t from)
+{
+    if (needleLength == 0) {
+        return from <= haystackLength ? from : SIZE_MAX;
+    }
+    if (needleLength > haystackLength || from > haystackLength - needleLength) {
+        return SIZE_MAX;
+    }
+
+    const size_t last = haystackLength - needleLength;
+    const char16_t first = needle[0];
+    if (needleLength == 1) {
+        size_t idx = StringSearch::findChar(haystack + from, haystackLength - from, first);
+        return idx == SIZE_MAX ? SIZE_MAX : from + idx;
+    }
+
+    const size_t restLength = needleLength - 1;
+    size_t comparedCharacters = 0;
+    size_t pos = from;
+    while (pos <= last) {
+        size_t idx = StringSearch::findChar(haystack + pos, last - pos + 1, first);
+        if (idx == SIZE_MAX) {
+            return SIZE_MAX;
+        }
+        pos += idx;
+        size_t matched = mismatchOf(haystack + pos + 1, needle + 1, restLength);
+        if (matched == restLength) {
+            return pos;
+        }
+        pos++;
+
+        comparedCharacters += matched + 1;
+        if (needleLength >= STRING_SEARCH_HORSPOOL_MIN_NEEDLE_LENGTH && comparedCharacters > (pos - from) + 4 * needleLength) {
+            return horspoolFind(haystack, haystackLength, needle, needleLength, pos);
+        }
+    }
+    return SIZE_MAX;
+}
+
+template <typename HaystackChar, typename NeedleChar>
+static size_t rfindImpl(const HaystackChar* haystack, size_t haystackLength, const NeedleChar* needle, size_t needleLength, size_t from)
+{
+    if (needleLength == 0) {
+        return from <= haystackLength ? from : SIZE_MAX;
+    }
+    if (needleLength > haystackLength) {
+        return SIZE_MAX;
+    }
+
+    const char16_t first = needle[0];
+    const size_t restLength = needleLength - 1;
+    size_t pos = std::min(from, haystackLength - needleLength);
+    while (true) {
+        size_t idx = StringSearch::findLastChar(haystack, pos + 1, first);
+        if (idx == SIZE_MAX) {
+            return SIZE_MAX;
+        }
+        if (mismatchOf(haystack + idx + 1, needle + 1, restLength) == restLength) {
+            return idx;
+        }
+        if (idx == 0) {
+            return SIZE_MAX;
+        }
+        pos = idx - 1;
+    }
+}
+
+size_t StringSearch::find(const LChar* haystack, size_t haystackLength, const LChar* needle, size_t needleLength, size_t from)
+{
+    return findImpl(haystack, haystackLength, needle, needleLength, from);
+}
+
+size_t StringSearch::find(const LChar* haystack, size_t haystackLength, const char16_t* needle, size_t needleLength, size_t from)
+{
+    return findImpl(haystack, haystackLength, needle, needleLength, from);
+}
+
+size_t StringSearch::find(const char16_t* haystack, size_t haystackLength, const LChar* needle, size_t needleLength, size_t from)
+{
+    return findImpl(haystack, haystackLength, needle, needleLength, from);
+}
+
+size_t StringSearch::find(const char16_t* haystack, size_t haystackLength, const char16_t* needle, size_t needleLength, size_t from)
+{
+    return findImpl(haystack, haystackLength, needle, needleLength, from);
+}
+
+size_t StringSearch::rfind(const LChar* haystack, size_t haystackLength, const LChar* needle, size_t needleLength, size_t from)
+{
+    return rfindImpl(haystack, haystackLength, needle, needleLength, from);
+}
+
+size_t StringSearch::rfind(const LChar* haystack, size_t haystackLength, const char16_t* needle, size_t needleLength, size_t from)
+{
+    return rfindImpl(haystack, haystackLength, needle, needleLength, from);
+}
+
+size_t StringSearch::rfind(const char16_t* haystack, size_t haystackLength, const LChar* needle, size_t needleLength, size_t from)
+{
+    return rfindImpl(haystack, haystackLength, needle, needleLength, from);
+}
+
+size_t StringSearch::rfind(const char16_t* haystack, size_t haystackLength, const char16_t* needle, size_t needleLength, size_t from)
+{
+    return rfindImpl(haystack, haystackLength, needle, needleLength, from);
+}
+} // namespace Escargot
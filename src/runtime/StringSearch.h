@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2016-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#ifndef __EscargotStringSearch__
+#define __EscargotStringSearch__
+
+namespace Escargot {
+
+typedef unsigned char LChar;
+
+// Search and comparison kernels over raw 8-bit (Latin1) and 16-bit string buffers.
+// SSE2/AVX2 versions are used on x86 when the compiler targets them, otherwise scalar loops are used.
+// Every search function returns SIZE_MAX when nothing is found.
+class StringSearch {
+public:
+    // index of the first `ch` in [0, len)
+    static size_t findChar(const LChar* s, size_t len, char16_t ch);
+    static size_t findChar(const char16_t* s, size_t len, char16_t ch);
+
+    // index of the last `ch` in [0, len)
+    static size_t findLastChar(const LChar* s, size_t len, char16_t ch);
+    static size_t findLastChar(const char16_t* s, size_t len, char16_t ch);
+
+    static bool equals(const LChar* a, const LChar* b, size_t len);
+    static bool equals(const char16_t* a, const char16_t* b, size_t len);
+    static bool equals(const char16_t* a, const LChar* b, size_t len);
+
+    // index of the first position where a and b differ, or len if they are equal
+    static size_t mismatch(const LChar* a, const LChar* b, size_t len);
+    static size_t mismatch(const char16_t* a, const char16_t* b, size_t len);
+    static size_t mismatch(const char16_t* a, const LChar* b, size_t len);
+
+    // index of the first occurrence of needle in haystack at or after `from`
+    static size_t find(const LChar* haystack, size_t haystackLength, const LChar* needle, size_t needleLength, size_t from);
+    static size_t find(const LChar* haystack, size_t haystackLength, const char16_t* needle, size_t needleLength, size_t from);
+    static size_t find(const char16_t* haystack, size_t haystackLength, const LChar* needle, size_t needleLength, size_t from);
+    static size_t find(const char16_t* haystack, size_t haystackLength, const char16_t* needle, size_t needleLength, size_t from);
+
+    // index of the last occurrence of needle in haystack starting at or before `from`
+    static size_t rfind(const LChar* haystack, size_t haystackLength, const LChar* needle, size_t needleLength, size_t from);
+    static size_t rfind(const LChar* haystack, size_t haystackLength, const char16_t* needle, size_t needleLength, size_t from);
+    static size_t rfind(const char16_t* haystack, size_t haystackLength, const LChar* needle, size_t needleLength, size_t from);
+    static size_t rfind(const char16_t* haystack, size_t haystackLength, const char16_t* needle, size_t needleLength, size_t from);
+};
+} // namespace Escargot
+
+#endif
@@ -19,6 +19,7 @@
 
 #include "Escargot.h"
 #include "StringView.h"
+#include "StringBuilder.h"
 
 namespace Escargot {
 
@@ -34,4 +35,20 @@ void* StringView::operator new(size_t size)
     }
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
+
+void StringView::compact()
+{
+    if (m_string->length() == length()) {
+        // already compacted
+        return;
+    }
+
+    size_t from = start();
+    size_t to = from + length();
+
+    StringBuilder builder;
+    builder.appendSubString(m_string, from, to);
+    m_string = builder.finalize();
+    initBufferAccessData(m_string->bufferAccessData(), 0, to - from);
+}
 }
@@ -56,6 +56,11 @@ public:
         initBufferAccessData(String::emptyString->bufferAccessData(), 0, 0);
     }
 
+    virtual bool isStringView()
+    {
+        return true;
+    }
+
     virtual char16_t charAt(const size_t idx) const
     {
         return bufferAccessData().charAt(idx);
@@ -170,6 +175,11 @@ public:
         return start() + length();
     }
 
+    // copies the characters into a buffer of its own, so that the view stops keeping its parent alive.
+    // this moves the buffer of a live string, so it must not run while native code may hold the old buffer.
+    // see VMInstance::compactSmallStringViews
+    void compact();
+
 protected:
     ALWAYS_INLINE void initBufferAccessData(const StringBufferAccessData& srcData, size_t start, size_t end)
     {
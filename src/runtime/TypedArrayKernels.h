@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2017-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#ifndef __EscargotTypedArrayKernels__
+#define __EscargotTypedArrayKernels__
+
+#include "runtime/StringSearch.h"
+#include <cfloat>
+#include <limits>
+#include <type_traits>
+
+namespace Escargot {
+
+// Maps each element type to an unsigned key whose order is the default order of %TypedArray%.prototype.sort.
+// Signed integers get their sign bit flipped. Floats get all bits flipped when negative and the sign bit set otherwise,
+// which puts -0 right before +0, and every NaN is mapped to the largest key so that NaNs sort last.
+template <typename T, bool isIntegral = std::is_integral<T>::value>
+struct TypedArraySortKey {
+    typedef typename std::make_unsigned<T>::type Key;
+    static const Key flip = std::is_signed<T>::value ? (Key)((Key)1 << (sizeof(T) * 8 - 1)) : 0;
+
+    static Key toKey(T value)
+    {
+        return (Key)value ^ flip;
+    }
+
+    static T fromKey(Key key)
+    {
+        return (T)(key ^ flip);
+    }
+};
+
+template <typename T>
+struct TypedArraySortKey<T, false> {
+    typedef typename std::conditional<sizeof(T) == 4, uint32_t, uint64_t>::type Key;
+    static const Key signBit = (Key)1 << (sizeof(T) * 8 - 1);
+
+    static Key toKey(T value)
+    {
+        if (std::isnan(value)) {
+            return ~(Key)0;
+        }
+        Key bits;
+        memcpy(&bits, &value, sizeof(T));
+        return (bits & signBit) ? ~bits : (bits | signBit);
+    }
+
+    static T fromKey(Key key)
+    {
+        Key bits = (key & signBit) ? (key & ~signBit) : ~key;
+        T value;
+        memcpy(&value, &bits, sizeof(T));
+        return value;
+    }
+};
+
+// Loops over the raw elements of a typed array.
+// Searches take the search element as a double and never match an element that is not exactly equal to it.
+template <typename T>
+class TypedArrayKernels {
+public:
+    typedef typename TypedArraySortKey<T>::Key Key;
+
+    static void sort(T* elements, size_t length)
+    {
+        if (length < 2) {
+            return;
+        }
+        std::vector<Key> keys(length);
+        for (size_t i = 0; i < length; i++) {
+            keys[i] = TypedArraySortKey<T>::toKey(elements[i]);
+        }
+        if (length < 64) {
+            std::sort(keys.begin(), keys.end());
+        } else {
+            std::vector<Key> scratch(length);
+            radixSort(keys.data(), length, scratch.data());
+        }
+        for (size_t i = 0; i < length; i++) {
+            elements[i] = TypedArraySortKey<T>::fromKey(keys[i]);
+        }
+    }
+
+    static void fill(T* elements, size_t start, size_t end, T value)
+    {
+        if (sizeof(T) == 1) {
+            memset(elements + start, *(uint8_t*)&value, end - start);
+        } else {
+            std::fill(elements + start, elements + end, value);
+        }
+    }
+
+    static void reverse(T* elements, size_t length)
+    {
+        std::reverse(elements, elements + length);
+    }
+
+    // index of the first element equal to value in [start, length), or -1
+    static double indexOf(const T* elements, size_t start, size_t length, double value)
+    {
+        T element;
+        if (!toElement(value, element)) {
+            return -1;
+        }
+        size_t index = SIZE_MAX;
+        if (sizeof(T) == 1) {
+            index = StringSearch::findChar((const LChar*)elements + start, length - start, *(const uint8_t*)&element);
+        } else if (sizeof(T) == 2 && std::is_integral<T>::value) {
+            index = StringSearch::findChar((const char16_t*)elements + start, length - start, *(const char16_t*)&element);
+        } else {
+            for (size_t i = start; i < length; i++) {
+                if (elements[i] == element) {
+                    return i;
+                }
+            }
+        }
+        return index == SIZE_MAX ? -1 : (double)(start + index);
+    }
+
+    // index of the last element equal to value in [0, start], or -1
+    static double lastIndexOf(const T* elements, size_t start, double value)
+    {
+        T element;
+        if (!toElement(value, element)) {
+            return -1;
+        }
+        size_t index = SIZE_MAX;
+        if (sizeof(T) == 1) {
+            index = StringSearch::findLastChar((const LChar*)elements, start + 1, *(const uint8_t*)&element);
+        } else if (sizeof(T) == 2 && std::is_integral<T>::value) {
+            index = StringSearch::findLastChar((const char16_t*)elements, start + 1, *(const char16_t*)&element);
+        } else {
+            for (size_t i = start + 1; i-- > 0;) {
+                if (elements[i] == element) {
+                    return i;
+                }
+            }
+        }
+        return index == SIZE_MAX ? -1 : (double)index;
+    }
+
+private:
+    // whether value is exactly representable as T (NaN never is, -0 becomes 0 for integers)
+    static bool toElement(double value, T& result)
+    {
+        if (std::is_integral<T>::value) {
+            if (!(value >= (double)std::numeric_limits<T>::min() && value <= (double)std::numeric_limits<T>::max())) {
+                return false;
+            }
+            result = (T)value;
+            return (double)result == value;
+        }
+        if (std::isnan(value)) {
+            return false;
+        }
+        if (sizeof(T) == 4 && std::abs(value) > FLT_MAX && !std::isinf(value)) {
+            return false;
+        }
+        result = (T)value;
+        return (double)result == value;
+    }
+
+    // LSD radix sort on bytes; passes where every key has the same byte are skipped
+    static void radixSort(Key* keys, size_t length, Key* scratch)
+    {
+        size_t counts[sizeof(Key)][256];
+        memset(counts, 0, sizeof(counts));
+        for (size_t i = 0; i < length; i++) {
+            Key key = keys[i];
+            for (size_t pass = 0; pass < sizeof(Key); pass++) {
+                counts[pass][(key >> (pass * 8)) & 0xff]++;
+            }
+        }
+
+        Key* from = keys;
+        Key* to = scratch;
+        for (size_t pass = 0; pass < sizeof(Key); pass++) {
+            size_t* count = counts[pass];
+            size_t shift = pass * 8;
+            if (count[(from[0] >> shift) & 0xff] == length) {
+                continue;
+            }
+            size_t offset = 0;
+            for (size_t digit = 0; digit < 256; digit++) {
+                size_t c = count[digit];
+                count[digit] = offset;
+                offset += c;
+            }
+            for (size_t i = 0; i < length; i++) {
+                Key key = from[i];
+                to[count[(key >> shift) & 0xff]++] = key;
+            }
+            std::swap(from, to);
+        }
+        if (from != keys) {
+            memcpy(keys, from, sizeof(Key) * length);
+        }
+    }
+};
+} // namespace Escargot
+
+#endif
@@ -24,6 +24,8 @@
 
 namespace Escargot {
 
+size_t g_typedArrayObjectTags[TypedArrayType::Float64 + 1];
+
 #define DEFINE_FN(Type, type, siz)                                                                    \
     template <>                                                                                       \
     void TypedArrayObject<Type##Adaptor, siz>::typedArrayObjectPrototypeFiller(ExecutionState& state) \
@@ -24,10 +24,14 @@
 #include "runtime/ErrorObject.h"
 #include "runtime/ArrayBufferObject.h"
 #include "runtime/ArrayObject.h"
+#include "runtime/TypedArrayKernels.h"
 #include "util/Util.h"
 
 namespace Escargot {
 
+// vtable tags of the TypedArrayObject classes, indexed by TypedArrayType
+extern size_t g_typedArrayObjectTags[TypedArrayType::Float64 + 1];
+
 class ArrayBufferView : public Object {
 public:
     explicit ArrayBufferView(ExecutionState& state)
@@ -66,6 +70,33 @@ public:
         return true;
     }
 
+    // Operations on the raw elements, implemented for each element type by TypedArrayObject.
+    // The caller should check that the buffer is not detached.
+    virtual void sortElements()
+    {
+        RELEASE_ASSERT_NOT_REACHED();
+    }
+
+    virtual void fillElements(ExecutionState& state, const Value& value, unsigned start, unsigned end)
+    {
+        RELEASE_ASSERT_NOT_REACHED();
+    }
+
+    virtual void reverseElements()
+    {
+        RELEASE_ASSERT_NOT_REACHED();
+    }
+
+    virtual double indexOfElement(double value, unsigned start)
+    {
+        RELEASE_ASSERT_NOT_REACHED();
+    }
+
+    virtual double lastIndexOfElement(double value, unsigned start)
+    {
+        RELEASE_ASSERT_NOT_REACHED();
+    }
+
     static int getElementSize(TypedArrayType type)
     {
         switch (type) {
@@ -386,6 +417,32 @@ public:
         }
     }
 
+    // sorts numerically, with -0 before +0 and NaN last
+    virtual void sortElements() override
+    {
+        TypedArrayKernels<typename TypeAdaptor::Type>::sort(elements(), arrayLength());
+    }
+
+    virtual void fillElements(ExecutionState& state, const Value& value, unsigned start, unsigned end) override
+    {
+        TypedArrayKernels<typename TypeAdaptor::Type>::fill(elements(), start, end, TypeAdaptor::toNative(state, value));
+    }
+
+    virtual void reverseElements() override
+    {
+        TypedArrayKernels<typename TypeAdaptor::Type>::reverse(elements(), arrayLength());
+    }
+
+    virtual double indexOfElement(double value, unsigned start) override
+    {
+        return TypedArrayKernels<typename TypeAdaptor::Type>::indexOf(elements(), start, arrayLength(), value);
+    }
+
+    virtual double lastIndexOfElement(double value, unsigned start) override
+    {
+        return TypedArrayKernels<typename TypeAdaptor::Type>::lastIndexOf(elements(), start, value);
+    }
+
     virtual ObjectGetResult getIndexedProperty(ExecutionState& state, const Value& property) override
     {
         Value::ValueIndex idx = property.tryToUseAsIndex(state);
@@ -418,6 +475,10 @@ public:
     }
 
 protected:
+    typename TypeAdaptor::Type* elements()
+    {
+        return (typename TypeAdaptor::Type*)rawBuffer();
+    }
 };
 
 typedef TypedArrayObject<Int8Adaptor, 1> Int8ArrayObjectWrapper;
@@ -22,8 +22,10 @@
 #include "BumpPointerAllocator.h"
 #include "ArrayObject.h"
 #include "StringObject.h"
+#include "StringView.h"
 #include "JobQueue.h"
 #include "parser/ASTAllocator.h"
+#include "parser/ScriptSourceStore.h"
 
 namespace Escargot {
 
@@ -139,6 +141,8 @@ VMInstance::VMInstance(Platform* platform, const char* locale, const char* timez
     , m_randEngine((unsigned int)time(NULL))
     , m_didSomePrototypeObjectDefineIndexedProperty(false)
     , m_compiledByteCodeSize(0)
+    , m_scriptSourceStore(new ScriptSourceStore())
+    , m_smallStringViewsPruneSize(STRING_SUB_STRING_VIEW_TRACK_PRUNE_SIZE)
     , m_onVMInstanceDestroy(nullptr)
     , m_onVMInstanceDestroyData(nullptr)
     , m_cachedUTC(nullptr)
@@ -262,6 +266,38 @@ void VMInstance::clearCaches()
     globalSymbolRegistry().clear();
 }
 
+void VMInstance::trackSmallStringView(StringView* view)
+{
+    if (m_smallStringViews.size() >= m_smallStringViewsPruneSize) {
+        // drop the links of views that died
+        size_t alive = 0;
+        for (size_t i = 0; i < m_smallStringViews.size(); i++) {
+            if (*m_smallStringViews[i]) {
+                m_smallStringViews[alive++] = m_smallStringViews[i];
+            }
+        }
+        m_smallStringViews.resize(alive);
+        m_smallStringViewsPruneSize = std::max((size_t)STRING_SUB_STRING_VIEW_TRACK_PRUNE_SIZE, alive * 2);
+    }
+
+    StringView** link = (StringView**)GC_MALLOC_ATOMIC(sizeof(StringView*));
+    *link = view;
+    GC_GENERAL_REGISTER_DISAPPEARING_LINK((void**)link, view);
+    m_smallStringViews.pushBack(link);
+}
+
+void VMInstance::compactSmallStringViews()
+{
+    // GC drops the links themselves once they are unreachable
+    for (size_t i = 0; i < m_smallStringViews.size(); i++) {
+        if (*m_smallStringViews[i]) {
+            (*m_smallStringViews[i])->compact();
+        }
+    }
+    m_smallStringViews.clear();
+    m_smallStringViewsPruneSize = STRING_SUB_STRING_VIEW_TRACK_PRUNE_SIZE;
+}
+
 void VMInstance::somePrototypeObjectDefineIndexedProperty(ExecutionState& state)
 {
     m_didSomePrototypeObjectDefineIndexedProperty = true;
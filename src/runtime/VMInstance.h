@@ -37,6 +37,8 @@ class CodeBlock;
 class JobQueue;
 class Job;
 class ASTAllocator;
+class ScriptSourceStore;
+class StringView;
 
 #define DEFINE_GLOBAL_SYMBOLS(F) \
     F(hasInstance)               \
@@ -197,6 +199,18 @@ public:
         return m_compiledByteCodeSize;
     }
 
+    ScriptSourceStore* scriptSourceStore()
+    {
+        return m_scriptSourceStore;
+    }
+
+    // remembers a small view of a large string for compactSmallStringViews. see STRING_SUB_STRING_VIEW_COMPACT_PARENT_LENGTH
+    void trackSmallStringView(StringView* view);
+    // copies the characters of every remembered view that is still alive, so that it stops keeping its large parent alive.
+    // native code may hold the buffer of a view while it runs, so this is called only where no native frame can be running:
+    // after the outermost script execution returns, and from VMInstanceRef::clearCachesRelatedWithContext
+    void compactSmallStringViews();
+
     std::mt19937& randEngine()
     {
         return m_randEngine;
@@ -247,6 +261,13 @@ private:
     Vector<CodeBlock*, GCUtil::gc_malloc_allocator<CodeBlock*>> m_compiledCodeBlocks;
     size_t m_compiledByteCodeSize;
 
+    ScriptSourceStore* m_scriptSourceStore;
+
+    // views are remembered through weak links, so a remembered view still dies with its last reference.
+    // the links are allocated atomic so that GC does not see them as references
+    Vector<StringView**, GCUtil::gc_malloc_allocator<StringView**>> m_smallStringViews;
+    size_t m_smallStringViewsPruneSize;
+
     void (*m_onVMInstanceDestroy)(VMInstance* instance, void* data);
     void* m_onVMInstanceDestroyData;
 
@@ -86,95 +86,12 @@ ValueRef* builtinPrint(ExecutionStateRef* state, ValueRef* thisValue, size_t arg
     return ValueRef::createUndefined();
 }
 
-static const char32_t offsetsFromUTF8[6] = { 0x00000000UL, 0x00003080UL, 0x000E2080UL, 0x03C82080UL, static_cast<char32_t>(0xFA082080UL), static_cast<char32_t>(0x82082080UL) };
-
-char32_t readUTF8Sequence(const char*& sequence, bool& valid, int& charlen)
-{
-    unsigned length;
-    const char sch = *sequence;
-    valid = true;
-    if ((sch & 0x80) == 0)
-        length = 1;
-    else {
-        unsigned char ch2 = static_cast<unsigned char>(*(sequence + 1));
-        if ((sch & 0xE0) == 0xC0
-            && (ch2 & 0xC0) == 0x80)
-            length = 2;
-        else {
-            unsigned char ch3 = static_cast<unsigned char>(*(sequence + 2));
-            if ((sch & 0xF0) == 0xE0
-                && (ch2 & 0xC0) == 0x80
-                && (ch3 & 0xC0) == 0x80)
-                length = 3;
-            else {
-                unsigned char ch4 = static_cast<unsigned char>(*(sequence + 3));
-                if ((sch & 0xF8) == 0xF0
-                    && (ch2 & 0xC0) == 0x80
-                    && (ch3 & 0xC0) == 0x80
-                    && (ch4 & 0xC0) == 0x80)
-                    length = 4;
-                else {
-                    valid = false;
-                    sequence++;
-                    return -1;
-                }
-            }
-        }
-    }
-
-    charlen = length;
-    char32_t ch = 0;
-    switch (length) {
-    case 4:
-        ch += static_cast<unsigned char>(*sequence++);
-        ch <<= 6; // Fall through.
-    case 3:
-        ch += static_cast<unsigned char>(*sequence++);
-        ch <<= 6; // Fall through.
-    case 2:
-        ch += static_cast<unsigned char>(*sequence++);
-        ch <<= 6; // Fall through.
-    case 1:
-        ch += static_cast<unsigned char>(*sequence++);
-    }
-    return ch - offsetsFromUTF8[length - 1];
-}
-
-static OptionalRef<StringRef> builtinHelperFileRead(OptionalRef<ExecutionStateRef> state, const char* fileName, const char* builtinName)
+// script sources may stay mapped while they run, but read() hands its string to scripts that may keep it
+// long after the file has changed, so it always copies
+static OptionalRef<StringRef> builtinHelperFileRead(OptionalRef<ExecutionStateRef> state, const char* fileName, const char* builtinName, bool mayMapFile)
 {
-    FILE* fp = fopen(fileName, "r");
-    if (fp) {
-        StringRef* src = StringRef::emptyString();
-        std::string utf8Str;
-        std::basic_string<unsigned char, std::char_traits<unsigned char>> str;
-        char buf[512];
-        bool hasNonLatin1Content = false;
-        size_t readLen;
-        while ((readLen = fread(buf, 1, sizeof buf, fp))) {
-            if (!hasNonLatin1Content) {
-                const char* source = buf;
-                int charlen;
-                bool valid;
-                while (source < buf + readLen) {
-                    char32_t ch = readUTF8Sequence(source, valid, charlen);
-                    if (ch > 255) {
-                        hasNonLatin1Content = true;
-                        fseek(fp, 0, SEEK_SET);
-                        break;
-                    } else {
-                        str += (unsigned char)ch;
-                    }
-                }
-            } else {
-                utf8Str.append(buf, readLen);
-            }
-        }
-        fclose(fp);
-        if (hasNonLatin1Content) {
-            src = StringRef::createFromUTF8(utf8Str.data(), utf8Str.length());
-        } else {
-            src = StringRef::createFromLatin1(str.data(), str.length());
-        }
+    OptionalRef<StringRef> src = StringRef::createFromUTF8File(fileName, mayMapFile);
+    if (src) {
         return src;
     } else {
         char msg[1024];
@@ -193,7 +110,7 @@ static ValueRef* builtinLoad(ExecutionStateRef* state, ValueRef* thisValue, size
     if (argc >= 1) {
         auto f = argv[0]->toString(state)->toStdUTF8String();
         const char* fileName = f.data();
-        StringRef* src = builtinHelperFileRead(state, fileName, "load").value();
+        StringRef* src = builtinHelperFileRead(state, fileName, "load", true).value();
         bool isModule = stringEndsWith(f, "mjs");
 
         auto script = state->context()->scriptParser()->initializeScript(src, argv[0]->toString(state), isModule).fetchScriptThrowsExceptionIfParseError(state);
@@ -208,7 +125,7 @@ static ValueRef* builtinRead(ExecutionStateRef* state, ValueRef* thisValue, size
     if (argc >= 1) {
         auto f = argv[0]->toString(state)->toStdUTF8String();
         const char* fileName = f.data();
-        StringRef* src = builtinHelperFileRead(state, fileName, "read").value();
+        StringRef* src = builtinHelperFileRead(state, fileName, "read", false).value();
         return src;
     } else {
         return StringRef::emptyString();
@@ -222,7 +139,7 @@ static ValueRef* builtinRun(ExecutionStateRef* state, ValueRef* thisValue, size_
 
         auto f = argv[0]->toString(state)->toStdUTF8String();
         const char* fileName = f.data();
-        StringRef* src = builtinHelperFileRead(state, fileName, "run").value();
+        StringRef* src = builtinHelperFileRead(state, fileName, "run", true).value();
         bool isModule = stringEndsWith(f, "mjs");
         auto script = state->context()->scriptParser()->initializeScript(src, argv[0]->toString(state), isModule).fetchScriptThrowsExceptionIfParseError(state);
         script->execute(state);
@@ -417,7 +334,7 @@ public:
             }
         }
 
-        OptionalRef<StringRef> source = builtinHelperFileRead(nullptr, absPath.data(), "");
+        OptionalRef<StringRef> source = builtinHelperFileRead(nullptr, absPath.data(), "", true);
         if (!source) {
             std::string s = "Error reading : " + absPath;
             return LoadModuleResult(ErrorObjectRef::Code::None, StringRef::createFromUTF8(s.data(), s.length()));
@@ -570,7 +487,7 @@ int main(int argc, char* argv[])
             fclose(fp);
             runShell = false;
 
-            StringRef* src = builtinHelperFileRead(nullptr, argv[i], "read").get();
+            StringRef* src = builtinHelperFileRead(nullptr, argv[i], "read", true).get();
 
             if (!evalScript(context, src, StringRef::createFromUTF8(argv[i], strlen(argv[i])), false, seenModule)) {
                 return 3;
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2016-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+
+#include "Escargot.h"
+#include "LZ4Block.h"
+
+namespace Escargot {
+
+#define LZ4_MIN_MATCH 4
+// a match starts at least this many bytes before the end of the text
+#define LZ4_MATCH_FIND_LIMIT 12
+// and leaves at least this many bytes for the last literals
+#define LZ4_LAST_LITERALS 5
+#define LZ4_MAX_OFFSET 65535
+#define LZ4_HASH_LOG 12
+
+static ALWAYS_INLINE uint32_t read32(const uint8_t* p)
+{
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static ALWAYS_INLINE uint64_t read64(const uint8_t* p)
+{
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static ALWAYS_INLINE uint32_t hash32(uint32_t v)
+{
+    return (v * 2654435761U) >> (32 - LZ4_HASH_LOG);
+}
+
+static uint8_t* writeLengthExtension(uint8_t* op, size_t length)
+{
+    while (length >= 255) {
+        *op++ = 255;
+        length -= 255;
+    }
+    *op++ = (uint8_t)length;
+    return op;
+}
+
+// matchLength is 0 for the last sequence, which has literals only
+static uint8_t* writeSequence(uint8_t* op, const uint8_t* literals, size_t literalLength, size_t offset, size_t matchLength)
+{
+    uint8_t* token = op++;
+    *token = (uint8_t)(std::min(literalLength, (size_t)15) << 4);
+    if (literalLength >= 15) {
+        op = writeLengthExtension(op, literalLength - 15);
+    }
+    memcpy(op, literals, literalLength);
+    op += literalLength;
+
+    if (matchLength) {
+        *op++ = (uint8_t)(offset & 0xff);
+        *op++ = (uint8_t)(offset >> 8);
+        matchLength -= LZ4_MIN_MATCH;
+        *token |= (uint8_t)std::min(matchLength, (size_t)15);
+        if (matchLength >= 15) {
+            op = writeLengthExtension(op, matchLength - 15);
+        }
+    }
+    return op;
+}
+
+size_t LZ4Block::compress(const uint8_t* src, size_t srcSize, uint8_t* dst)
+{
+    uint8_t* op = dst;
+    size_t anchor = 0;
+
+    // positions in the table are 32 bit, so a larger text is stored as literals
+    if (srcSize > LZ4_MATCH_FIND_LIMIT && srcSize < UINT32_MAX) {
+        uint32_t table[1 << LZ4_HASH_LOG];
+        memset(table, 0, sizeof(table));
+
+        const size_t matchFindLimit = srcSize - LZ4_MATCH_FIND_LIMIT;
+        const size_t matchEndLimit = srcSize - LZ4_LAST_LITERALS;
+        size_t ip = 0;
+        while (ip < matchFindLimit) {
+            uint32_t sequence = read32(src + ip);
+            uint32_t hash = hash32(sequence);
+            size_t candidate = table[hash];
+            table[hash] = (uint32_t)ip;
+
+            if (candidate >= ip || ip - candidate > LZ4_MAX_OFFSET || read32(src + candidate) != sequence) {
+                // step faster through text which does not repeat
+                ip += 1 + ((ip - anchor) >> 6);
+                continue;
+            }
+
+            while (ip > anchor && candidate > 0 && src[ip - 1] == src[candidate - 1]) {
+                ip--;
+                candidate--;
+            }
+
+            size_t matchLength = LZ4_MIN_MATCH;
+            while (ip + matchLength + sizeof(uint64_t) <= matchEndLimit && read64(src + ip + matchLength) == read64(src + candidate + matchLength)) {
+                matchLength += sizeof(uint64_t);
+            }
+            while (ip + matchLength < matchEndLimit && src[ip + matchLength] == src[candidate + matchLength]) {
+                matchLength++;
+            }
+
+            op = writeSequence(op, src + anchor, ip - anchor, ip - candidate, matchLength);
+            ip += matchLength;
+            anchor = ip;
+
+            if (ip < matchFindLimit) {
+                table[hash32(read32(src + ip - 2))] = (uint32_t)(ip - 2);
+            }
+        }
+    }
+
+    op = writeSequence(op, src + anchor, srcSize - anchor, 0, 0);
+    ASSERT((size_t)(op - dst) <= compressBound(srcSize));
+    return op - dst;
+}
+
+static ALWAYS_INLINE bool readLengthExtension(const uint8_t*& ip, const uint8_t* srcEnd, size_t& length)
+{
+    uint8_t byte;
+    do {
+        if (ip == srcEnd) {
+            return false;
+        }
+        byte = *ip++;
+        length += byte;
+    } while (byte == 255);
+    return true;
+}
+
+bool LZ4Block::decompress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstSize)
+{
+    const uint8_t* ip = src;
+    const uint8_t* srcEnd = src + srcSize;
+    uint8_t* op = dst;
+    uint8_t* dstEnd = dst + dstSize;
+
+    while (ip < srcEnd) {
+        uint8_t token = *ip++;
+
+        size_t literalLength = token >> 4;
+        if (literalLength == 15 && !readLengthExtension(ip, srcEnd, literalLength)) {
+            return false;
+        }
+        if ((size_t)(srcEnd - ip) < literalLength || (size_t)(dstEnd - op) < literalLength) {
+            return false;
+        }
+        memcpy(op, ip, literalLength);
+        ip += literalLength;
+        op += literalLength;
+
+        if (ip == srcEnd) {
+            break;
+        }
+
+        if (srcEnd - ip < 2) {
+            return false;
+        }
+        size_t offset = ip[0] | ((size_t)ip[1] << 8);
+        ip += 2;
+        if (!offset || offset > (size_t)(op - dst)) {
+            return false;
+        }
+
+        size_t matchLength = token & 15;
+        if (matchLength == 15 && !readLengthExtension(ip, srcEnd, matchLength)) {
+            return false;
+        }
+        matchLength += LZ4_MIN_MATCH;
+        if ((size_t)(dstEnd - op) < matchLength) {
+            return false;
+        }
+
+        const uint8_t* match = op - offset;
+        if (offset >= matchLength) {
+            memcpy(op, match, matchLength);
+            op += matchLength;
+        } else {
+            // the match overlaps the bytes being written, which repeats them
+            for (size_t i = 0; i < matchLength; i++) {
+                *op++ = *match++;
+            }
+        }
+    }
+
+    return op == dstEnd;
+}
+}
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2016-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+
+#ifndef __EscargotLZ4Block__
+#define __EscargotLZ4Block__
+
+namespace Escargot {
+
+// compressor and decompressor of the LZ4 block format.
+// the text is a sequence of (literals, match) pairs. each pair starts with a token byte holding
+// the literal length and the match length - 4 in 4 bits each, extended by following bytes when a length is 15 or more.
+// a match is encoded as a 16 bit little endian offset back into the decompressed text.
+// the last pair has literals only, and at least the last 5 bytes are literals
+class LZ4Block {
+public:
+    // size of the buffer compress needs in the worst case
+    static size_t compressBound(size_t srcSize)
+    {
+        return srcSize + srcSize / 255 + 16;
+    }
+
+    // compresses src into dst which is at least compressBound(srcSize) bytes, and returns the compressed size
+    static size_t compress(const uint8_t* src, size_t srcSize, uint8_t* dst);
+    // returns false if src is not a valid block or does not decompress into exactly dstSize bytes
+    static bool decompress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstSize);
+};
+}
+
+#endif
@@ -0,0 +1,482 @@
+/*
+ * Copyright (c) 2016-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#ifndef __EscargotTimSort__
+#define __EscargotTimSort__
+
+namespace Escargot {
+
+/*
+ * Stable sort in the style of TimSort. Ascending and strictly descending runs
+ * already present in the input are found and extended with binary insertion
+ * sort, then merged with galloping, so partially ordered input needs far fewer
+ * comparisons than a plain merge sort.
+ *
+ * lessThan(a, b) returns whether a sorts strictly before b. It may be
+ * inconsistent (every element still ends up in the array exactly once) and it
+ * may throw, in which case the content of array and scratch is arbitrary.
+ * The scratch should point to a temporary storage that can hold length / 2 elements.
+ */
+template <typename T, typename LessThan>
+class TimSort {
+public:
+    static void sort(T* array, size_t length, T* scratch, LessThan& lessThan)
+    {
+        if (length < 2) {
+            return;
+        }
+        TimSort sorter(array, scratch, lessThan);
+        sorter.sortAll(length);
+    }
+
+private:
+    static const ptrdiff_t MinMerge = 32;
+    static const ptrdiff_t MinGallop = 7;
+    // run lengths on the stack grow at least like the Fibonacci sequence
+    static const size_t MaxStackSize = 85;
+
+    TimSort(T* array, T* scratch, LessThan& lessThan)
+        : m_array(array)
+        , m_scratch(scratch)
+        , m_lessThan(lessThan)
+        , m_minGallop(MinGallop)
+        , m_stackSize(0)
+    {
+    }
+
+    void sortAll(ptrdiff_t length)
+    {
+        if (length < MinMerge) {
+            ptrdiff_t runLength = countRunAndMakeAscending(0, length);
+            binaryInsertionSort(0, length, runLength);
+            return;
+        }
+
+        ptrdiff_t minRun = minRunLength(length);
+        ptrdiff_t lo = 0;
+        ptrdiff_t remaining = length;
+        do {
+            ptrdiff_t runLength = countRunAndMakeAscending(lo, lo + remaining);
+            if (runLength < minRun) {
+                ptrdiff_t forced = std::min(remaining, minRun);
+                binaryInsertionSort(lo, lo + forced, lo + runLength);
+                runLength = forced;
+            }
+
+            ASSERT(m_stackSize < MaxStackSize);
+            m_runBase[m_stackSize] = lo;
+            m_runLength[m_stackSize] = runLength;
+            m_stackSize++;
+            mergeCollapse();
+
+            lo += runLength;
+            remaining -= runLength;
+        } while (remaining);
+
+        while (m_stackSize > 1) {
+            size_t n = m_stackSize - 2;
+            if (n > 0 && m_runLength[n - 1] < m_runLength[n + 1]) {
+                n--;
+            }
+            mergeAt(n);
+        }
+    }
+
+    static ptrdiff_t minRunLength(ptrdiff_t n)
+    {
+        ptrdiff_t r = 0;
+        while (n >= MinMerge) {
+            r |= (n & 1);
+            n >>= 1;
+        }
+        return n + r;
+    }
+
+    // returns the length of the run starting at lo, reversing it first when it is strictly descending
+    ptrdiff_t countRunAndMakeAscending(ptrdiff_t lo, ptrdiff_t hi)
+    {
+        ptrdiff_t runHi = lo + 1;
+        if (runHi == hi) {
+            return 1;
+        }
+
+        if (m_lessThan(m_array[runHi++], m_array[lo])) {
+            while (runHi < hi && m_lessThan(m_array[runHi], m_array[runHi - 1])) {
+                runHi++;
+            }
+            std::reverse(m_array + lo, m_array + runHi);
+        } else {
+            while (runHi < hi && !m_lessThan(m_array[runHi], m_array[runHi - 1])) {
+                runHi++;
+            }
+        }
+        return runHi - lo;
+    }
+
+    // [lo, start) is already sorted
+    void binaryInsertionSort(ptrdiff_t lo, ptrdiff_t hi, ptrdiff_t start)
+    {
+        if (start == lo) {
+            start++;
+        }
+        for (; start < hi; start++) {
+            T pivot = m_array[start];
+            ptrdiff_t left = lo;
+            ptrdiff_t right = start;
+            while (left < right) {
+                ptrdiff_t mid = (left + right) >> 1;
+                if (m_lessThan(pivot, m_array[mid])) {
+                    right = mid;
+                } else {
+                    left = mid + 1;
+                }
+            }
+            std::copy_backward(m_array + left, m_array + start, m_array + start + 1);
+            m_array[left] = pivot;
+        }
+    }
+
+    void mergeCollapse()
+    {
+        while (m_stackSize > 1) {
+            size_t n = m_stackSize - 2;
+            if ((n > 0 && m_runLength[n - 1] <= m_runLength[n] + m_runLength[n + 1])
+                || (n > 1 && m_runLength[n - 2] <= m_runLength[n - 1] + m_runLength[n])) {
+                if (m_runLength[n - 1] < m_runLength[n + 1]) {
+                    n--;
+                }
+            } else if (m_runLength[n] > m_runLength[n + 1]) {
+                break;
+            }
+            mergeAt(n);
+        }
+    }
+
+    void mergeAt(size_t i)
+    {
+        ptrdiff_t base1 = m_runBase[i];
+        ptrdiff_t length1 = m_runLength[i];
+        ptrdiff_t base2 = m_runBase[i + 1];
+        ptrdiff_t length2 = m_runLength[i + 1];
+
+        m_runLength[i] = length1 + length2;
+        if (i == m_stackSize - 3) {
+            m_runBase[i + 1] = m_runBase[i + 2];
+            m_runLength[i + 1] = m_runLength[i + 2];
+        }
+        m_stackSize--;
+
+        // elements of run1 before the first element of run2 are already in place
+        ptrdiff_t k = gallopRight(m_array[base2], m_array + base1, length1, 0);
+        base1 += k;
+        length1 -= k;
+        if (length1 == 0) {
+            return;
+        }
+
+        // so are elements of run2 after the last element of run1
+        length2 = gallopLeft(m_array[base1 + length1 - 1], m_array + base2, length2, length2 - 1);
+        if (length2 == 0) {
+            return;
+        }
+
+        if (length1 <= length2) {
+            mergeLow(base1, length1, base2, length2);
+        } else {
+            mergeHigh(base1, length1, base2, length2);
+        }
+    }
+
+    // leftmost position in the sorted range where key can be inserted, searching outward from hint
+    ptrdiff_t gallopLeft(T key, const T* base, ptrdiff_t length, ptrdiff_t hint)
+    {
+        ptrdiff_t lastOffset = 0;
+        ptrdiff_t offset = 1;
+        if (m_lessThan(base[hint], key)) {
+            ptrdiff_t maxOffset = length - hint;
+            while (offset < maxOffset && m_lessThan(base[hint + offset], key)) {
+                lastOffset = offset;
+                offset = (offset << 1) + 1;
+            }
+            offset = std::min(offset, maxOffset);
+            lastOffset += hint;
+            offset += hint;
+        } else {
+            ptrdiff_t maxOffset = hint + 1;
+            while (offset < maxOffset && !m_lessThan(base[hint - offset], key)) {
+                lastOffset = offset;
+                offset = (offset << 1) + 1;
+            }
+            offset = std::min(offset, maxOffset);
+            ptrdiff_t tmp = lastOffset;
+            lastOffset = hint - offset;
+            offset = hint - tmp;
+        }
+
+        lastOffset++;
+        while (lastOffset < offset) {
+            ptrdiff_t mid = lastOffset + ((offset - lastOffset) >> 1);
+            if (m_lessThan(base[mid], key)) {
+                lastOffset = mid + 1;
+            } else {
+                offset = mid;
+            }
+        }
+        return offset;
+    }
+
+    // rightmost position in the sorted range where key can be inserted, searching outward from hint
+    ptrdiff_t gallopRight(T key, const T* base, ptrdiff_t length, ptrdiff_t hint)
+    {
+        ptrdiff_t lastOffset = 0;
+        ptrdiff_t offset = 1;
+        if (m_lessThan(key, base[hint])) {
+            ptrdiff_t maxOffset = hint + 1;
+            while (offset < maxOffset && m_lessThan(key, base[hint - offset])) {
+                lastOffset = offset;
+                offset = (offset << 1) + 1;
+            }
+            offset = std::min(offset, maxOffset);
+            ptrdiff_t tmp = lastOffset;
+            lastOffset = hint - offset;
+            offset = hint - tmp;
+        } else {
+            ptrdiff_t maxOffset = length - hint;
+            while (offset < maxOffset && !m_lessThan(key, base[hint + offset])) {
+                lastOffset = offset;
+                offset = (offset << 1) + 1;
+            }
+            offset = std::min(offset, maxOffset);
+            lastOffset += hint;
+            offset += hint;
+        }
+
+        lastOffset++;
+        while (lastOffset < offset) {
+            ptrdiff_t mid = lastOffset + ((offset - lastOffset) >> 1);
+            if (m_lessThan(key, base[mid])) {
+                offset = mid;
+            } else {
+                lastOffset = mid + 1;
+            }
+        }
+        return offset;
+    }
+
+    // merges adjacent runs in place when run1 is the shorter one; run1 is moved to the scratch
+    void mergeLow(ptrdiff_t base1, ptrdiff_t length1, ptrdiff_t base2, ptrdiff_t length2)
+    {
+        T* a = m_array;
+        T* tmp = m_scratch;
+        std::copy(a + base1, a + base1 + length1, tmp);
+
+        ptrdiff_t cursor1 = 0;
+        ptrdiff_t cursor2 = base2;
+        ptrdiff_t dest = base1;
+        a[dest++] = a[cursor2++];
+        if (--length2 == 0) {
+            std::copy(tmp + cursor1, tmp + cursor1 + length1, a + dest);
+            return;
+        }
+        if (length1 == 1) {
+            std::copy(a + cursor2, a + cursor2 + length2, a + dest);
+            a[dest + length2] = tmp[cursor1];
+            return;
+        }
+
+        while (true) {
+            ptrdiff_t count1 = 0;
+            ptrdiff_t count2 = 0;
+
+            do {
+                if (m_lessThan(a[cursor2], tmp[cursor1])) {
+                    a[dest++] = a[cursor2++];
+                    count2++;
+                    count1 = 0;
+                    if (--length2 == 0) {
+                        goto finish;
+                    }
+                } else {
+                    a[dest++] = tmp[cursor1++];
+                    count1++;
+                    count2 = 0;
+                    if (--length1 == 1) {
+                        goto finish;
+                    }
+                }
+            } while ((count1 | count2) < m_minGallop);
+
+            do {
+                count1 = gallopRight(a[cursor2], tmp + cursor1, length1, 0);
+                if (count1) {
+                    std::copy(tmp + cursor1, tmp + cursor1 + count1, a + dest);
+                    dest += count1;
+                    cursor1 += count1;
+                    length1 -= count1;
+                    if (length1 <= 1) {
+                        goto finish;
+                    }
+                }
+                a[dest++] = a[cursor2++];
+                if (--length2 == 0) {
+                    goto finish;
+                }
+
+                count2 = gallopLeft(tmp[cursor1], a + cursor2, length2, 0);
+                if (count2) {
+                    std::copy(a + cursor2, a + cursor2 + count2, a + dest);
+                    dest += count2;
+                    cursor2 += count2;
+                    length2 -= count2;
+                    if (length2 == 0) {
+                        goto finish;
+                    }
+                }
+                a[dest++] = tmp[cursor1++];
+                if (--length1 == 1) {
+                    goto finish;
+                }
+                m_minGallop--;
+            } while (count1 >= MinGallop || count2 >= MinGallop);
+
+            m_minGallop = std::max(m_minGallop, (ptrdiff_t)0) + 2;
+        }
+
+    finish:
+        m_minGallop = std::max(m_minGallop, (ptrdiff_t)1);
+        if (length1 == 1) {
+            std::copy(a + cursor2, a + cursor2 + length2, a + dest);
+            a[dest + length2] = tmp[cursor1];
+        } else if (length1 > 1) {
+            std::copy(tmp + cursor1, tmp + cursor1 + length1, a + dest);
+        }
+        // length1 is 0 only with an inconsistent comparator; the rest of run2 is already in place then
+    }
+
+    // merges adjacent runs in place when run2 is the shorter one; run2 is moved to the scratch
+    void mergeHigh(ptrdiff_t base1, ptrdiff_t length1, ptrdiff_t base2, ptrdiff_t length2)
+    {
+        T* a = m_array;
+        T* tmp = m_scratch;
+        std::copy(a + base2, a + base2 + length2, tmp);
+
+        ptrdiff_t cursor1 = base1 + length1 - 1;
+        ptrdiff_t cursor2 = length2 - 1;
+        ptrdiff_t dest = base2 + length2 - 1;
+        a[dest--] = a[cursor1--];
+        if (--length1 == 0) {
+            std::copy(tmp, tmp + length2, a + dest - (length2 - 1));
+            return;
+        }
+        if (length2 == 1) {
+            dest -= length1;
+            cursor1 -= length1;
+            std::copy_backward(a + cursor1 + 1, a + cursor1 + 1 + length1, a + dest + 1 + length1);
+            a[dest] = tmp[cursor2];
+            return;
+        }
+
+        while (true) {
+            ptrdiff_t count1 = 0;
+            ptrdiff_t count2 = 0;
+
+            do {
+                if (m_lessThan(tmp[cursor2], a[cursor1])) {
+                    a[dest--] = a[cursor1--];
+                    count1++;
+                    count2 = 0;
+                    if (--length1 == 0) {
+                        goto finish;
+                    }
+                } else {
+                    a[dest--] = tmp[cursor2--];
+                    count2++;
+                    count1 = 0;
+                    if (--length2 == 1) {
+                        goto finish;
+                    }
+                }
+            } while ((count1 | count2) < m_minGallop);
+
+            do {
+                count1 = length1 - gallopRight(tmp[cursor2], a + base1, length1, length1 - 1);
+                if (count1) {
+                    dest -= count1;
+                    cursor1 -= count1;
+                    length1 -= count1;
+                    std::copy_backward(a + cursor1 + 1, a + cursor1 + 1 + count1, a + dest + 1 + count1);
+                    if (length1 == 0) {
+                        goto finish;
+                    }
+                }
+                a[dest--] = tmp[cursor2--];
+                if (--length2 == 1) {
+                    goto finish;
+                }
+
+                count2 = length2 - gallopLeft(a[cursor1], tmp, length2, length2 - 1);
+                if (count2) {
+                    dest -= count2;
+                    cursor2 -= count2;
+                    length2 -= count2;
+                    std::copy(tmp + cursor2 + 1, tmp + cursor2 + 1 + count2, a + dest + 1);
+                    if (length2 <= 1) {
+                        goto finish;
+                    }
+                }
+                a[dest--] = a[cursor1--];
+                if (--length1 == 0) {
+                    goto finish;
+                }
+                m_minGallop--;
+            } while (count1 >= MinGallop || count2 >= MinGallop);
+
+            m_minGallop = std::max(m_minGallop, (ptrdiff_t)0) + 2;
+        }
+
+    finish:
+        m_minGallop = std::max(m_minGallop, (ptrdiff_t)1);
+        if (length2 == 1) {
+            dest -= length1;
+            cursor1 -= length1;
+            std::copy_backward(a + cursor1 + 1, a + cursor1 + 1 + length1, a + dest + 1 + length1);
+            a[dest] = tmp[cursor2];
+        } else if (length2 > 1) {
+            std::copy(tmp, tmp + length2, a + dest - (length2 - 1));
+        }
+        // length2 is 0 only with an inconsistent comparator; the rest of run1 is already in place then
+    }
+
+    T* m_array;
+    T* m_scratch;
+    LessThan& m_lessThan;
+    ptrdiff_t m_minGallop;
+    size_t m_stackSize;
+    ptrdiff_t m_runBase[MaxStackSize];
+    ptrdiff_t m_runLength[MaxStackSize];
+};
+
+template <typename T, typename LessThan>
+void timSort(T* array, size_t length, T* scratch, LessThan lessThan)
+{
+    TimSort<T, LessThan>::sort(array, length, scratch, lessThan);
+}
+} // namespace Escargot
+
+#endif
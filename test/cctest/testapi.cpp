@@ -16,6 +16,8 @@
 
 #include <EscargotPublic.h>
 #include <string.h>
+#include <string>
+#include <thread>
 
 #define CHECK(name, cond) \
     printf(name" | %s\n", (cond) ? "pass" : "fail");
@@ -173,6 +175,243 @@ int main(int argc, char* argv[])
         sb->destroy();
     }
 
+    {
+        static const unsigned char latin1[] = "external latin1";
+        Escargot::StringRef* str = Escargot::StringRef::createExternalFromLatin1(latin1, sizeof(latin1) - 1, nullptr, nullptr);
+        CHECK("External string 1", str->length() == sizeof(latin1) - 1);
+        CHECK("External string 2", str->stringBufferAccessData().buffer == latin1);
+        CHECK("External string 3", str->equals(Escargot::StringRef::createFromASCII("external latin1")));
+
+        static uint8_t bytes[4] = { 1, 2, 3, 4 };
+        static bool released = false;
+        Escargot::ArrayBufferObjectRef* buffer = Escargot::ArrayBufferObjectRef::create(es);
+        buffer->attachExternalBuffer(es, bytes, sizeof(bytes), [](void* buffer, size_t bytelength, void* data) {
+            *(bool*)data = true;
+        }, &released);
+        CHECK("External ArrayBuffer 1", buffer->rawBuffer() == bytes && buffer->byteLength() == sizeof(bytes));
+        buffer->detachArrayBuffer(es);
+        CHECK("External ArrayBuffer 2", released && buffer->isDetachedBuffer());
+    }
+
+    {
+        Escargot::ValueRef* names[2] = { Escargot::StringRef::createFromASCII("x"), Escargot::StringRef::createFromASCII("y") };
+        Escargot::ValueRef* values[2] = { Escargot::ValueRef::create(1), Escargot::ValueRef::create(2) };
+        Escargot::ObjectTemplateRef* objectTemplate = Escargot::ObjectTemplateRef::create(es, 2, names);
+        CHECK("Object template 1", objectTemplate->propertyCount() == 2);
+        Escargot::ObjectRef* obj = objectTemplate->instantiate(es, values);
+        CHECK("Object template 2", obj->get(es, names[1])->asNumber() == 2);
+        CHECK("Object template 3", obj->ownPropertyKeys(es)->size() == 2);
+
+        Escargot::ArrayObjectRef* arr = Escargot::ArrayObjectRef::create(es, 2, values);
+        CHECK("Array from values", arr->get(es, Escargot::ValueRef::create(1))->asNumber() == 2);
+    }
+
+    {
+        typedef Escargot::FunctionObjectRef F;
+        F::FastNativeFunctionInfo fastInfo([](F::FastCallValue* argv) -> F::FastCallValue {
+            F::FastCallValue result;
+            result.m_int32 = argv[0].m_int32 * 2;
+            return result;
+        }, F::FastCallInt32, { F::FastCallInt32 });
+        F::NativeFunctionInfo info(Escargot::AtomicStringRef::create(ctx, "twice"), [](Escargot::ExecutionStateRef* state, Escargot::ValueRef* thisValue, size_t argc, Escargot::ValueRef** argv, bool isNewExpression) -> Escargot::ValueRef* {
+            return Escargot::ValueRef::create(argc ? argv[0]->toNumber(state) * 2 : std::numeric_limits<double>::quiet_NaN());
+        }, 1, fastInfo, true, false);
+        F* twice = F::create(es, info);
+        Escargot::ValueRef* intArgv[1] = { Escargot::ValueRef::create(21) };
+        CHECK("Fast native function 1", twice->call(es, Escargot::ValueRef::createUndefined(), 1, intArgv)->asNumber() == 42);
+        Escargot::ValueRef* stringArgv[1] = { Escargot::StringRef::createFromASCII("1.5") };
+        CHECK("Fast native function 2", twice->call(es, Escargot::ValueRef::createUndefined(), 1, stringArgv)->asNumber() == 3);
+
+        F::FastNativeFunctionInfo stringFastInfo([](F::FastCallValue* argv) -> F::FastCallValue {
+            F::FastCallValue result;
+            result.m_string = argv[1].m_int32 ? argv[0].m_string : Escargot::StringRef::emptyString();
+            return result;
+        }, F::FastCallString, { F::FastCallString, F::FastCallInt32 });
+        F::NativeFunctionInfo stringInfo(Escargot::AtomicStringRef::create(ctx, "pick"), [](Escargot::ExecutionStateRef* state, Escargot::ValueRef* thisValue, size_t argc, Escargot::ValueRef** argv, bool isNewExpression) -> Escargot::ValueRef* {
+            return Escargot::StringRef::createFromASCII("slow");
+        }, 2, stringFastInfo, true, false);
+        F* pick = F::create(es, stringInfo);
+        Escargot::ValueRef* pickArgv[2] = { Escargot::StringRef::createFromASCII("fast"), Escargot::ValueRef::create(1) };
+        CHECK("Fast native function 3", pick->call(es, Escargot::ValueRef::createUndefined(), 2, pickArgv)->asString()->equals(Escargot::StringRef::createFromASCII("fast")));
+    }
+
+    {
+        const char* script = "var sum = 0; for (var i = 0; i < 3; i++) { sum += eval('1 + 2') + new Function('a', 'return a')(i); } sum";
+        size_t hitCount = ctx->evalCodeCacheHitCount();
+        size_t missCount = ctx->evalCodeCacheMissCount();
+
+        Escargot::ScriptRef* scriptRef = ctx->scriptParser()->parse(Escargot::StringRef::fromASCII(script, strlen(script)), Escargot::StringRef::fromASCII("EvalCodeCache.js")).m_script;
+        Escargot::SandBoxRef* sb = Escargot::SandBoxRef::create(ctx);
+        auto sandBoxResult = sb->run([&](Escargot::ExecutionStateRef* state) -> Escargot::ValueRef* {
+            return scriptRef->execute(state);
+        });
+        sb->destroy();
+
+        CHECK("Eval code cache 1", sandBoxResult.result->toNumber(es) == 12);
+        CHECK("Eval code cache 2", ctx->evalCodeCacheMissCount() - missCount == 2);
+        CHECK("Eval code cache 3", ctx->evalCodeCacheHitCount() - hitCount == 4);
+        ctx->clearEvalCodeCache();
+    }
+
+    {
+        std::string script = "function f(a) { return a + 1; }\n";
+        while (script.length() < 32 * 1024) {
+            script += "var padding = 'padding';\n";
+        }
+        script += "f(41) + f.toString().length";
+        Escargot::StringRef* source = Escargot::StringRef::createFromASCII(script.data(), script.length());
+
+        Escargot::ContextRef* ctx2 = Escargot::ContextRef::create(vm);
+        auto parseResult = ctx->scriptParser()->initializeScript(source, Escargot::StringRef::createFromASCII("SourceStore.js"));
+        auto parseResult2 = ctx2->scriptParser()->initializeScript(Escargot::StringRef::createFromASCII(script.data(), script.length()), Escargot::StringRef::createFromASCII("SourceStore.js"));
+        CHECK("Script source store 1", parseResult.script->sourceCode() == parseResult2.script->sourceCode());
+
+        vm->clearCachesRelatedWithContext();
+        CHECK("Script source store 2", parseResult2.script->sourceCode()->equals(source));
+
+        // an equal source still shares a compressed entry
+        vm->clearCachesRelatedWithContext();
+        auto parseResult3 = ctx2->scriptParser()->initializeScript(Escargot::StringRef::createFromASCII(script.data(), script.length()), Escargot::StringRef::createFromASCII("SourceStore.js"));
+        CHECK("Script source store 4", parseResult3.script->sourceCode() == parseResult.script->sourceCode());
+
+        Escargot::SandBoxRef* sb = Escargot::SandBoxRef::create(ctx);
+        auto sandBoxResult = sb->run([&](Escargot::ExecutionStateRef* state) -> Escargot::ValueRef* {
+            return parseResult.script->execute(state);
+        });
+        sb->destroy();
+        CHECK("Script source store 3", sandBoxResult.result->toNumber(es) == 73);
+        ctx2->destroy();
+    }
+
+    {
+        const char* script = "var big = 'abcdefghij'.repeat(10000); var piece = big.substring(5000, 5100); piece";
+        const char* bigScript = "big";
+        const char* check = "piece === big.substring(5000, 5100) && piece.charAt(99) === 'j'";
+        Escargot::ScriptRef* scriptRef = ctx->scriptParser()->parse(Escargot::StringRef::fromASCII(script, strlen(script)), Escargot::StringRef::fromASCII("SmallStringView.js")).m_script;
+        Escargot::ScriptRef* bigScriptRef = ctx->scriptParser()->parse(Escargot::StringRef::fromASCII(bigScript, strlen(bigScript)), Escargot::StringRef::fromASCII("SmallStringView.js")).m_script;
+        Escargot::ScriptRef* checkRef = ctx->scriptParser()->parse(Escargot::StringRef::fromASCII(check, strlen(check)), Escargot::StringRef::fromASCII("SmallStringView.js")).m_script;
+        Escargot::SandBoxRef* sb = Escargot::SandBoxRef::create(ctx);
+        auto sandBoxResult = sb->run([&](Escargot::ExecutionStateRef* state) -> Escargot::ValueRef* {
+            return scriptRef->execute(state);
+        });
+        Escargot::StringRef* piece = sandBoxResult.result->asString();
+        auto bigResult = sb->run([&](Escargot::ExecutionStateRef* state) -> Escargot::ValueRef* {
+            return bigScriptRef->execute(state);
+        });
+        Escargot::StringRef* big = bigResult.result->asString();
+
+        // the outermost execution has returned, so the piece has its own buffer
+        const char* pieceBuffer = (const char*)piece->stringBufferAccessData().buffer;
+        const char* bigBuffer = (const char*)big->stringBufferAccessData().buffer;
+        CHECK("Small string view 1", pieceBuffer < bigBuffer || pieceBuffer >= bigBuffer + big->length());
+
+        vm->clearCachesRelatedWithContext();
+        CHECK("Small string view 2", piece->length() == 100 && piece->charAt(0) == 'a');
+
+        auto checkResult = sb->run([&](Escargot::ExecutionStateRef* state) -> Escargot::ValueRef* {
+            return checkRef->execute(state);
+        });
+        sb->destroy();
+        CHECK("Small string view 3", checkResult.result->isTrue());
+    }
+
+    {
+        const char* fileName = "testapi_source_file.js";
+        FILE* fp = fopen(fileName, "w");
+        fputs("var s = 'ascii'; s.length", fp);
+        fclose(fp);
+        Escargot::OptionalRef<Escargot::StringRef> source = Escargot::StringRef::createFromUTF8File(fileName);
+        CHECK("Script source file 1", source && source->equals(Escargot::StringRef::createFromASCII("var s = 'ascii'; s.length")));
+
+        // a copied file can be rewritten while its string is alive
+        fp = fopen(fileName, "w");
+        fputs("var s = 'other'; s.length", fp);
+        fclose(fp);
+        CHECK("Script source file 2", source->equals(Escargot::StringRef::createFromASCII("var s = 'ascii'; s.length")));
+
+        auto parseResult = ctx->scriptParser()->initializeScript(source.value(), Escargot::StringRef::createFromASCII(fileName, strlen(fileName)));
+        Escargot::SandBoxRef* sb = Escargot::SandBoxRef::create(ctx);
+        auto sandBoxResult = sb->run([&](Escargot::ExecutionStateRef* state) -> Escargot::ValueRef* {
+            return parseResult.script->execute(state);
+        });
+        sb->destroy();
+        CHECK("Script source file 3", sandBoxResult.result->toNumber(es) == 5);
+        remove(fileName);
+
+        const char* utf8FileName = "testapi_source_file_utf8.js";
+        fp = fopen(utf8FileName, "w");
+        fputs("'\xea\xb0\x80'", fp);
+        fclose(fp);
+        Escargot::OptionalRef<Escargot::StringRef> utf8Source = Escargot::StringRef::createFromUTF8File(utf8FileName);
+        CHECK("Script source file 4", utf8Source && utf8Source->length() == 3 && utf8Source->charAt(1) == 0xAC00);
+        remove(utf8FileName);
+
+        CHECK("Script source file 5", !Escargot::StringRef::createFromUTF8File(fileName));
+
+        // a large ASCII file may be mapped, and reads the same as a copy
+        const char* largeFileName = "testapi_source_file_large.js";
+        std::string largeScript;
+        while (largeScript.length() < 128 * 1024) {
+            largeScript += "var padding = 'padding';\n";
+        }
+        fp = fopen(largeFileName, "w");
+        fputs(largeScript.c_str(), fp);
+        fclose(fp);
+        Escargot::OptionalRef<Escargot::StringRef> mappedSource = Escargot::StringRef::createFromUTF8File(largeFileName, true);
+        CHECK("Script source file 6", mappedSource && mappedSource->equals(Escargot::StringRef::createFromASCII(largeScript.data(), largeScript.length())));
+        CHECK("Script source file 7", mappedSource->equals(Escargot::StringRef::createFromUTF8File(largeFileName).value()));
+        remove(largeFileName);
+    }
+
+    {
+        // top level lexical names of a classic script live on the GlobalEnvironmentRecord,
+        // so there can be more of them than a 16 bit storage index holds
+        std::string script;
+        for (int i = 0; i < 66000; i++) {
+            script += "let g" + std::to_string(i) + " = " + std::to_string(i) + ";";
+        }
+        script += "g65999 + 1";
+        auto parseResult = ctx->scriptParser()->initializeScript(Escargot::StringRef::createFromASCII(script.data(), script.length()), Escargot::StringRef::createFromASCII("GlobalLexical.js"));
+        CHECK("Global lexical names 1", parseResult.isSuccessful());
+
+        Escargot::SandBoxRef* sb = Escargot::SandBoxRef::create(ctx);
+        auto sandBoxResult = sb->run([&](Escargot::ExecutionStateRef* state) -> Escargot::ValueRef* {
+            return parseResult.script->execute(state);
+        });
+        sb->destroy();
+        CHECK("Global lexical names 2", sandBoxResult.result->toNumber(es) == 66000);
+    }
+
+    {
+        // U+AC00 is outside Latin1, so the decoded source is UTF-16. templates and regular expressions are left to the parser
+        const char* script = "var t = `a${1 + 2}b`; // comment\r\nvar r = /x\\/y/g;\n'\xea\xb0\x80'.length + t.length + r.source.length + 0x10";
+        Escargot::ScriptScanningTaskRef* task = Escargot::ScriptScanningTaskRef::create(script, strlen(script));
+        std::thread worker([task]() {
+            task->run();
+        });
+        worker.join();
+        CHECK("Script scanning task 1", task->hasRun());
+
+        auto parseResult = ctx->scriptParser()->initializeScript(task, Escargot::StringRef::createFromASCII("ScanningTask.js"));
+        task->destroy();
+        CHECK("Script scanning task 2", parseResult.isSuccessful());
+
+        Escargot::SandBoxRef* sb = Escargot::SandBoxRef::create(ctx);
+        auto sandBoxResult = sb->run([&](Escargot::ExecutionStateRef* state) -> Escargot::ValueRef* {
+            return parseResult.script->execute(state);
+        });
+        sb->destroy();
+        CHECK("Script scanning task 3", sandBoxResult.result->toNumber(es) == 24);
+
+        // the task runs on the owning thread when it has not run yet, and reports the errors of the parser
+        const char* errorScript = "var a = 1;\nvar b = ;";
+        task = Escargot::ScriptScanningTaskRef::create(errorScript, strlen(errorScript));
+        auto errorResult = ctx->scriptParser()->initializeScript(task, Escargot::StringRef::createFromASCII("ScanningTask.js"));
+        task->destroy();
+        auto expectedResult = ctx->scriptParser()->initializeScript(Escargot::StringRef::createFromASCII(errorScript, strlen(errorScript)), Escargot::StringRef::createFromASCII("ScanningTask.js"));
+        CHECK("Script scanning task 4", !errorResult.isSuccessful() && errorResult.parseErrorMessage->equals(expectedResult.parseErrorMessage));
+    }
+
     es->destroy();
     ctx->destroy();
     vm->destroy();
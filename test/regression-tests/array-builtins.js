@@ -0,0 +1,229 @@
+// Array.prototype builtins on fast-mode arrays, compared with the same builtins on array-like objects, and their bail-outs
+
+function arrayLike(array) {
+    var object = { length: array.length };
+    for (var i = 0; i < array.length; i++) {
+        if (i in array) {
+            object[i] = array[i];
+        }
+    }
+    return object;
+}
+
+function describe(value) {
+    if (value === null || typeof value !== "object") {
+        return typeof value + ":" + String(value) + (value === 0 && 1 / value < 0 ? "-" : "");
+    }
+    var parts = [];
+    for (var i = 0; i < value.length; i++) {
+        parts.push(i in value ? describe(value[i]) : "hole");
+    }
+    return "[" + parts.join(",") + "]";
+}
+
+// runs a method on a fast array and on an array-like copy, and compares the results and the receivers
+function check(array, method, args, message) {
+    var like = arrayLike(array);
+    var fast = array.slice();
+    var fastResult = Array.prototype[method].apply(fast, args);
+    var genericResult = Array.prototype[method].apply(like, args);
+    if (fastResult === fast) {
+        assert(genericResult === like, message + " returns the receiver");
+    } else {
+        assertEquals(describe(fastResult), describe(genericResult), message + " result");
+    }
+    assertEquals(describe(fast), describe(like), message + " receiver");
+}
+
+var samples = [[], [1], [1, 2, 3, 4, 5], [1, , 3, , 5], ["a", NaN, -0, 0, undefined, null, "b"], [{}, [], "x", 1.5]];
+for (var i = 0; i < samples.length; i++) {
+    var s = samples[i];
+    check(s, "indexOf", [3], "indexOf " + i);
+    check(s, "indexOf", [undefined], "indexOf undefined " + i);
+    check(s, "indexOf", [0, -2], "indexOf from the end " + i);
+    check(s, "lastIndexOf", [5], "lastIndexOf " + i);
+    check(s, "includes", [NaN], "includes NaN " + i);
+    check(s, "includes", [undefined], "includes undefined " + i);
+    check(s, "slice", [1, -1], "slice " + i);
+    check(s, "splice", [1, 2, "x", "y", "z"], "splice " + i);
+    check(s, "splice", [-2], "splice from the end " + i);
+    var concatenated = s.slice();
+    concatenated[s.length] = 7;
+    concatenated[s.length + 2] = 8;
+    concatenated[s.length + 3] = 9;
+    assertEquals(describe(s.concat([7, , 8], 9)), describe(concatenated), "concat " + i);
+    check(s, "join", ["-"], "join " + i);
+    check(s, "reverse", [], "reverse " + i);
+    check(s, "push", [6, 7], "push " + i);
+    check(s, "pop", [], "pop " + i);
+    check(s, "shift", [], "shift " + i);
+    check(s, "unshift", [-1, -2], "unshift " + i);
+    check(s, "fill", [0, 1, 3], "fill " + i);
+    check(s, "map", [function(v, k) { return k + ":" + v; }], "map " + i);
+    check(s, "filter", [function(v, k) { return k % 2 === 0; }], "filter " + i);
+    check(s, "reduce", [function(a, v) { return a + "," + v; }, ""], "reduce " + i);
+    var visited = [];
+    Array.prototype.forEach.call(s, function(v, k) { visited.push(k); });
+    var expectedVisits = [];
+    for (var k = 0; k < s.length; k++) {
+        if (k in s) {
+            expectedVisits.push(k);
+        }
+    }
+    assertEquals(visited.join(), expectedVisits.join(), "forEach skips holes " + i);
+}
+assertThrows(function() {
+    [].reduce(function() {});
+}, TypeError, "reduce of an empty array");
+assertThrows(function() {
+    [, , ].reduce(function() {});
+}, TypeError, "reduce of holes only");
+
+// doubles are boxed, so a copied or moved element must not share its box with another slot
+var filled = [0, 0, 0].fill(1.5);
+filled[0] = 2.5;
+assertEquals(filled.join(), "2.5,1.5,1.5", "fill gives each slot its own double");
+var sliceSource = [1.5, 2.5];
+var sliced = sliceSource.slice();
+sliced[0] = 9.5;
+sliced.sort();
+assertEquals(sliceSource.join(), "1.5,2.5", "writing to a slice keeps the source");
+var concatSource = [1.5, 2.5];
+var concatenated = [].concat(concatSource);
+concatenated[1] = 7.5;
+assertEquals(concatSource.join(), "1.5,2.5", "writing to a concat result keeps the source");
+var spliceSource = [1.5, 2.5, 3.5];
+var removed = spliceSource.splice(1, 1);
+removed[0] = 0.5;
+assertEquals(spliceSource.join() + "/" + removed.join(), "1.5,3.5/0.5", "writing to removed elements keeps the source");
+var grown = [1.5, 2.5];
+grown.splice(0, 0, 9.5);
+assertEquals(grown.join(), "9.5,1.5,2.5", "splice inserts before moved doubles");
+var unshifted = [1.5, 2.5];
+unshifted.unshift(9.5);
+assertEquals(unshifted.join(), "9.5,1.5,2.5", "unshift inserts before moved doubles");
+unshifted[1] = 0.25;
+assertEquals(unshifted.join(), "9.5,0.25,2.5", "write after unshift");
+var shifted = [1.5, 2.5, 3.5];
+shifted.shift();
+shifted.push(4.5);
+shifted[0] = 8.5;
+assertEquals(shifted.join(), "8.5,3.5,4.5", "write after shift");
+
+// large arrays
+var large = [];
+for (var i = 0; i < 100000; i++) {
+    large.push(i);
+}
+assertEquals(large.indexOf(99999), 99999, "indexOf in a large array");
+assertEquals(large.slice(50000, 50003).join(), "50000,50001,50002", "slice of a large array");
+assertEquals(large.reduce(function(a, v) { return a + v; }, 0), 4999950000, "reduce of a large array");
+large.splice(10, 99980);
+assertEquals(large.length, 20, "splice of a large array");
+assertEquals(large[10], 99990, "element after splice");
+
+// holes read through the prototype chain
+Array.prototype[1] = "proto";
+assertEquals([0, , 2].indexOf("proto"), 1, "indexOf reads Array.prototype");
+assertEquals([0, , 2].join(), "0,proto,2", "join reads Array.prototype");
+assertEquals(describe([0, , 2].slice(0, 3)), "[number:0,string:proto,number:2]", "slice reads Array.prototype");
+assertEquals([0, , 2].map(function(v) { return v; })[1], "proto", "map reads Array.prototype");
+var reversed = [0, , 2, 3];
+reversed.reverse();
+assertEquals(describe(reversed), "[number:3,number:2,string:proto,number:0]", "reverse reads Array.prototype");
+delete Array.prototype[1];
+Object.prototype[0] = "object proto";
+assertEquals([, 1].indexOf("object proto"), 0, "indexOf reads Object.prototype");
+assertEquals([, 1].includes("object proto"), true, "includes reads Object.prototype");
+delete Object.prototype[0];
+var customProto = [ , "custom"];
+var withProto = [0, , 2];
+Object.setPrototypeOf(withProto, customProto);
+assertEquals(Array.prototype.join.call(withProto), "0,custom,2", "join reads a custom prototype");
+
+// a non-writable length
+function fixedLength() {
+    var fixed = [1, 2, 3];
+    Object.defineProperty(fixed, "length", { writable: false });
+    return fixed;
+}
+var mutators = [["push", [4]], ["pop", []], ["shift", []], ["unshift", [0]], ["splice", [0, 1]]];
+for (var i = 0; i < mutators.length; i++) {
+    var fixed = fixedLength();
+    assertThrows(function() {
+        fixed[mutators[i][0]].apply(fixed, mutators[i][1]);
+    }, TypeError, mutators[i][0] + " with a non-writable length");
+    assertEquals(fixed.length, 3, mutators[i][0] + " keeps the length");
+}
+assertEquals(fixedLength().indexOf(3), 2, "indexOf with a non-writable length");
+assertEquals(fixedLength().map(function(v) { return v * 2; }).join(), "2,4,6", "map with a non-writable length");
+var frozen = Object.freeze([1, 2, 3]);
+assertThrows(function() {
+    frozen.reverse();
+}, TypeError, "reverse of a frozen array");
+assertThrows(function() {
+    frozen.fill(0);
+}, TypeError, "fill of a frozen array");
+assertEquals(frozen.join(), "1,2,3", "frozen array unchanged");
+
+// callbacks that change the array
+var shrinking = [1, 2, 3, 4, 5];
+var seen = [];
+shrinking.forEach(function(v) {
+    seen.push(v);
+    shrinking.length = 2;
+});
+assertEquals(seen.join(), "1,2", "forEach stops after the array shrinks");
+var growing = [1, 2, 3];
+var mapped = growing.map(function(v) {
+    growing.push(v);
+    return v * 2;
+});
+assertEquals(mapped.join(), "2,4,6", "map uses the initial length");
+assertEquals(growing.length, 6, "map callback pushed");
+var accessor = [1, 2, 3, 4];
+var filtered = accessor.filter(function(v, k) {
+    if (k === 0) {
+        Object.defineProperty(accessor, 2, { get: function() { return "getter"; } });
+    }
+    return true;
+});
+assertEquals(filtered.join(), "1,2,getter,4", "filter reads a getter added by the callback");
+var sparse = [1, 2, 3, 4];
+var reduced = sparse.reduce(function(a, v, k) {
+    if (k === 0) {
+        delete sparse[2];
+    }
+    return a + v;
+}, 0);
+assertEquals(reduced, 7, "reduce skips an element deleted by the callback");
+var joinedCalls = 0;
+var joined = [1, { toString: function() { joinedCalls++; joinedArray.length = 1; return "x"; } }, 3];
+var joinedArray = joined;
+assertEquals(joined.join(), "1,x,", "join reads elements after toString shrinks the array");
+assertEquals(joinedCalls, 1, "join calls toString once");
+
+// @@species and subclasses
+class MyArray extends Array {
+}
+var mine = MyArray.from([1, 2, 3, 4]);
+assert(mine.slice(1) instanceof MyArray, "slice uses the species constructor");
+assert(mine.map(function(v) { return v; }) instanceof MyArray, "map uses the species constructor");
+assert(mine.filter(function(v) { return v > 1; }) instanceof MyArray, "filter uses the species constructor");
+assert(mine.splice(0, 1) instanceof MyArray, "splice uses the species constructor");
+assert(mine.concat([5]) instanceof MyArray, "concat uses the species constructor");
+var speciesArray = [1, 2, 3];
+speciesArray.constructor = {};
+speciesArray.constructor[Symbol.species] = function(length) {
+    return { length: 0, custom: true };
+};
+assert(speciesArray.slice(0).custom, "slice creates a non-array species");
+assertEquals(speciesArray.map(function(v) { return v + 1; })[2], 4, "map writes into a non-array species");
+
+// concat and isConcatSpreadable
+var spreadable = { length: 2, 0: "a", 1: "b" };
+spreadable[Symbol.isConcatSpreadable] = true;
+assertEquals([1].concat(spreadable, [2]).join(), "1,a,b,2", "concat spreads an array-like");
+var notSpread = [3, 4];
+notSpread[Symbol.isConcatSpreadable] = false;
+assertEquals([1].concat(notSpread).length, 2, "concat keeps a non-spreadable array");
@@ -0,0 +1,134 @@
+// Array.prototype.sort on fast-mode arrays: default order, integer keys, comparators, stability, holes and throwing comparators
+
+// a plain insertion sort is the reference; it is stable
+function referenceSort(array, compare) {
+    var result = array.slice();
+    for (var i = 1; i < result.length; i++) {
+        var value = result[i];
+        var j = i - 1;
+        while (j >= 0 && compare(result[j], value) > 0) {
+            result[j + 1] = result[j];
+            j--;
+        }
+        result[j + 1] = value;
+    }
+    return result;
+}
+
+function defaultCompare(a, b) {
+    var x = String(a);
+    var y = String(b);
+    return x < y ? -1 : (x > y ? 1 : 0);
+}
+
+var seed = 12345;
+function random() {
+    seed = (seed * 1103515245 + 12345) % 2147483648;
+    return seed / 2147483648;
+}
+
+var inputs = {
+    "small ints": [3, 1, 2],
+    "int32": [],
+    "negative ints": [],
+    "doubles": [],
+    "strings": [],
+    "mixed": [10, "9", 1.5, -0, 0, "a", true, null, {}, [2, 1], NaN, -Infinity, Infinity, 2147483647, -2147483648, 1e21]
+};
+for (var i = 0; i < 300; i++) {
+    inputs["int32"].push((random() * 1000) | 0);
+    inputs["negative ints"].push(((random() - 0.5) * 4294967296) | 0);
+    inputs["doubles"].push((random() - 0.5) * 1e6);
+    inputs["strings"].push("s" + ((random() * 100) | 0) + (i % 3 ? "é" : "가"));
+}
+for (var name in inputs) {
+    var input = inputs[name];
+    assertArrayEquals(input.slice().sort(), referenceSort(input, defaultCompare), "default sort of " + name);
+    if (name !== "mixed" && name !== "strings") {
+        var numeric = function(a, b) {
+            return a - b;
+        };
+        assertArrayEquals(input.slice().sort(numeric), referenceSort(input, numeric), "numeric sort of " + name);
+        var descending = function(a, b) {
+            return b - a;
+        };
+        assertArrayEquals(input.slice().sort(descending), referenceSort(input, descending), "descending sort of " + name);
+    }
+}
+
+// integer keys must order like their decimal strings
+assertArrayEquals([10, 9, 1, -1, -10, 100, 0, -0, 2].sort(), [-1, -10, 0, -0, 1, 10, 100, 2, 9], "decimal string order");
+assertEquals(1 / [0, -0].sort()[1], -Infinity, "-0 keeps its place after 0");
+
+// a comparator sort is stable, also over long runs that are merged
+var records = [];
+for (var i = 0; i < 1000; i++) {
+    records.push({ key: (random() * 10) | 0, order: i });
+}
+var byKey = function(a, b) {
+    return a.key - b.key;
+};
+var sortedRecords = records.slice().sort(byKey);
+for (var i = 1; i < sortedRecords.length; i++) {
+    var a = sortedRecords[i - 1];
+    var b = sortedRecords[i];
+    assert(a.key < b.key || (a.key === b.key && a.order < b.order), "stable order at " + i);
+}
+var almostSorted = [];
+for (var i = 0; i < 2000; i++) {
+    almostSorted.push(i % 100 === 0 ? 2000 - i : i);
+}
+assertArrayEquals(almostSorted.slice().sort(function(a, b) { return a - b; }), referenceSort(almostSorted, function(a, b) { return a - b; }), "almost sorted input");
+var reversed = [];
+for (var i = 0; i < 1000; i++) {
+    reversed.push(1000 - i);
+}
+assertArrayEquals(reversed.slice().sort(function(a, b) { return a - b; }), referenceSort(reversed, function(a, b) { return a - b; }), "reversed input");
+
+// undefined values go last and holes are removed from the end
+var withHoles = [3, undefined, , 1, , undefined, 2];
+withHoles.sort();
+assertEquals(withHoles.length, 7, "length is kept");
+assertArrayEquals(withHoles.slice(0, 5), [1, 2, 3, undefined, undefined], "values then undefined");
+assert(!(5 in withHoles) && !(6 in withHoles), "holes at the end");
+var comparatorCalls = 0;
+[undefined, 2, undefined, 1].sort(function(a, b) {
+    comparatorCalls++;
+    assert(a !== undefined && b !== undefined, "the comparator never sees undefined");
+    return a - b;
+});
+assert(comparatorCalls > 0, "the comparator is called");
+
+// comparators that throw, return odd values or change the array
+var original = [5, 4, 3, 2, 1];
+var throwing = original.slice();
+assertThrows(function() {
+    throwing.sort(function(a, b) {
+        throw new RangeError("stop");
+    });
+}, RangeError, "a throwing comparator");
+assertArrayEquals(throwing, original, "nothing is written back after a throw");
+assertArrayEquals([3, 1, 2].sort(function(a, b) { return a > b; }).length === 3 ? [1, 2, 3] : [], [1, 2, 3], "boolean result");
+assertEquals([2, 1, 3].sort(function() { return NaN; }).length, 3, "NaN result");
+var mutated = [5, 1, 4, 2, 3];
+mutated.sort(function(a, b) {
+    mutated.push(0);
+    return a - b;
+});
+assertArrayEquals(mutated.slice(0, 5), [1, 2, 3, 4, 5], "comparator that pushes");
+var objectKeys = [{ toString: function() { return "b"; } }, { toString: function() { return "a"; } }];
+assertEquals(String(objectKeys.sort()[0]), "a", "toString is used for the default order");
+assertThrows(function() {
+    [1, 2].sort("not a function");
+}, TypeError, "a non-callable comparator");
+
+// non-fast-mode objects use the generic path
+var arrayLike = { length: 4, 0: "d", 1: "b", 3: "a" };
+Array.prototype.sort.call(arrayLike);
+assertEquals(arrayLike[0] + arrayLike[1] + arrayLike[2], "abd", "array-like sort");
+assert(!(3 in arrayLike), "array-like hole moved to the end");
+var sparse = [];
+sparse[100000] = 1;
+sparse[5] = 2;
+sparse.sort();
+assertEquals(sparse[0] + sparse[1], 3, "sparse array sort");
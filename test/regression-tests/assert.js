@@ -0,0 +1,34 @@
+// assertion helpers loaded before every file in this directory
+// usage: escargot test/regression-tests/assert.js test/regression-tests/<test>.js
+
+function assert(condition, message) {
+    if (!condition) {
+        throw new Error("Assertion failed" + (message ? ": " + message : ""));
+    }
+}
+
+function assertEquals(actual, expected, message) {
+    var same = actual === expected ? (actual !== 0 || 1 / actual === 1 / expected) : (actual !== actual && expected !== expected);
+    if (!same) {
+        throw new Error("Assertion failed" + (message ? ": " + message : "") + ": expected " + String(expected) + " but got " + String(actual));
+    }
+}
+
+function assertArrayEquals(actual, expected, message) {
+    assertEquals(actual.length, expected.length, (message ? message + ": " : "") + "length");
+    for (var i = 0; i < expected.length; i++) {
+        assertEquals(actual[i], expected[i], (message ? message + ": " : "") + "index " + i);
+    }
+}
+
+function assertThrows(fn, errorType, message) {
+    try {
+        fn();
+    } catch (e) {
+        if (errorType && !(e instanceof errorType)) {
+            throw new Error("Assertion failed" + (message ? ": " + message : "") + ": unexpected " + e);
+        }
+        return;
+    }
+    throw new Error("Assertion failed" + (message ? ": " + message : "") + ": no exception thrown");
+}
@@ -0,0 +1,79 @@
+// eval and Function constructor sources reused through the per-Context eval code cache
+
+// the same indirect eval several times, so later runs come from the cache
+var ie = eval;
+for (var i = 0; i < 4; i++) {
+    assertEquals(ie("var sloppyValue = 3; sloppyValue"), 3, "sloppy indirect eval run " + i);
+    assertEquals(ie("'use strict'; var strictValue = 5; strictValue"), 5, "strict indirect eval run " + i);
+    assertEquals(typeof strictValue, "undefined", "strict eval keeps its vars run " + i);
+    assertEquals(ie("let lexicalValue = 1; lexicalValue"), 1, "let in indirect eval run " + i);
+    assertEquals(ie("const c = [" + 1 + "]; c.length"), 1, "const in indirect eval run " + i);
+}
+assertEquals(sloppyValue, 3, "sloppy indirect eval declares a global");
+
+// a cached indirect eval sees the current global state
+var counter = 0;
+for (var i = 0; i < 5; i++) {
+    ie("counter++");
+}
+assertEquals(counter, 5, "indirect eval side effects");
+
+// direct eval is keyed on its caller, so the same source resolves different scopes
+function outer(x) {
+    return eval("x + 1");
+}
+function other(x) {
+    var y = 100;
+    return eval("x + 1") + y;
+}
+for (var i = 0; i < 3; i++) {
+    assertEquals(outer(i), i + 1, "direct eval in outer run " + i);
+    assertEquals(other(i), i + 101, "direct eval in other run " + i);
+}
+
+// strictness of the caller changes the parse
+function sloppyCaller() {
+    eval("var leaked = 1");
+    return typeof leaked;
+}
+function strictCaller() {
+    "use strict";
+    eval("var leaked = 1");
+    return typeof leaked;
+}
+for (var i = 0; i < 3; i++) {
+    assertEquals(sloppyCaller(), "number", "sloppy direct eval declares in the caller run " + i);
+    assertEquals(strictCaller(), "undefined", "strict direct eval keeps its vars run " + i);
+}
+
+// eval inside with
+var scope = { w: 7 };
+for (var i = 0; i < 3; i++) {
+    with (scope) {
+        assertEquals(eval("w * 2"), 14, "direct eval in with run " + i);
+    }
+}
+
+// the Function constructor returns a new function object each time
+var f1 = new Function("a", "b", "return a + b");
+var f2 = new Function("a", "b", "return a + b");
+assert(f1 !== f2, "distinct function objects");
+assertEquals(f1(1, 2), 3, "first Function");
+assertEquals(f2(3, 4), 7, "second Function");
+f1.marker = true;
+assertEquals(f2.marker, undefined, "functions do not share properties");
+assertEquals(f1.toString(), f2.toString(), "same source text");
+
+// a cached source that throws keeps throwing
+for (var i = 0; i < 3; i++) {
+    assertThrows(function() {
+        ie("throw new TypeError('x')");
+    }, TypeError, "throwing eval run " + i);
+    assertThrows(function() {
+        ie("(");
+    }, SyntaxError, "syntax error run " + i);
+}
+
+// the same source first run as eval and then as a Function body
+assertEquals(ie("1 + 2"), 3, "eval of a body");
+assertEquals(new Function("1 + 2")(), undefined, "Function of the same body");
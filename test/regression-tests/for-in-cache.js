@@ -0,0 +1,138 @@
+// for-in keys cached on the object structure: reuse across loops, changes between loops and mutation during a loop
+
+function keys(object) {
+    var result = [];
+    for (var key in object) {
+        result.push(key);
+    }
+    return result.join();
+}
+
+// objects of one shape share the cached keys but not the values
+var records = [];
+for (var i = 0; i < 20; i++) {
+    records.push({ id: i, name: "n" + i, flag: true });
+}
+for (var i = 0; i < records.length; i++) {
+    assertEquals(keys(records[i]), "id,name,flag", "record " + i);
+}
+var sum = 0;
+for (var i = 0; i < records.length; i++) {
+    for (var key in records[i]) {
+        if (key === "id") {
+            sum += records[i][key];
+        }
+    }
+}
+assertEquals(sum, 190, "values read through cached keys");
+
+// property changes between loops
+var object = { a: 1, b: 2 };
+assertEquals(keys(object), "a,b", "first loop");
+assertEquals(keys(object), "a,b", "second loop");
+object.c = 3;
+assertEquals(keys(object), "a,b,c", "after adding a property");
+delete object.a;
+assertEquals(keys(object), "b,c", "after deleting a property");
+object.a = 4;
+assertEquals(keys(object), "b,c,a", "after adding it back");
+Object.defineProperty(object, "b", { enumerable: false });
+assertEquals(keys(object), "c,a", "after making a property non-enumerable");
+Object.defineProperty(object, "b", { enumerable: true });
+assertEquals(keys(object), "b,c,a", "after making it enumerable again");
+object[1] = "one";
+object[0] = "zero";
+assertEquals(keys(object), "0,1,b,c,a", "integer keys come first");
+var sameShape = { b: 0, c: 0, a: 0 };
+assertEquals(keys(sameShape), "b,c,a", "an object built in the same order");
+
+// prototype changes between loops
+var proto = { inherited: 1 };
+var child = Object.create(proto);
+child.own = 2;
+assertEquals(keys(child), "own,inherited", "inherited key");
+proto.more = 3;
+assertEquals(keys(child), "own,inherited,more", "key added to the prototype");
+child.inherited = 4;
+assertEquals(keys(child), "own,inherited,more", "shadowed key appears once");
+delete proto.inherited;
+delete child.inherited;
+assertEquals(keys(child), "own,more", "key deleted from both");
+Object.setPrototypeOf(child, { other: 5 });
+assertEquals(keys(child), "own,other", "after changing the prototype");
+Object.setPrototypeOf(child, null);
+assertEquals(keys(child), "own", "after removing the prototype");
+var plain = { x: 1 };
+assertEquals(keys(plain), "x", "plain object");
+Object.prototype.added = 1;
+assertEquals(keys(plain), "x,added", "enumerable key on Object.prototype");
+Object.defineProperty(Object.prototype, "added", { enumerable: false });
+assertEquals(keys(plain), "x", "non-enumerable key on Object.prototype");
+delete Object.prototype.added;
+assertEquals(keys(plain), "x", "Object.prototype restored");
+var nonEnumerableShadow = Object.create({ hidden: 1 });
+Object.defineProperty(nonEnumerableShadow, "hidden", { value: 2, enumerable: false });
+assertEquals(keys(nonEnumerableShadow), "", "non-enumerable own key shadows an enumerable inherited key");
+
+// mutation during a loop
+var mutated = { a: 1, b: 2, c: 3, d: 4 };
+var visited = [];
+for (var key in mutated) {
+    visited.push(key);
+    if (key === "a") {
+        delete mutated.c;
+    }
+}
+assertEquals(visited.join(), "a,b,d", "key deleted before it is visited is skipped");
+assertEquals(keys({ a: 1, b: 2, c: 3, d: 4 }), "a,b,c,d", "cached keys are not changed by the deletion");
+mutated = { a: 1, b: 2 };
+visited = [];
+for (var key in mutated) {
+    visited.push(key);
+    mutated["new" + visited.length] = 0;
+    if (visited.length > 10) {
+        break;
+    }
+}
+assert(visited.length <= 4, "keys added during the loop do not loop forever");
+assertEquals(visited.slice(0, 2).join(), "a,b", "original keys are visited");
+assertEquals(keys({ a: 1, b: 2 }), "a,b", "cached keys are not changed by the additions");
+var protoDuringLoop = Object.create({ p: 1, q: 2 });
+protoDuringLoop.own = 0;
+visited = [];
+for (var key in protoDuringLoop) {
+    visited.push(key);
+    if (key === "own") {
+        delete Object.getPrototypeOf(protoDuringLoop).q;
+    }
+}
+assertEquals(visited.join(), "own,p", "inherited key deleted during the loop");
+
+// nested loops over the same object and loops over other kinds of objects
+var nested = { x: 1, y: 2 };
+var pairs = [];
+for (var outer in nested) {
+    for (var inner in nested) {
+        pairs.push(outer + inner);
+    }
+}
+assertEquals(pairs.join(), "xx,xy,yx,yy", "nested loops");
+assertEquals(keys([5, 6, 7]), "0,1,2", "array");
+var sparse = [1, , 3];
+sparse.extra = true;
+assertEquals(keys(sparse), "0,2,extra", "sparse array with a named property");
+assertEquals(keys("ab"), "0,1", "string primitive");
+assertEquals(keys(new String("ab")), "0,1", "String object");
+assertEquals(keys(new Uint8Array(2)), "0,1", "typed array");
+assertEquals(keys(null) + keys(undefined) + keys(42), "", "null, undefined and a number");
+assertEquals(keys(new Proxy({ a: 1, b: 2 }, {})), "a,b", "proxy");
+var withArgs = (function() { return keys(arguments); })(1, 2);
+assertEquals(withArgs, "0,1", "arguments object");
+function F() {
+    this.own = 1;
+}
+F.prototype.method = function() {};
+assertEquals(keys(new F()), "own,method", "instance with a method on the prototype");
+assertEquals(keys(new F()), "own,method", "second instance");
+F.prototype.method2 = function() {};
+assertEquals(keys(new F()), "own,method,method2", "after adding a method");
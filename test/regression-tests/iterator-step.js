@@ -0,0 +1,187 @@
+// Stepping the built-in iterators without result objects, and the patched next methods that must take the generic protocol
+
+function collect(iterable) {
+    var result = [];
+    for (var value of iterable) {
+        result.push(value);
+    }
+    return result;
+}
+
+var arrayIteratorPrototype = Object.getPrototypeOf([][Symbol.iterator]());
+var stringIteratorPrototype = Object.getPrototypeOf(""[Symbol.iterator]());
+var mapIteratorPrototype = Object.getPrototypeOf(new Map()[Symbol.iterator]());
+var setIteratorPrototype = Object.getPrototypeOf(new Set()[Symbol.iterator]());
+
+// every consumer sees the same values on the unmodified iterators
+var map = new Map([[1, "a"], [2, "b"]]);
+var set = new Set([1, 2, 2, 3]);
+assertArrayEquals(collect([1, , 3]), [1, undefined, 3], "for-of over an array with a hole");
+assertArrayEquals(collect("a😀b"), ["a", "😀", "b"], "for-of over a string with a surrogate pair");
+assertEquals(collect(map).join(";"), "1,a;2,b", "for-of over a Map");
+assertArrayEquals(collect(set), [1, 2, 3], "for-of over a Set");
+assertArrayEquals(collect(map.keys()), [1, 2], "for-of over Map keys");
+assertEquals(collect([5, 6].entries()).join(";"), "0,5;1,6", "for-of over array entries");
+assertArrayEquals([...set, ..."xy"], [1, 2, 3, "x", "y"], "spread");
+var [first, , third, ...rest] = [1, 2, 3, 4, 5];
+assertEquals(first + third, 4, "array destructuring");
+assertArrayEquals(rest, [4, 5], "rest element");
+var [x, y = 10] = "z";
+assertEquals(x + y, "z10", "destructuring a string with a default");
+assertArrayEquals(Array.from(set), [1, 2, 3], "Array.from a Set");
+assertArrayEquals(Array.from(new Uint8Array(Array.from("abc", function(c) { return c.charCodeAt(0); }))), [97, 98, 99], "Array.from with a map function");
+assertArrayEquals(Array.from(Uint8Array.from(set)), [1, 2, 3], "TypedArray.from a Set");
+assertEquals(new Map(map).get(2), "b", "Map from a Map");
+assertEquals(new Set("hello").size, 4, "Set from a string");
+var key = {};
+assert(new WeakMap([[key, 1]]).has(key) && new WeakSet([key]).has(key), "WeakMap and WeakSet from arrays");
+
+// an array that grows while it is iterated
+var growing = [1, 2];
+var seen = [];
+for (var value of growing) {
+    seen.push(value);
+    if (growing.length < 5) {
+        growing.push(value * 10);
+    }
+}
+assertArrayEquals(seen, [1, 2, 10, 20, 100], "array grows during for-of");
+
+// a Set that changes while it is iterated
+var changing = new Set([1, 2, 3]);
+seen = [];
+for (var value of changing) {
+    seen.push(value);
+    if (value === 1) {
+        changing.delete(2);
+        changing.add(4);
+    }
+}
+assertArrayEquals(seen, [1, 3, 4], "Set changes during for-of");
+
+// a patched next on the prototype is called on every step
+function patchNext(prototype, body) {
+    var original = prototype.next;
+    var calls = 0;
+    prototype.next = function() {
+        calls++;
+        return body ? body.call(this, original) : original.call(this);
+    };
+    return {
+        calls: function() { return calls; },
+        restore: function() { prototype.next = original; }
+    };
+}
+
+var patch = patchNext(arrayIteratorPrototype);
+assertArrayEquals(collect([1, 2, 3]), [1, 2, 3], "patched array next");
+assertEquals(patch.calls(), 4, "patched array next called for each step and the end");
+assertArrayEquals([...[4, 5]], [4, 5], "spread with a patched next");
+var [a, b] = [6, 7, 8];
+assertEquals(a + b, 13, "destructuring with a patched next");
+assertArrayEquals(Array.from([9]), [9], "Array.from with a patched next");
+assertEquals(new Set([1, 1, 2]).size, 2, "Set constructor with a patched next");
+assertEquals(patch.calls(), 4 + 3 + 2 + 2 + 4, "patched array next call count");
+patch.restore();
+
+// a next that changes the values and the result objects
+patch = patchNext(arrayIteratorPrototype, function(original) {
+    var result = original.call(this);
+    return result.done ? result : { value: result.value * 2, done: false };
+});
+assertArrayEquals(collect([1, 2]), [2, 4], "next that doubles the values");
+assertArrayEquals([...[3]], [6], "spread of doubled values");
+assertThrows(function() {
+    new Map([[1, 2]]);
+}, TypeError, "Map constructor sees the changed entry");
+patch.restore();
+
+patch = patchNext(stringIteratorPrototype, function(original) {
+    var result = original.call(this);
+    return { value: result.done ? undefined : result.value.toUpperCase(), done: result.done };
+});
+assertArrayEquals(collect("ab"), ["A", "B"], "patched string next");
+patch.restore();
+
+patch = patchNext(mapIteratorPrototype);
+assertEquals(collect(map).length, 2, "patched Map next");
+assertEquals(new Map(map).size, 2, "Map constructor with a patched Map next");
+assertEquals(patch.calls(), 6, "patched Map next call count");
+patch.restore();
+
+patch = patchNext(setIteratorPrototype);
+assertEquals(new Set(set).size, 3, "Set constructor with a patched Set next");
+assertEquals(patch.calls(), 4, "patched Set next call count");
+patch.restore();
+
+// a next that returns a result object with getters, or a primitive
+patch = patchNext(arrayIteratorPrototype, function(original) {
+    var result = original.call(this);
+    var log = this.log;
+    return {
+        get value() { log.push("value"); return result.value; },
+        get done() { log.push("done"); return result.done; }
+    };
+});
+var iterated = [1, 2];
+var iterator = iterated[Symbol.iterator]();
+iterator.log = [];
+var values = [];
+for (var value of { [Symbol.iterator]: function() { return iterator; } }) {
+    values.push(value);
+}
+assertArrayEquals(values, [1, 2], "values from getters");
+assertEquals(iterator.log.join(), "done,value,done,value,done", "done is read before value and value once per step");
+patch.restore();
+
+patch = patchNext(arrayIteratorPrototype, function() {
+    return 1;
+});
+assertThrows(function() {
+    collect([1]);
+}, TypeError, "next that returns a primitive");
+patch.restore();
+
+// a next on the iterator itself, and an iterator without the built-in prototype
+var own = [1, 2, 3][Symbol.iterator]();
+own.next = function() {
+    return { value: "own", done: this.stop = !this.stop };
+};
+assertArrayEquals(collect({ [Symbol.iterator]: function() { return own; } }), [], "own next is used");
+assertThrows(function() {
+    arrayIteratorPrototype.next.call({});
+}, TypeError, "next on a plain object");
+assertThrows(function() {
+    collect({ [Symbol.iterator]: function() { return Object.create(arrayIteratorPrototype); } });
+}, TypeError, "for-of over an object that only inherits ArrayIterator.prototype");
+assertThrows(function() {
+    new Set({ [Symbol.iterator]: function() { return arrayIteratorPrototype; } });
+}, TypeError, "Set constructor over ArrayIterator.prototype itself");
+
+// a patched Symbol.iterator replaces the iterator entirely
+var originalIterator = Array.prototype[Symbol.iterator];
+Array.prototype[Symbol.iterator] = function*() {
+    yield "patched";
+};
+assertArrayEquals(collect([1, 2]), ["patched"], "patched Array.prototype[Symbol.iterator]");
+assertArrayEquals([...[1, 2]], ["patched"], "spread with a patched Symbol.iterator");
+Array.prototype[Symbol.iterator] = originalIterator;
+assertArrayEquals([...[1, 2]], [1, 2], "restored Symbol.iterator");
+
+// return is called when a consumer stops early
+var returned = 0;
+var closable = {
+    [Symbol.iterator]: function() {
+        var count = 0;
+        return {
+            next: function() { return { value: count++, done: false }; },
+            return: function() { returned++; return {}; }
+        };
+    }
+};
+for (var value of closable) {
+    if (value === 2) {
+        break;
+    }
+}
+assertEquals(returned, 1, "return after break");
@@ -0,0 +1,93 @@
+// JSON.parse without an intermediate document: values, escapes, numbers, syntax errors and the reviver
+
+assertEquals(JSON.parse("null"), null, "null");
+assertEquals(JSON.parse(" true "), true, "true with whitespace");
+assertEquals(JSON.parse("\t\r\n false"), false, "false with whitespace");
+assertEquals(JSON.parse('"text"'), "text", "string");
+assertEquals(JSON.parse("[]").length, 0, "empty array");
+assertEquals(Object.keys(JSON.parse("{}")).length, 0, "empty object");
+var nested = JSON.parse('{"a": [1, {"b": [true, null, "c"]}], "d": {"e": {}}}');
+assertEquals(nested.a[1].b[2], "c", "nested value");
+assert(Array.isArray(nested.a) && !Array.isArray(nested.d), "arrays and objects");
+
+// numbers
+var numbers = ["0", "-0", "1", "-1", "1.5", "1e3", "1E-3", "-1.25e+2", "2147483647", "-2147483648", "2147483648",
+    "9007199254740993", "1e308", "1e400", "-1e400", "5e-324", "0.1", "123456789012345678901234567890"];
+for (var i = 0; i < numbers.length; i++) {
+    assertEquals(JSON.parse(numbers[i]), Number(numbers[i]), "number " + numbers[i]);
+    assertEquals(JSON.parse("[" + numbers[i] + "]")[0], Number(numbers[i]), "number in an array " + numbers[i]);
+}
+
+// escapes
+assertEquals(JSON.parse('"\\"\\\\\\/\\b\\f\\n\\r\\t"'), "\"\\/\b\f\n\r\t", "simple escapes");
+assertEquals(JSON.parse('"\\u0041\\u00e9\\uac00"'), "A\u00e9\uac00", "unicode escapes");
+assertEquals(JSON.parse('"\\ud83d\\ude00"'), "\ud83d\ude00", "escaped surrogate pair");
+assertEquals(JSON.parse('"\\ud83d"').charCodeAt(0), 0xd83d, "escaped lone surrogate");
+assertEquals(JSON.parse('"\u00e9\uac00\ud83d\ude00"'), "\u00e9\uac00\ud83d\ude00", "raw non-ASCII characters");
+var long = "";
+for (var i = 0; i < 200; i++) {
+    long += "plain text " + i + " ";
+}
+assertEquals(JSON.parse('"' + long + '\\n' + long + '"'), long + "\n" + long, "escape after a long run");
+assertEquals(JSON.parse('{"k\\u0065y": 1}').key, 1, "escaped key");
+
+// keys
+var keys = JSON.parse('{"b": 1, "2": 2, "a": 3, "1": 4, "b": 5}');
+assertEquals(keys.b, 5, "the last duplicate key wins");
+assertEquals(Object.keys(keys).join(), "1,2,b,a", "integer keys come first");
+var proto = JSON.parse('{"__proto__": {"x": 1}}');
+assert(Object.prototype.hasOwnProperty.call(proto, "__proto__"), "__proto__ is an own property");
+assertEquals(Object.getPrototypeOf(proto), Object.prototype, "__proto__ does not set the prototype");
+assertEquals(proto.x, undefined, "__proto__ value is not inherited");
+
+// syntax errors
+var invalid = ["", " ", "[1,]", "{\"a\":1,}", "{a:1}", "'a'", "01", "1.", ".1", "+1", "-", "1e", "0x10", "[1 2]",
+    "{\"a\" 1}", "\"\\x41\"", "\"\\u00g0\"", "\"a\nb\"", "\"\t\"", "\"unterminated", "[", "{", "nul", "truex", "1 2", "NaN", "Infinity", "undefined", "[1]]"];
+for (var i = 0; i < invalid.length; i++) {
+    assertThrows(function() {
+        JSON.parse(invalid[i]);
+    }, SyntaxError, "invalid " + JSON.stringify(invalid[i]));
+}
+
+// deep nesting and large arrays
+var depth = 500;
+var deep = JSON.parse(new Array(depth + 1).join("[") + "1" + new Array(depth + 1).join("]"));
+for (var i = 0; i < depth; i++) {
+    deep = deep[0];
+}
+assertEquals(deep, 1, "deeply nested arrays");
+var items = [];
+for (var i = 0; i < 10000; i++) {
+    items.push(i % 3 ? i : "s" + i);
+}
+var parsedItems = JSON.parse(JSON.stringify(items));
+assertEquals(parsedItems.length, items.length, "large array length");
+assertEquals(parsedItems[9998], items[9998], "large array element");
+
+// the reviver walks the result bottom up and may drop or replace values
+var order = [];
+var revived = JSON.parse('{"a": [1, 2], "b": {"c": 3}, "d": 4}', function(key, value) {
+    order.push(key);
+    if (key === "d") {
+        return undefined;
+    }
+    return typeof value === "number" ? value * 10 : value;
+});
+assertEquals(order.join(), "0,1,a,c,b,d,", "reviver order");
+assertEquals(revived.a[1], 20, "revived array element");
+assertEquals(revived.b.c, 30, "revived nested value");
+assert(!("d" in revived), "reviver removes a property");
+var holder = JSON.parse("[1, 2, 3]", function(key, value) {
+    if (key === "0") {
+        this[2] = "changed";
+    }
+    return value;
+});
+assertEquals(holder[2], "changed", "reviver sees later siblings as changed");
+
+// the input is converted to a string first
+assertEquals(JSON.parse(123), 123, "number input");
+assertEquals(JSON.parse({ toString: function() { return "[7]"; } })[0], 7, "object input");
+assertThrows(function() {
+    JSON.parse(undefined);
+}, SyntaxError, "undefined input");
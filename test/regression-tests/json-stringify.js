@@ -0,0 +1,128 @@
+// JSON.stringify fast path for plain objects and arrays, and the cases where it must fall back to the generic algorithm
+
+// an identity replacer forces the generic algorithm
+function generic(value) {
+    return JSON.stringify(value, function(key, value) {
+        return value;
+    });
+}
+
+assertEquals(JSON.stringify({ a: 1, b: "two", c: true, d: null, e: [1, 2, 3] }), '{"a":1,"b":"two","c":true,"d":null,"e":[1,2,3]}', "plain object");
+assertEquals(JSON.stringify([]), "[]", "empty array");
+assertEquals(JSON.stringify({}), "{}", "empty object");
+assertEquals(JSON.stringify([-0, 1.5, -2147483648, 2147483647, 1e21, NaN, Infinity]), "[0,1.5,-2147483648,2147483647,1e+21,null,null]", "numbers");
+assertEquals(JSON.stringify({ u: undefined, f: function() {}, s: Symbol("s"), k: 1 }), '{"k":1}', "skipped values");
+assertEquals(JSON.stringify([undefined, function() {}, Symbol("s")]), "[null,null,null]", "skipped values in arrays");
+assertEquals(JSON.stringify([1, , 3]), "[1,null,3]", "hole");
+
+// escaping
+assertEquals(JSON.stringify("quote \" backslash \\ newline \n tab \t control \u0001 del \u007f"), '"quote \\" backslash \\\\ newline \\n tab \\t control \\u0001 del \u007f"', "escapes");
+assertEquals(JSON.stringify({ "key\"with\nescapes": "é가" }), '{"key\\"with\\nescapes":"é가"}', "escaped key and wide value");
+var surrogates = "\ud800 \udc00 😀";
+assertEquals(JSON.stringify([surrogates]), JSON.stringify([surrogates], null, ""), "surrogates match the generic path");
+assertEquals(JSON.stringify(surrogates).length, surrogates.length + 2, "surrogates are not escaped");
+var long = "";
+for (var i = 0; i < 100; i++) {
+    long += "plain text run " + i + " ";
+}
+assertEquals(JSON.parse(JSON.stringify(long + "\"" + long)), long + "\"" + long, "escape after a long plain run");
+
+// many objects of the same shape share one key layout, with values of different types
+var rows = [];
+for (var i = 0; i < 50; i++) {
+    rows.push({ id: i, name: "row" + i, flag: i % 2 === 0, nested: i % 5 ? null : { x: i } });
+}
+assertEquals(JSON.stringify(JSON.parse(JSON.stringify(rows))), JSON.stringify(rows), "round trip of rows");
+assertEquals(JSON.stringify(rows[5]), '{"id":5,"name":"row5","flag":false,"nested":{"x":5}}', "row with nested object");
+assertEquals(JSON.stringify(rows), generic(rows), "rows match the generic path");
+
+// an own toJSON, enumerable or not
+assertEquals(JSON.stringify({ a: 1, toJSON: function() { return "own"; } }), '"own"', "enumerable own toJSON");
+var hidden = { a: 1 };
+Object.defineProperty(hidden, "toJSON", { value: function() { return "x"; } });
+assertEquals(JSON.stringify(hidden), '"x"', "non-enumerable own toJSON");
+assertEquals(JSON.stringify([hidden, { a: 1 }]), '["x",{"a":1}]', "non-enumerable toJSON inside an array");
+var hiddenArray = [1, 2];
+Object.defineProperty(hiddenArray, "toJSON", { value: function() { return "array"; } });
+assertEquals(JSON.stringify(hiddenArray), '"array"', "non-enumerable toJSON on an array");
+assertEquals(JSON.stringify(new Date(0)), '"1970-01-01T00:00:00.000Z"', "Date.prototype.toJSON");
+
+// toJSON on a prototype
+var proto = { toJSON: function() { return "proto"; } };
+assertEquals(JSON.stringify(Object.create(proto)), '"proto"', "toJSON on a custom prototype");
+Object.prototype.toJSON = function() { return "object prototype"; };
+assertEquals(JSON.stringify({ a: 1 }), '"object prototype"', "toJSON on Object.prototype");
+delete Object.prototype.toJSON;
+Array.prototype.toJSON = function() { return "array prototype"; };
+assertEquals(JSON.stringify([1]), '"array prototype"', "toJSON on Array.prototype");
+delete Array.prototype.toJSON;
+assertEquals(JSON.stringify({ a: [1] }), '{"a":[1]}', "default prototypes again");
+
+// holes read through the prototype chain
+Array.prototype[1] = "from prototype";
+assertEquals(JSON.stringify([0, , 2]), '[0,"from prototype",2]', "hole reads Array.prototype");
+delete Array.prototype[1];
+Object.prototype[1] = "from object prototype";
+assertEquals(JSON.stringify([0, , 2]), '[0,"from object prototype",2]', "hole reads Object.prototype");
+delete Object.prototype[1];
+
+// accessors, non-enumerable and symbol keys
+var calls = 0;
+var withGetter = { a: 1, get b() { calls++; return calls; } };
+assertEquals(JSON.stringify(withGetter), '{"a":1,"b":1}', "getter is called");
+assertEquals(JSON.stringify(withGetter), '{"a":1,"b":2}', "getter is called again");
+var withHidden = { a: 1 };
+Object.defineProperty(withHidden, "b", { value: 2, enumerable: false });
+withHidden[Symbol("c")] = 3;
+withHidden.d = 4;
+assertEquals(JSON.stringify(withHidden), '{"a":1,"d":4}', "non-enumerable and symbol keys are skipped");
+var arrayWithGetter = [1, 2, 3];
+Object.defineProperty(arrayWithGetter, 1, { get: function() { return "got"; }, enumerable: true });
+assertEquals(JSON.stringify(arrayWithGetter), '[1,"got",3]', "array element getter");
+
+// a getter that changes the object being serialized
+var mutating = { a: 1, get b() { mutating.c = 3; return 2; } };
+assertEquals(JSON.stringify(mutating), '{"a":1,"b":2}', "keys are taken before a getter adds one");
+
+// wrapper objects, proxies and other objects take the generic path
+assertEquals(JSON.stringify([new Number(1), new String("s"), new Boolean(false)]), '[1,"s",false]', "wrapper objects");
+assertEquals(JSON.stringify(new Proxy({ a: 1 }, {})), '{"a":1}', "proxy");
+assertEquals(JSON.stringify(new Proxy([1, 2], {})), "[1,2]", "array proxy");
+assertEquals(JSON.stringify({ m: new Map([[1, 2]]), r: /x/ }), '{"m":{},"r":{}}', "other objects");
+
+// key order matches the generic algorithm
+var ordered = { b: 1, 2: "two", a: 2, 1: "one" };
+assertEquals(JSON.stringify(ordered), generic(ordered), "integer and string keys");
+ordered.c = 3;
+delete ordered.b;
+ordered.b = 4;
+assertEquals(JSON.stringify(ordered), generic(ordered), "keys after delete and re-add");
+
+// objects with many properties
+var big = {};
+for (var i = 0; i < 100; i++) {
+    big["p" + i] = i;
+}
+var bigJSON = JSON.stringify(big);
+assertEquals(JSON.stringify(JSON.parse(bigJSON)), bigJSON, "large object round trip");
+delete big.p50;
+assertEquals(bigJSON.replace(',"p50":50', ""), JSON.stringify(big), "large object after delete");
+
+// cycles
+var cyclic = { a: [] };
+cyclic.a.push(cyclic);
+assertThrows(function() {
+    JSON.stringify(cyclic);
+}, TypeError, "cycle through an array");
+var cyclicArray = [];
+cyclicArray.push([cyclicArray]);
+assertThrows(function() {
+    JSON.stringify(cyclicArray);
+}, TypeError, "cycle of arrays");
+var shared = { x: 1 };
+assertEquals(JSON.stringify([shared, shared]), '[{"x":1},{"x":1}]', "shared object is not a cycle");
+
+// replacer and gap use the generic algorithm
+assertEquals(JSON.stringify({ a: 1, b: 2 }, ["b"]), '{"b":2}', "replacer array");
+assertEquals(JSON.stringify({ a: 1, b: 2 }, function(k, v) { return k === "a" ? undefined : v; }), '{"b":2}', "replacer function");
+assertEquals(JSON.stringify({ a: [1] }, null, 2), '{\n  "a": [\n    1\n  ]\n}', "gap");
@@ -0,0 +1,81 @@
+// Keyword recognition: every keyword, identifiers that differ from one by a character or a length, escaped keywords and contextual keywords
+
+var keywords = ["break", "case", "catch", "class", "const", "continue", "debugger", "default", "delete", "do", "else", "enum", "export", "extends", "false", "finally", "for", "function", "if", "import", "in", "instanceof", "new", "null", "return", "super", "switch", "this", "throw", "true", "try", "typeof", "var", "void", "while", "with"];
+var strictKeywords = ["implements", "interface", "let", "package", "private", "protected", "public", "static", "yield"];
+
+function isIdentifier(name, strict) {
+    try {
+        (0, eval)((strict ? "'use strict'; " : "") + "(function() { var " + name + " = 1; return " + name + "; })");
+        return true;
+    } catch (e) {
+        assert(e instanceof SyntaxError, name + " throws a SyntaxError");
+        return false;
+    }
+}
+
+for (var i = 0; i < keywords.length; i++) {
+    var keyword = keywords[i];
+    assert(!isIdentifier(keyword, false), keyword + " is a keyword");
+    assertEquals(({ [keyword]: i })[keyword], i, keyword + " as a computed property name");
+    assertEquals(eval("({ " + keyword + ": " + i + " })." + keyword), i, keyword + " as a property name");
+
+    // near misses: one character changed, added or removed, and a different case
+    var nearMisses = [keyword.substring(0, 2) + "X" + keyword.substring(3), keyword + "x", keyword.substring(1), keyword.substring(0, keyword.length - 1) + "Z", "x" + keyword, keyword.toUpperCase(), keyword[0].toUpperCase() + keyword.substring(1), keyword + "$", keyword + "_", keyword + "0"];
+    for (var j = 0; j < nearMisses.length; j++) {
+        var name = nearMisses[j];
+        if (keywords.indexOf(name) === -1 && strictKeywords.indexOf(name) === -1 && name !== "" && name.length > 1) {
+            assert(isIdentifier(name, false), name + " is an identifier");
+            assert(isIdentifier(name, true), name + " is an identifier in strict code");
+        }
+    }
+}
+
+for (var i = 0; i < strictKeywords.length; i++) {
+    var keyword = strictKeywords[i];
+    // let and yield are also rejected in sloppy code here, so only strict code is checked for them
+    if (keyword !== "let" && keyword !== "yield") {
+        assert(isIdentifier(keyword, false), keyword + " is an identifier in sloppy code");
+    }
+    assert(!isIdentifier(keyword, true), keyword + " is reserved in strict code");
+}
+
+// names that only look like keywords
+var lookalikes = ["of", "get", "set", "async", "target", "as", "from", "constructor", "prototype", "undefined", "NaN", "arguments", "eval", "ifx", "i", "n", "fo", "forr", "functio", "functions", "instanceOf", "typeOf", "nul", "tru", "fals", "whilee", "caseless", "trying", "deleted"];
+for (var i = 0; i < lookalikes.length; i++) {
+    var name = lookalikes[i];
+    if (name === "arguments" || name === "eval") {
+        assert(isIdentifier(name, false), name + " is an identifier in sloppy code");
+        assert(!isIdentifier(name, true), name + " cannot be bound in strict code");
+    } else if (name !== "undefined" && name !== "NaN") {
+        assert(isIdentifier(name, false), name + " is an identifier");
+    }
+}
+
+// identifiers and property names written with escapes
+assertEquals(eval("var \\u0061bc = 1; abc"), 1, "escaped identifier");
+assertEquals(eval("({ \\u0069f: 2 }).if"), 2, "escaped keyword as a property name");
+assertEquals(eval("var f\\u006fo = 3; foo"), 3, "escape in the middle of an identifier");
+assertEquals(eval("var whil\\u0065x = 4; whilex"), 4, "escape inside a near miss");
+
+// contextual keywords
+var of = [1];
+for (var x of of) {
+    assertEquals(x, 1, "of as a variable");
+}
+var get = 1, set = 2;
+var accessors = { get get() { return get; }, set set(v) { set = v; } };
+accessors.set = 4;
+assertEquals(accessors.get + set, 5, "get and set as names of accessors");
+function* generator() {
+    var received = yield 7;
+    return received;
+}
+var it = generator();
+assertEquals(it.next().value, 7, "yield inside a generator");
+assertEquals(it.next(8).value, 8, "yield result");
+assertEquals((function() { "use strict"; let a = 10; return a; })(), 10, "let declaration in strict code");
+function Target() {
+    return new.target === Target;
+}
+assert(new Target() && !Target(), "new.target inside a function");
+assertEquals(class { static static() { return "static"; } }.static(), "static", "static as a method name");
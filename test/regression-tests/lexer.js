@@ -0,0 +1,57 @@
+// Scanner runs skipped in bulk: long identifiers, string literals, comments and indentation, and sources that end inside them
+
+function repeat(str, count) {
+    var result = "";
+    for (var i = 0; i < count; i++) {
+        result += str;
+    }
+    return result;
+}
+
+// identifiers around SCANNER_BULK_SCAN_MIN_LENGTH
+var lengths = [1, 15, 16, 17, 40, 1000];
+for (var i = 0; i < lengths.length; i++) {
+    var name = "v" + repeat("a_$9", lengths[i]).substring(0, lengths[i] - 1);
+    assertEquals(eval("var " + name + " = " + i + "; " + name), i, "identifier of length " + lengths[i]);
+}
+assertEquals(eval("var " + repeat("x", 30) + "\\u0061 = 7; " + repeat("x", 30) + "a"), 7, "escape after a long identifier");
+assertEquals(eval("var " + repeat("y", 30) + "가 = 8; " + repeat("y", 30) + "가"), 8, "non-ASCII after a long identifier");
+
+// string literals with quotes, escapes and non-ASCII characters after a long plain run
+var plain = repeat("plain text ", 10);
+assertEquals(eval("'" + plain + "'"), plain, "long single quoted string");
+assertEquals(eval('"' + plain + "'" + plain + '"'), plain + "'" + plain, "other quote inside");
+assertEquals(eval("'" + plain + "\\n" + plain + "'"), plain + "\n" + plain, "escape after a long run");
+assertEquals(eval("'" + plain + "é가" + plain + "'"), plain + "é가" + plain, "non-ASCII after a long run");
+assertEquals(eval("'" + plain + "\\\n" + plain + "'"), plain + plain, "line continuation after a long run");
+assertThrows(function() {
+    eval("'" + plain + "\n'");
+}, SyntaxError, "line terminator inside a string");
+assertThrows(function() {
+    eval("'" + plain);
+}, SyntaxError, "unterminated string");
+assertThrows(function() {
+    eval("'" + plain + "\u2028'");
+}, SyntaxError, "U+2028 inside a string");
+
+// comments and indentation
+var comment = repeat("comment text ", 20);
+assertEquals(eval("1 // " + comment + "\n + 2"), 3, "single-line comment");
+assertEquals(eval("1 /* " + comment + "\n" + comment + " */ + 2"), 3, "multi-line comment");
+assertEquals(eval("1 /* " + comment + "**/ + 2"), 3, "multi-line comment ending in stars");
+assertEquals(eval("1 // " + comment + "\u2028 + 2"), 3, "single-line comment ended by U+2028");
+assertEquals(eval("1 // " + comment), 1, "single-line comment at the end");
+assertThrows(function() {
+    eval("1 /* " + comment);
+}, SyntaxError, "unterminated multi-line comment");
+assertEquals(eval("1\n" + repeat(" ", 40) + "+\n\t\t\t\t2\r\n        + 3"), 6, "indentation");
+
+// sources that end right after a line terminator, also when they are slices of a longer string
+var endings = ["1\n", "1\r\n", "1\r", "1\u2028", "1\n   ", "1\n\t"];
+for (var i = 0; i < endings.length; i++) {
+    assertEquals(eval(endings[i]), 1, "source ending " + JSON.stringify(endings[i]));
+    assertEquals(new Function("return " + endings[i])(), 1, "function body ending " + JSON.stringify(endings[i]));
+}
+var padded = repeat("1 + 1;\n", 10) + repeat(" ", 64);
+assertEquals(eval(padded.substring(0, padded.length - 64)), 2, "slice ending in a newline before indentation");
+assertEquals(eval(padded.substring(0, padded.length - 32)), 2, "slice ending inside indentation");
@@ -0,0 +1,87 @@
+// RopeString reads without flattening: charAt, substring, deep rope rebalancing and flattening after many reads
+
+// builds the same text as a rope and as a flat string
+function build(pieces) {
+    var rope = "";
+    for (var i = 0; i < pieces.length; i++) {
+        rope += pieces[i];
+    }
+    return [rope, pieces.join("")];
+}
+
+function check(rope, flat, message) {
+    assertEquals(rope.length, flat.length, message + " length");
+    for (var i = 0; i < flat.length; i += 7) {
+        assertEquals(rope.charAt(i), flat.charAt(i), message + " charAt " + i);
+        assertEquals(rope.charCodeAt(i), flat.charCodeAt(i), message + " charCodeAt " + i);
+    }
+    assertEquals(rope.charAt(flat.length), "", message + " charAt past the end");
+    assert(isNaN(rope.charCodeAt(-1)), message + " charCodeAt before the start");
+    var bounds = [0, 1, 23, 24, 25, 100, flat.length >> 1, flat.length - 1, flat.length];
+    for (var i = 0; i < bounds.length; i++) {
+        for (var j = i; j < bounds.length; j++) {
+            assertEquals(rope.substring(bounds[i], bounds[j]), flat.substring(bounds[i], bounds[j]), message + " substring " + bounds[i] + " " + bounds[j]);
+        }
+    }
+    assertEquals(rope, flat, message + " equality");
+}
+
+// a deep left-leaning rope, deeper than ROPE_STRING_MAX_DEPTH
+var pieces = [];
+for (var i = 0; i < 300; i++) {
+    pieces.push("piece" + i + "-abcdefghijklmnopqrstuvwxyz;");
+}
+var built = build(pieces);
+check(built[0], built[1], "deep rope");
+
+// a right-leaning rope
+var right = "";
+for (var i = 0; i < 200; i++) {
+    right = "right" + i + "-0123456789012345678901234567890" + right;
+}
+var rightFlat = "";
+for (var i = 199; i >= 0; i--) {
+    rightFlat += "right" + i + "-0123456789012345678901234567890";
+}
+check(right, rightFlat, "right rope");
+
+// a rope with 16-bit leaves next to 8-bit ones
+var mixedPieces = [];
+for (var i = 0; i < 100; i++) {
+    mixedPieces.push(i % 3 ? "latin1 text éè number " + i : "utf16 text 가한 number " + i);
+}
+var mixed = build(mixedPieces);
+check(mixed[0], mixed[1], "mixed rope");
+assertEquals(mixed[0].codePointAt(mixed[1].indexOf("가")), 0xac00, "codePointAt on a 16-bit leaf");
+
+// surrogate pairs split across leaves
+var pair = "";
+for (var i = 0; i < 40; i++) {
+    pair += "0123456789012345678901234\ud83d";
+    pair += "\ude00";
+}
+assertEquals(pair.codePointAt(25), 0x1f600, "codePointAt across leaves");
+
+// reading one rope more than ROPE_STRING_ACCESS_COUNT_BEFORE_FLATTEN times
+var many = build(pieces.slice(0, 50));
+var sum = 0;
+var expected = 0;
+for (var i = 0; i < many[1].length; i++) {
+    sum += many[0].charCodeAt(i);
+    expected += many[1].charCodeAt(i);
+}
+assertEquals(sum, expected, "repeated reads");
+
+// appending while reading keeps earlier reads valid
+var growing = "";
+for (var i = 0; i < 500; i++) {
+    growing += "chunk-" + i + "-padding-padding-padding";
+    var last = growing.charAt(growing.length - 1);
+    assertEquals(last, "g", "read after append " + i);
+}
+assertEquals(growing.indexOf("chunk-499"), growing.length - "chunk-499-padding-padding-padding".length, "indexOf after appends");
+
+// substring of a substring of a rope
+var sub = built[0].substring(10, 5000).substring(100, 3000);
+assertEquals(sub, built[1].substring(10, 5000).substring(100, 3000), "nested substring");
+assertEquals(built[0].slice(-100), built[1].slice(-100), "slice from the end");
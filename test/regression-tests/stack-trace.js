@@ -0,0 +1,111 @@
+// Line and column numbers in Error.stack, from raw frames recorded at throw time and formatted when stack is read
+
+// the line and column of each "at" line that points into this file
+function positions(error) {
+    var result = [];
+    var lines = error.stack.split("\n");
+    for (var i = 0; i < lines.length; i++) {
+        var match = /^at .*stack-trace\.js:(\d+):(\d+)$/.exec(lines[i]);
+        if (match) {
+            result.push(match[1] + ":" + match[2]);
+        }
+    }
+    return result;
+}
+
+function thrower() {
+    throw new Error("thrower");
+}
+
+function caller() {
+    return 1 +
+        thrower();
+}
+
+try {
+    caller();
+} catch (e) {
+    assertEquals(positions(e).slice(0, 3).join(), "17:5,22:9,26:5", "throw, multi-line call and top level");
+    assertEquals(e.stack.split("\n")[0], "Error: thrower", "first line of the stack");
+}
+
+// runtime errors raised by the engine point at the expression
+function nullAccess(object) {
+    var unused = 0;
+    return object.property.missing;
+}
+try {
+    nullAccess({});
+} catch (e) {
+    assert(e instanceof TypeError, "TypeError from a property read");
+    assertEquals(positions(e)[0], "35:12", "property read of undefined");
+}
+try {
+    (function() {
+        undefinedVariable;
+    })();
+} catch (e) {
+    assertEquals(positions(e)[0], "45:9", "ReferenceError");
+}
+
+// positions after long lines and many statements
+var padding = "";
+for (var i = 0; i < 200; i++) {
+    padding += "var padding" + i + " = " + i + ";\n";
+}
+try {
+    eval(padding + "  throw new RangeError('deep');");
+} catch (e) {
+    assertEquals(positions(e)[1], "57:5", "caller of eval code");
+}
+try {
+    new Function("a", padding + "return a.b.c;")({});
+} catch (e) {
+    assertEquals(/^at .*:(\d+):(\d+)$/m.exec(e.stack).slice(1).join(":"), "204:8", "line and column inside a Function constructor body");
+}
+
+// a rethrow records the frames again
+function rethrow() {
+    try {
+        thrower();
+    } catch (e) {
+        throw e;
+    }
+}
+try {
+    rethrow();
+} catch (e) {
+    assertEquals(positions(e)[0], "72:9", "rethrow records the frames of the last throw");
+}
+
+// an error that is created but not thrown has no stack, and reading the stack twice gives the same text
+assertEquals(new Error("not thrown").stack, undefined, "error that was never thrown");
+try {
+    caller();
+} catch (e) {
+    var firstRead = e.stack;
+    assertEquals(e.stack, firstRead, "second read of the stack");
+}
+
+// frames through native functions and recursion
+try {
+    [1].map(function() {
+        thrower();
+    });
+} catch (e) {
+    assertEquals(positions(e).slice(0, 2).join(), "17:5,93:9", "frames through Array.prototype.map");
+}
+function recurse(depth) {
+    if (depth === 0) {
+        thrower();
+    }
+    recurse(depth - 1);
+}
+try {
+    recurse(50);
+} catch (e) {
+    var frames = positions(e);
+    assertEquals(frames[0], "17:5", "top frame of a recursion");
+    assertEquals(frames[1], "100:9", "bottom call of a recursion");
+    assert(frames.length > 2 && frames[2] === "102:5", "recursive frames");
+}
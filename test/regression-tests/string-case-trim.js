@@ -0,0 +1,65 @@
+// toLowerCase, toUpperCase and trim with ASCII runs next to Latin1 and 16-bit characters, and UTF-8 decoding of this file
+
+function perChar(str, method) {
+    var result = "";
+    for (var i = 0; i < str.length; i++) {
+        result += str.charAt(i)[method]();
+    }
+    return result;
+}
+
+function repeat(str, count) {
+    var result = "";
+    for (var i = 0; i < count; i++) {
+        result += str;
+    }
+    return result;
+}
+
+// ASCII runs of every length around the vector width, followed by other characters
+var ascii = "The Quick Brown Fox Jumps Over The Lazy Dog 0123456789 @[`{";
+// the reference maps one code unit at a time, so the tails stay in the BMP
+var tails = ["", "é", "ÿ", "µ", "ß", "가", "Σ"];
+for (var length = 0; length < 50; length += 7) {
+    for (var i = 0; i < tails.length; i++) {
+        var str = repeat(ascii, 2).substring(0, length) + tails[i] + ascii;
+        assertEquals(str.toLowerCase(), perChar(str, "toLowerCase"), "toLowerCase " + length + " " + i);
+        assertEquals(str.toUpperCase(), perChar(str, "toUpperCase"), "toUpperCase " + length + " " + i);
+    }
+}
+
+// characters whose mapping leaves Latin1 or the BMP
+assertEquals("ÿ".toUpperCase(), "Ÿ", "y with diaeresis");
+assertEquals("µ".toUpperCase(), "Μ", "micro sign");
+assertEquals("ǅ".toLowerCase(), "ǆ", "titlecase digraph");
+assertEquals("𐐀".toLowerCase(), "𐐨", "supplementary character");
+assertEquals("ÀÉÎÕÜ".toLowerCase(), "àéîõü", "Latin1 letters");
+assertEquals("àéîõü".toUpperCase(), "ÀÉÎÕÜ", "Latin1 letters upper");
+var mixedCase = repeat("MiXeD CaSe ", 20);
+assertEquals(mixedCase.toLowerCase(), repeat("mixed case ", 20), "long ASCII lower");
+assertEquals(mixedCase.toUpperCase(), repeat("MIXED CASE ", 20), "long ASCII upper");
+assertEquals("lower".toLowerCase(), "lower", "already lower");
+assertEquals("".toUpperCase(), "", "empty");
+
+// trim with ASCII and Unicode whitespace
+var spaces = [" ", "\t", "\n", "\v", "\f", "\r", "\u00a0", "\u1680", "\u2000", "\u200a", "\u2028", "\u2029", "\u202f", "\u205f", "\u3000", "\ufeff"];
+for (var i = 0; i < spaces.length; i++) {
+    var padding = repeat(spaces[i], 20);
+    assertEquals((padding + "x y" + padding).trim(), "x y", "trim space " + i);
+}
+assertEquals("\u200b x".trim(), "\u200b x", "U+200B is not whitespace");
+assertEquals(repeat(" ", 100).trim(), "", "only spaces");
+assertEquals("no padding".trim(), "no padding", "nothing to trim");
+assertEquals("  가  ".trim(), "가", "16-bit content");
+assertEquals((repeat(" ", 40) + repeat("é", 40)).trim(), repeat("é", 40), "Latin1 content trimmed");
+
+// this file is decoded from UTF-8, so its literals must match their escapes
+assertEquals("é", "\u00e9", "two byte sequence");
+assertEquals("가", "\uac00", "three byte sequence");
+assertEquals("😀", "\ud83d\ude00", "four byte sequence");
+assertEquals(repeat("ascii ", 10) + "ÿ" + repeat("ascii ", 10), repeat("ascii ", 10) + "\u00ff" + repeat("ascii ", 10), "Latin1 after an ASCII run");
+assertEquals("😀".length, 2, "four byte sequence becomes a surrogate pair");
+
+// UTF-8 encoding through the URI functions
+assertEquals(encodeURIComponent("aé가😀"), "a%C3%A9%EA%B0%80%F0%9F%98%80", "encodeURIComponent");
+assertEquals(decodeURIComponent("a%C3%A9%EA%B0%80%F0%9F%98%80"), "a\u00e9\uac00\ud83d\ude00", "decodeURIComponent");
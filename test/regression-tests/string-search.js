@@ -0,0 +1,121 @@
+// indexOf, lastIndexOf, includes, equality and comparison on 8-bit, 16-bit and mixed strings, checked against plain loops
+
+function naiveIndexOf(haystack, needle, from) {
+    from = Math.min(Math.max(from | 0, 0), haystack.length);
+    for (var i = from; i + needle.length <= haystack.length; i++) {
+        var j = 0;
+        while (j < needle.length && haystack.charCodeAt(i + j) === needle.charCodeAt(j)) {
+            j++;
+        }
+        if (j === needle.length) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+function naiveLastIndexOf(haystack, needle, from) {
+    from = Math.min(Math.max(from | 0, 0), haystack.length - needle.length);
+    for (var i = from; i >= 0; i--) {
+        var j = 0;
+        while (j < needle.length && haystack.charCodeAt(i + j) === needle.charCodeAt(j)) {
+            j++;
+        }
+        if (j === needle.length) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+function naiveCompare(a, b) {
+    var length = Math.min(a.length, b.length);
+    for (var i = 0; i < length; i++) {
+        if (a.charCodeAt(i) !== b.charCodeAt(i)) {
+            return a.charCodeAt(i) < b.charCodeAt(i) ? -1 : 1;
+        }
+    }
+    return a.length === b.length ? 0 : (a.length < b.length ? -1 : 1);
+}
+
+function checkSearch(haystack, needle, message) {
+    var positions = [0, 1, 15, 16, 17, 31, 32, 33, haystack.length >> 1, haystack.length - 1, haystack.length];
+    for (var i = 0; i < positions.length; i++) {
+        var p = positions[i];
+        assertEquals(haystack.indexOf(needle, p), naiveIndexOf(haystack, needle, p), message + " indexOf from " + p);
+        assertEquals(haystack.lastIndexOf(needle, p), naiveLastIndexOf(haystack, needle, p), message + " lastIndexOf from " + p);
+    }
+    assertEquals(haystack.indexOf(needle), naiveIndexOf(haystack, needle, 0), message + " indexOf");
+    assertEquals(haystack.lastIndexOf(needle), naiveLastIndexOf(haystack, needle, haystack.length), message + " lastIndexOf");
+    assertEquals(haystack.includes(needle), naiveIndexOf(haystack, needle, 0) !== -1, message + " includes");
+}
+
+// haystacks whose lengths cross the vector widths, with the match at every alignment
+var filler = "abcdefghijklmnopqrstuvwxyz";
+for (var length = 1; length < 70; length += 3) {
+    var base = "";
+    while (base.length < length) {
+        base += filler;
+    }
+    base = base.substring(0, length);
+    var wideBase = base.replace(/c/g, "가");
+    checkSearch(base, "x", "8-bit length " + length);
+    checkSearch(base + "x", "x", "8-bit last char length " + length);
+    checkSearch(wideBase + "x", "x", "8-bit needle in 16-bit haystack length " + length);
+    checkSearch(base + "가", "가", "16-bit needle at the end length " + length);
+    checkSearch(base, "가", "16-bit needle missing from 8-bit haystack length " + length);
+    checkSearch(wideBase, "가d", "16-bit two char needle length " + length);
+    checkSearch(base + base, base, "needle equal to half length " + length);
+}
+
+// long needles with repeated prefixes, where a shifting search can skip a match
+var periodic = "";
+for (var i = 0; i < 300; i++) {
+    periodic += i % 7 ? "ab" : "aab";
+}
+var needles = ["aab", "abaab", "ababababaab", "aabababababaabab", "abababababababababababababaab", "abababababababababababababac"];
+for (var i = 0; i < needles.length; i++) {
+    checkSearch(periodic, needles[i], "periodic needle " + needles[i]);
+    checkSearch(periodic.replace(/b/g, "é"), needles[i].replace(/b/g, "é"), "Latin1 periodic needle " + i);
+    checkSearch(periodic.replace(/b/g, "가"), needles[i].replace(/b/g, "가"), "16-bit periodic needle " + i);
+}
+var long = "";
+for (var i = 0; i < 2000; i++) {
+    long += "word" + (i % 97) + " ";
+}
+checkSearch(long, "word96 word0 word1 word2", "long needle across the period");
+checkSearch(long, "word96 word0 word1 word3", "missing long needle");
+
+// empty needles and needles longer than the haystack
+assertEquals("abc".indexOf("", 2), 2, "empty needle");
+assertEquals("abc".indexOf("", 10), 3, "empty needle past the end");
+assertEquals("abc".lastIndexOf(""), 3, "empty needle from the end");
+assertEquals("abc".indexOf("abcd"), -1, "needle longer than the haystack");
+assertEquals("abc".lastIndexOf("abcd"), -1, "lastIndexOf with a needle longer than the haystack");
+assertEquals("abcabc".lastIndexOf("abc", -5), 0, "negative lastIndexOf position");
+assertEquals("abcabc".lastIndexOf("c", NaN), 5, "NaN lastIndexOf position");
+assert("prefix text".startsWith("prefix") && "text suffix".endsWith("suffix"), "startsWith and endsWith");
+
+// equality and comparison of 8-bit and 16-bit strings with the same code units
+var latin1 = "";
+for (var i = 0; i < 256; i++) {
+    latin1 += String.fromCharCode(i);
+}
+var widened = (latin1 + "가").substring(0, 256);
+assert(latin1 === widened, "Latin1 string equals its 16-bit copy");
+assertEquals(naiveCompare(latin1, widened), 0, "naive compare of equal strings");
+var strings = ["", "a", "ab", "abc", "abd", "abÿ", "abĀ", "가", "가a", latin1, latin1 + "a", widened + "가"];
+for (var i = 0; i < strings.length; i++) {
+    for (var j = 0; j < strings.length; j++) {
+        var a = strings[i];
+        var b = strings[j];
+        var expected = naiveCompare(a, b);
+        assertEquals(a < b, expected < 0, "less than " + i + " " + j);
+        assertEquals(a > b, expected > 0, "greater than " + i + " " + j);
+        assertEquals(a === b, expected === 0, "equality " + i + " " + j);
+    }
+}
+var sorted = strings.slice().sort();
+for (var i = 1; i < sorted.length; i++) {
+    assert(naiveCompare(sorted[i - 1], sorted[i]) <= 0, "sorted strings " + i);
+}
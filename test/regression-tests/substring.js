@@ -0,0 +1,65 @@
+// String::substring views and copies: short and long slices, slices of slices and slices of large strings
+
+var alphabet = "abcdefghijklmnopqrstuvwxyz0123456789";
+var text = "";
+for (var i = 0; i < 100; i++) {
+    text += alphabet;
+}
+var wide = text.replace(/a/g, "가");
+
+function expected(str, from, to) {
+    var result = "";
+    for (var i = from; i < to; i++) {
+        result += str[i];
+    }
+    return result;
+}
+
+// lengths around STRING_SUB_STRING_MIN_VIEW_LENGTH
+var lengths = [0, 1, 31, 32, 33, 34, 100, 1000];
+for (var i = 0; i < lengths.length; i++) {
+    var from = 17;
+    var to = from + lengths[i];
+    assertEquals(text.substring(from, to), expected(text, from, to), "8-bit substring of length " + lengths[i]);
+    assertEquals(wide.substring(from, to), expected(wide, from, to), "16-bit substring of length " + lengths[i]);
+    assertEquals(text.slice(from, to).length, lengths[i], "slice length " + lengths[i]);
+}
+assertEquals(text.substring(0, text.length), text, "full range");
+assertEquals(text.substring(text.length, text.length), "", "empty range at the end");
+
+// a slice of a slice reads the same characters as a slice of the original
+var outer = text.substring(100, 2000);
+var inner = outer.substring(50, 500);
+assertEquals(inner, text.substring(150, 600), "slice of a slice");
+assertEquals(inner.substring(10, 60), text.substring(160, 210), "slice of a slice of a slice");
+assertEquals(wide.substring(3, 3000).substring(40, 90), wide.substring(43, 93), "16-bit slice of a slice");
+assertEquals(inner.charCodeAt(0), text.charCodeAt(150), "charCodeAt of a slice");
+assertEquals(inner.indexOf(alphabet), text.indexOf(alphabet, 150) - 150, "indexOf in a slice");
+
+// small slices of a string far longer than STRING_SUB_STRING_VIEW_COMPACT_PARENT_LENGTH
+var big = text;
+while (big.length < 200000) {
+    big += big;
+}
+var pieces = [];
+for (var i = 0; i < 100; i++) {
+    pieces.push(big.substring(i * 1000, i * 1000 + 40 + i));
+}
+for (var i = 0; i < pieces.length; i++) {
+    assertEquals(pieces[i], expected(big, i * 1000, i * 1000 + 40 + i), "small piece " + i);
+}
+assertEquals(big.slice(-50), expected(big, big.length - 50, big.length), "small slice from the end");
+assertEquals(big.substring(1000, 150000).length, 149000, "large slice");
+
+// trim, split and RegExp results are substrings too
+var padded = "   " + text.substring(0, 100) + "   ";
+assertEquals(padded.trim(), text.substring(0, 100), "trim");
+var lines = [];
+for (var i = 0; i < 50; i++) {
+    lines.push("line " + i + " " + alphabet);
+}
+var split = lines.join("\n").split("\n");
+assertArrayEquals(split, lines, "split lines");
+var match = /(\d+) ([a-z0-9]+)/.exec(lines[42]);
+assertEquals(match[0], "42 " + alphabet, "match");
+assertEquals(match[2], alphabet, "capture");
@@ -0,0 +1,127 @@
+// Typed array element loads and stores from GetObject and SetObjectOperation, with sites that see several types and the cases that leave the fast path
+
+var types = [Int8Array, Uint8Array, Uint8ClampedArray, Int16Array, Uint16Array, Int32Array, Uint32Array, Float32Array, Float64Array];
+
+// one load site and one store site shared by every type
+function load(array, index) {
+    return array[index];
+}
+
+function store(array, index, value) {
+    array[index] = value;
+}
+
+var inputs = [0, 1, -1, 127, 128, 255, 256, 1.5, 2.5, -1.5, 65535, 65536, 2147483647, 2147483648, 4294967295, -2147483649, 1e10, NaN, Infinity, -Infinity, -0, 3.4028235677973366e38];
+var expectedByType = {
+    Int8Array: [0, 1, -1, 127, -128, -1, 0, 1, 2, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0],
+    Uint8Array: [0, 1, 255, 127, 128, 255, 0, 1, 2, 255, 255, 0, 255, 0, 255, 255, 0, 0, 0, 0, 0, 0],
+    Uint8ClampedArray: [0, 1, 0, 127, 128, 255, 255, 2, 2, 0, 255, 255, 255, 255, 255, 0, 255, 0, 255, 0, 0, 255],
+    Int16Array: [0, 1, -1, 127, 128, 255, 256, 1, 2, -1, -1, 0, -1, 0, -1, -1, -7168, 0, 0, 0, 0, 0],
+    Uint16Array: [0, 1, 65535, 127, 128, 255, 256, 1, 2, 65535, 65535, 0, 65535, 0, 65535, 65535, 58368, 0, 0, 0, 0, 0],
+    Int32Array: [0, 1, -1, 127, 128, 255, 256, 1, 2, -1, 65535, 65536, 2147483647, -2147483648, -1, 2147483647, 1410065408, 0, 0, 0, 0, 0],
+    Uint32Array: [0, 1, 4294967295, 127, 128, 255, 256, 1, 2, 4294967295, 65535, 65536, 2147483647, 2147483648, 4294967295, 2147483647, 1410065408, 0, 0, 0, 0, 0],
+    Float32Array: [0, 1, -1, 127, 128, 255, 256, 1.5, 2.5, -1.5, 65535, 65536, 2147483648, 2147483648, 4294967296, -2147483648, 10000000000, NaN, Infinity, -Infinity, -0, Infinity],
+    Float64Array: inputs
+};
+
+for (var t = 0; t < types.length; t++) {
+    var Type = types[t];
+    var typed = new Type(inputs.length);
+    var expected = expectedByType[Type.name];
+    for (var i = 0; i < inputs.length; i++) {
+        store(typed, i, inputs[i]);
+    }
+    for (var i = 0; i < inputs.length; i++) {
+        assert(Object.is(load(typed, i), expected[i]), Type.name + " store and load " + inputs[i] + ": got " + load(typed, i));
+    }
+
+    // out of bounds and non-integer keys never reach the buffer
+    assertEquals(load(typed, typed.length), undefined, Type.name + " load past the end");
+    assertEquals(load(typed, -1), undefined, Type.name + " load at -1");
+    store(typed, typed.length, 1);
+    assertEquals(typed.length, inputs.length, Type.name + " length after a store past the end");
+    assertEquals(typed.hasOwnProperty(typed.length), false, Type.name + " no element past the end");
+    assertEquals(load(typed, "1.5"), undefined, Type.name + " load of a non-integer key");
+    assertEquals(load(typed, "-0"), undefined, Type.name + " load of -0 as a string");
+    assert(Object.is(load(typed, "3"), expected[3]), Type.name + " load of an index string");
+    store(typed, "3", 5);
+    assertEquals(load(typed, 3), 5, Type.name + " store to an index string");
+}
+
+// stores of values that are not numbers call valueOf once per store
+var calls = 0;
+var valueObject = { valueOf: function() { calls++; return 42; } };
+var ints = new Int32Array(4);
+store(ints, 2, valueObject);
+assertEquals(calls, 1, "valueOf on an in-bounds store");
+assertEquals(load(ints, 2), 42, "value from valueOf");
+store(ints, 2, valueObject);
+assertEquals(calls, 2, "valueOf on a second store at the same site");
+store(ints, 1, "17");
+assertEquals(load(ints, 1), 17, "string store");
+store(ints, 0, true);
+assertEquals(load(ints, 0), 1, "boolean store");
+store(ints, 3, undefined);
+assertEquals(load(ints, 3), 0, "undefined store");
+assertThrows(function() {
+    store(ints, 0, Symbol("s"));
+}, TypeError, "symbol store");
+var floats = new Float64Array(2);
+store(floats, 0, null);
+store(floats, 1, "abc");
+assertEquals(load(floats, 0), 0, "null store");
+assert(isNaN(load(floats, 1)), "NaN string store");
+
+// a site that alternates between typed arrays, plain arrays and other objects
+var mixed = [new Uint8Array([1, 2]), [3, 4], new Float32Array([5.5, 6.5]), { 0: 7, 1: 8 }, "9a", new Int16Array([-1, -2])];
+var loaded = [];
+for (var round = 0; round < 3; round++) {
+    for (var i = 0; i < mixed.length; i++) {
+        loaded.push(load(mixed[i], 1));
+    }
+}
+assertEquals(loaded.join(), "2,4,6.5,8,a,-2,2,4,6.5,8,a,-2,2,4,6.5,8,a,-2", "loads at a mixed site");
+for (var i = 0; i < mixed.length; i++) {
+    if (typeof mixed[i] !== "string") {
+        store(mixed[i], 0, 300);
+    }
+}
+assertEquals([mixed[0][0], mixed[1][0], mixed[2][0], mixed[3][0], mixed[5][0]].join(), "44,300,300,300,300", "stores at a mixed site");
+
+// subclasses and views with an offset
+class Bytes extends Uint8Array {
+}
+var sub = new Bytes(4);
+store(sub, 1, 511);
+assertEquals(load(sub, 1), 255, "store into a subclass");
+var buffer = new ArrayBuffer(16);
+var view = new Int16Array(buffer, 4, 2);
+store(view, 1, -2);
+assertEquals(new Uint8Array(buffer)[6], 254, "store through a view with an offset");
+assertEquals(new Uint8Array(buffer)[7], 255, "high byte through a view with an offset");
+assertEquals(load(view, 1), -2, "load through a view with an offset");
+assertEquals(load(view, 2), undefined, "load past the end of a view");
+
+// elements in bounds shadow indexed properties on the prototype chain
+Object.prototype[1] = "object prototype";
+Uint8Array.prototype[2] = "typed prototype";
+var small = new Uint8Array(4);
+assertEquals(load(small, 1), 0, "Object.prototype index");
+assertEquals(load(small, 2), 0, "Uint8Array.prototype index");
+store(small, 2, 9);
+assertEquals(Uint8Array.prototype[2], "typed prototype", "store does not reach the prototype");
+assertEquals(load(small, 2), 9, "store with an index on the prototype");
+delete Object.prototype[1];
+delete Uint8Array.prototype[2];
+
+// a compound assignment reads and writes through the same element
+var counter = new Uint8Array(1);
+for (var i = 0; i < 300; i++) {
+    counter[0]++;
+}
+assertEquals(counter[0], 300 % 256, "increment wraps");
+var accumulator = new Float32Array(1);
+for (var i = 0; i < 10; i++) {
+    accumulator[0] += 0.1;
+}
+assertEquals(accumulator[0], Math.fround(accumulator[0]), "float32 accumulation is rounded on every store");
@@ -0,0 +1,142 @@
+// %TypedArray%.prototype sort, indexOf, lastIndexOf, fill, reverse, copyWithin, slice and set on raw elements
+
+var types = [Int8Array, Uint8Array, Uint8ClampedArray, Int16Array, Uint16Array, Int32Array, Uint32Array, Float32Array, Float64Array];
+
+var seed = 42;
+function random() {
+    seed = (seed * 1103515245 + 12345) % 2147483648;
+    return seed / 2147483648;
+}
+
+function toArray(typed) {
+    var result = [];
+    for (var i = 0; i < typed.length; i++) {
+        result.push(typed[i]);
+    }
+    return result;
+}
+
+function sameValues(actual, expected, message) {
+    assertEquals(actual.length, expected.length, message + " length");
+    for (var i = 0; i < expected.length; i++) {
+        assertEquals(actual[i], expected[i], message + " index " + i);
+    }
+}
+
+// the order of the spec's default comparator: numeric, -0 before +0, NaN last
+function specCompare(a, b) {
+    if (a !== a) {
+        return b !== b ? 0 : 1;
+    }
+    if (b !== b) {
+        return -1;
+    }
+    if (a < b) {
+        return -1;
+    }
+    if (a > b) {
+        return 1;
+    }
+    if (a === 0 && b === 0) {
+        return (1 / a < 0 ? -1 : 0) - (1 / b < 0 ? -1 : 0);
+    }
+    return 0;
+}
+
+for (var t = 0; t < types.length; t++) {
+    var Type = types[t];
+    var name = Type.name;
+    var values = [];
+    for (var i = 0; i < 500; i++) {
+        values.push((random() - 0.5) * 70000);
+    }
+    if (name === "Float32Array" || name === "Float64Array") {
+        values.push(NaN, -0, 0, Infinity, -Infinity, NaN, -0);
+    }
+    var typed = new Type(values);
+    var reference = toArray(typed);
+
+    // sort without a comparator
+    var sorted = new Type(typed).sort();
+    sameValues(sorted, reference.slice().sort(specCompare), name + " sort");
+    sameValues(new Type(0).sort(), [], name + " sort of an empty array");
+    var withComparator = new Type(typed).sort(function(a, b) { return b - a; });
+    for (var i = 1; i < withComparator.length; i++) {
+        var a = withComparator[i - 1];
+        var b = withComparator[i];
+        assert(!(a < b), name + " comparator sort at " + i);
+    }
+
+    // search
+    var probes = [reference[0], reference[250], reference[499], 1.5, -1, 300, 70000, "5", NaN, -0];
+    for (var i = 0; i < probes.length; i++) {
+        assertEquals(typed.indexOf(probes[i]), reference.indexOf(probes[i]), name + " indexOf " + probes[i]);
+        assertEquals(typed.lastIndexOf(probes[i]), reference.lastIndexOf(probes[i]), name + " lastIndexOf " + probes[i]);
+        assertEquals(typed.indexOf(probes[i], 100), reference.indexOf(probes[i], 100), name + " indexOf from 100 " + probes[i]);
+        assertEquals(typed.lastIndexOf(probes[i], -100), reference.lastIndexOf(probes[i], -100), name + " lastIndexOf from -100 " + probes[i]);
+    }
+
+    // fill and reverse
+    var filled = new Type(20).fill(7, 3, -3);
+    sameValues(filled, [0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0], name + " fill");
+    var converted = new Type(3).fill(300.7);
+    var expectedFill = new Type(1);
+    expectedFill[0] = 300.7;
+    sameValues(converted, [expectedFill[0], expectedFill[0], expectedFill[0]], name + " fill converts once");
+    var order = [];
+    new Type(2).fill({ valueOf: function() { order.push("value"); return 1; } }, { valueOf: function() { order.push("start"); return 0; } });
+    assertEquals(order.join(), "value,start", name + " fill converts the value first");
+    var reversed = new Type(typed).reverse();
+    sameValues(reversed, reference.slice().reverse(), name + " reverse");
+
+    // copies between arrays of the same and of other types
+    var copied = new Type(typed);
+    copied.copyWithin(10, 100, 200);
+    var expectedCopy = reference.slice();
+    for (var i = 0; i < 100; i++) {
+        expectedCopy[10 + i] = reference[100 + i];
+    }
+    sameValues(copied, expectedCopy, name + " copyWithin forward");
+    copied = new Type(typed);
+    copied.copyWithin(150, 100, 250);
+    expectedCopy = reference.slice();
+    for (var i = 0; i < 150 && 150 + i < expectedCopy.length; i++) {
+        expectedCopy[150 + i] = reference[100 + i];
+    }
+    sameValues(copied, expectedCopy, name + " copyWithin overlapping");
+    sameValues(typed.slice(10, 20), reference.slice(10, 20), name + " slice");
+    sameValues(typed.slice(-5), reference.slice(-5), name + " slice from the end");
+    var target = new Type(600);
+    target.set(typed, 50);
+    sameValues(target.subarray(50, 50 + typed.length), reference, name + " set of the same type");
+    var overlap = new Type(typed);
+    overlap.set(overlap.subarray(0, 100), 50);
+    sameValues(overlap.subarray(50, 150), reference.slice(0, 100), name + " set from an overlapping view");
+    var other = types[(t + 1) % types.length];
+    var otherTarget = new other(typed.length);
+    otherTarget.set(typed);
+    sameValues(otherTarget, toArray(new other(reference)), name + " set into " + other.name);
+    assertThrows(function() {
+        target.set(typed, 200);
+    }, RangeError, name + " set past the end");
+}
+
+// views that share one buffer
+var buffer = new ArrayBuffer(16);
+var bytes = new Uint8Array(buffer);
+for (var i = 0; i < 16; i++) {
+    bytes[i] = i;
+}
+new Uint8Array(buffer, 4, 8).set(new Uint8Array(buffer, 0, 8));
+sameValues(bytes, [0, 1, 2, 3, 0, 1, 2, 3, 4, 5, 6, 7, 12, 13, 14, 15], "set between views of one buffer");
+var words = new Uint16Array(buffer, 0, 4);
+new Uint8Array(buffer, 1, 8).set(words);
+sameValues(bytes, [0, 0, 2, 0, 2, 1, 2, 3, 4, 5, 6, 7, 12, 13, 14, 15], "set between views of different types on one buffer");
+
+// a species constructor makes slice take the generic path
+class MyFloat extends Float64Array {
+}
+var mine = new MyFloat([3, 1, 2]);
+assert(mine.slice(0, 2) instanceof MyFloat, "slice uses the species constructor");
+sameValues(mine.slice(0, 2), [3, 1], "species slice values");
+sameValues(mine.sort(), [1, 2, 3], "sort of a subclass");
@@ -0,0 +1,154 @@
+// Array.prototype builtins on dense arrays of 10, 1k and 1M elements
+// usage: escargot tools/benchmark/array-builtins.js
+
+function measure(name, fn) {
+    var start = Date.now();
+    var result = fn();
+    print(name + ": " + (Date.now() - start) + "ms (" + result + ")");
+}
+
+// every measurement touches about this many elements, whatever the array size
+var ELEMENTS = 4000000;
+var SIZES = [10, 1000, 1000000];
+
+function makeArray(size) {
+    var a = [];
+    for (var i = 0; i < size; i++) {
+        a.push(i);
+    }
+    return a;
+}
+
+function add(a, b) {
+    return a + b;
+}
+
+function isOdd(v) {
+    return v & 1;
+}
+
+function twice(v) {
+    return v * 2;
+}
+
+var benchmarks = {
+    indexOf: function(a, rounds) {
+        var r = 0;
+        for (var i = 0; i < rounds; i++) {
+            r += a.indexOf(a.length - 1);
+        }
+        return r;
+    },
+    includes: function(a, rounds) {
+        var r = 0;
+        for (var i = 0; i < rounds; i++) {
+            r += a.includes(-1) ? 1 : 0;
+        }
+        return r;
+    },
+    slice: function(a, rounds) {
+        var r = 0;
+        for (var i = 0; i < rounds; i++) {
+            r += a.slice(0).length;
+        }
+        return r;
+    },
+    splice: function(a, rounds) {
+        var middle = a.length >> 1;
+        for (var i = 0; i < rounds; i++) {
+            a.splice(middle, 0, a.splice(1, 1)[0]);
+        }
+        return a.length;
+    },
+    concat: function(a, rounds) {
+        var r = 0;
+        var b = [1, 2, 3];
+        for (var i = 0; i < rounds; i++) {
+            r += a.concat(b).length;
+        }
+        return r;
+    },
+    map: function(a, rounds) {
+        var r = 0;
+        for (var i = 0; i < rounds; i++) {
+            r += a.map(twice).length;
+        }
+        return r;
+    },
+    filter: function(a, rounds) {
+        var r = 0;
+        for (var i = 0; i < rounds; i++) {
+            r += a.filter(isOdd).length;
+        }
+        return r;
+    },
+    forEach: function(a, rounds) {
+        var r = 0;
+        for (var i = 0; i < rounds; i++) {
+            a.forEach(function(v) {
+                r += v;
+            });
+        }
+        return r;
+    },
+    reduce: function(a, rounds) {
+        var r = 0;
+        for (var i = 0; i < rounds; i++) {
+            r += a.reduce(add, 0);
+        }
+        return r;
+    },
+    join: function(a, rounds) {
+        var r = 0;
+        for (var i = 0; i < rounds; i++) {
+            r += a.join(",").length;
+        }
+        return r;
+    },
+    reverse: function(a, rounds) {
+        for (var i = 0; i < rounds; i++) {
+            a.reverse();
+        }
+        return a[0];
+    },
+    "push/pop": function(a, rounds) {
+        var size = a.length;
+        var b = [];
+        for (var i = 0; i < rounds; i++) {
+            for (var j = 0; j < size; j++) {
+                b.push(j);
+            }
+            while (b.length) {
+                b.pop();
+            }
+        }
+        return size;
+    },
+    "shift/unshift": function(a, rounds) {
+        for (var i = 0; i < rounds; i++) {
+            a.unshift(a.shift());
+        }
+        return a[0];
+    },
+    fill: function(a, rounds) {
+        for (var i = 0; i < rounds; i++) {
+            a.fill(i);
+        }
+        return a[0];
+    }
+};
+
+for (var name in benchmarks) {
+    for (var s = 0; s < SIZES.length; s++) {
+        var size = SIZES[s];
+        var a = makeArray(size);
+        var rounds = Math.max(1, ELEMENTS / size);
+        if (name == "splice" || name == "shift/unshift") {
+            // each call moves about half or all of the array
+            rounds = Math.max(1, rounds / 16);
+        }
+        measure(name + " " + size, function() {
+            return benchmarks[name](a, rounds);
+        });
+    }
+}
@@ -0,0 +1,63 @@
+// Array.prototype.sort on 1M elements: default and comparator sorts of numbers, strings and records
+// usage: escargot tools/benchmark/array-sort.js
+
+function measure(name, fn) {
+    var start = Date.now();
+    var result = fn();
+    print(name + ": " + (Date.now() - start) + "ms (" + result + ")");
+}
+
+var SIZE = 1000000;
+var seed = 42;
+function random(n) {
+    seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+    return seed % n;
+}
+
+var int32s = [];
+var doubles = [];
+var strings = [];
+var records = [];
+var almostSorted = [];
+for (var i = 0; i < SIZE; i++) {
+    var r = random(SIZE * 10);
+    int32s.push(r - SIZE * 5);
+    doubles.push(r / 7);
+    strings.push("key" + r);
+    records.push({ id: i, score: random(1000) });
+    almostSorted.push(random(100) ? i : random(SIZE));
+}
+
+function byNumber(a, b) {
+    return a - b;
+}
+
+measure("default int32", function() {
+    return int32s.slice().sort()[0];
+});
+
+measure("default double", function() {
+    return doubles.slice().sort()[0];
+});
+
+measure("default string", function() {
+    return strings.slice().sort()[0];
+});
+
+measure("comparator int32", function() {
+    return int32s.slice().sort(byNumber)[0];
+});
+
+measure("comparator double", function() {
+    return doubles.slice().sort(byNumber)[0];
+});
+
+measure("comparator records (stable)", function() {
+    return records.slice().sort(function(a, b) {
+        return a.score - b.score;
+    })[0].id;
+});
+
+measure("comparator almost sorted", function() {
+    return almostSorted.slice().sort(byNumber)[SIZE - 1];
+});
@@ -0,0 +1,49 @@
+// Error.stack of errors thrown from many different functions, each read once, as in test runners and loggers
+// usage: escargot tools/benchmark/error-stack.js
+
+function measure(name, fn) {
+    var start = Date.now();
+    var result = fn();
+    print(name + ": " + (Date.now() - start) + "ms (" + result + ")");
+}
+
+var COUNT = 2000;
+
+var source = "var functions = [];\n";
+for (var i = 0; i < COUNT; i++) {
+    source += "functions.push(function f" + i + "(x) {\n" +
+        "    var sum = 0;\n" +
+        "    for (var j = 0; j < x; j++) {\n" +
+        "        sum += j * " + i + ";\n" +
+        "    }\n" +
+        "    if (sum >= 0) {\n" +
+        "        throw new Error('f" + i + "');\n" +
+        "    }\n" +
+        "    return sum;\n" +
+        "});\n";
+}
+eval(source);
+
+measure("stack of errors from distinct functions", function() {
+    var length = 0;
+    for (var i = 0; i < COUNT; i++) {
+        try {
+            functions[i](3);
+        } catch (e) {
+            length += e.stack.length;
+        }
+    }
+    return length;
+});
+
+measure("stack of errors from the same function", function() {
+    var length = 0;
+    for (var i = 0; i < COUNT; i++) {
+        try {
+            functions[0](3);
+        } catch (e) {
+            length += e.stack.length;
+        }
+    }
+    return length;
+});
@@ -0,0 +1,59 @@
+// eval and the Function constructor called repeatedly on the same generated sources, as template engines do
+// usage: escargot tools/benchmark/eval-cache.js
+
+function measure(name, fn) {
+    var start = Date.now();
+    var result = fn();
+    print(name + ": " + (Date.now() - start) + "ms (" + result + ")");
+}
+
+var COUNT = 20000;
+
+var templates = [];
+for (var i = 0; i < 8; i++) {
+    var body = "var out = '';\n";
+    for (var j = 0; j < 10; j++) {
+        body += "out += '<li class=\"item" + j + "\">' + data.name + ' " + i + "</li>';\n";
+        body += "if (data.count > " + j + ") { out += data.count; }\n";
+    }
+    body += "return out;";
+    templates.push(body);
+}
+
+measure("new Function on repeated template sources", function() {
+    var length = 0;
+    var data = { name: "escargot", count: 5 };
+    for (var i = 0; i < COUNT; i++) {
+        var render = new Function("data", templates[i % templates.length]);
+        length += render(data).length;
+    }
+    return length;
+});
+
+measure("indirect eval of repeated expressions", function() {
+    var globalEval = eval;
+    var sum = 0;
+    for (var i = 0; i < COUNT; i++) {
+        sum += globalEval("(function(x) { return x * " + (i % 8) + " + 1; })")(i);
+    }
+    return sum;
+});
+
+measure("direct eval in function", function() {
+    function run(x) {
+        return eval("x * 2 + 1");
+    }
+    var sum = 0;
+    for (var i = 0; i < COUNT; i++) {
+        sum += run(i);
+    }
+    return sum;
+});
+
+measure("eval of distinct sources", function() {
+    var sum = 0;
+    for (var i = 0; i < COUNT / 10; i++) {
+        sum += eval("" + i + " + 1");
+    }
+    return sum;
+});
@@ -0,0 +1,76 @@
+// for-in loops over many same-shaped records, as in deep-clone and merge utilities
+// usage: escargot tools/benchmark/for-in.js
+
+function measure(name, fn) {
+    var start = Date.now();
+    var result = fn();
+    print(name + ": " + (Date.now() - start) + "ms (" + result + ")");
+}
+
+var SIZE = 100000;
+var ROUNDS = 10;
+
+function Point(x, y) {
+    this.x = x;
+    this.y = y;
+}
+
+var records = [];
+var points = [];
+for (var i = 0; i < SIZE; i++) {
+    records.push({ id: i, name: "item" + i, price: i % 100, stock: i % 7, tags: null });
+    points.push(new Point(i, -i));
+}
+
+function clone(object) {
+    var result = {};
+    for (var key in object) {
+        result[key] = object[key];
+    }
+    return result;
+}
+
+measure("count keys of records", function() {
+    var count = 0;
+    for (var r = 0; r < ROUNDS; r++) {
+        for (var i = 0; i < SIZE; i++) {
+            for (var key in records[i]) {
+                count++;
+            }
+        }
+    }
+    return count;
+});
+
+measure("clone records", function() {
+    var sum = 0;
+    for (var r = 0; r < ROUNDS; r++) {
+        for (var i = 0; i < SIZE; i++) {
+            sum += clone(records[i]).price;
+        }
+    }
+    return sum;
+});
+
+measure("merge points into records", function() {
+    var sum = 0;
+    for (var i = 0; i < SIZE; i++) {
+        var target = clone(records[i]);
+        for (var key in points[i]) {
+            target[key] = points[i][key];
+        }
+        sum += target.x - target.y;
+    }
+    return sum;
+});
+
+measure("same object repeatedly", function() {
+    var count = 0;
+    var record = records[0];
+    for (var i = 0; i < SIZE * ROUNDS; i++) {
+        for (var key in record) {
+            count++;
+        }
+    }
+    return count;
+});
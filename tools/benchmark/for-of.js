@@ -0,0 +1,101 @@
+// for-of loops, spread and array destructuring over arrays, strings, Map and Set
+// usage: escargot tools/benchmark/for-of.js
+
+function measure(name, fn) {
+    var start = Date.now();
+    var result = fn();
+    print(name + ": " + (Date.now() - start) + "ms (" + result + ")");
+}
+
+var SIZE = 100000;
+var ROUNDS = 10;
+
+var array = [];
+var text = "";
+var map = new Map();
+var set = new Set();
+for (var i = 0; i < SIZE; i++) {
+    array.push(i);
+    text += String.fromCharCode(97 + i % 26);
+    map.set(i, i * 2);
+    set.add(i);
+}
+
+measure("for-of Array", function() {
+    var sum = 0;
+    for (var r = 0; r < ROUNDS; r++) {
+        for (var v of array) {
+            sum += v;
+        }
+    }
+    return sum;
+});
+
+measure("for-of Array.prototype.entries", function() {
+    var sum = 0;
+    for (var r = 0; r < ROUNDS; r++) {
+        for (var [k, v] of array.entries()) {
+            sum += k + v;
+        }
+    }
+    return sum;
+});
+
+measure("for-of String", function() {
+    var count = 0;
+    for (var r = 0; r < ROUNDS; r++) {
+        for (var c of text) {
+            if (c === "a") {
+                count++;
+            }
+        }
+    }
+    return count;
+});
+
+measure("for-of Map", function() {
+    var sum = 0;
+    for (var r = 0; r < ROUNDS; r++) {
+        for (var [k, v] of map) {
+            sum += v - k;
+        }
+    }
+    return sum;
+});
+
+measure("for-of Set", function() {
+    var sum = 0;
+    for (var r = 0; r < ROUNDS; r++) {
+        for (var v of set) {
+            sum += v;
+        }
+    }
+    return sum;
+});
+
+measure("spread Array", function() {
+    var length = 0;
+    for (var r = 0; r < ROUNDS; r++) {
+        length += [...array].length;
+    }
+    return length;
+});
+
+measure("new Set(Array) x1000", function() {
+    var small = array.slice(0, 100);
+    var size = 0;
+    for (var r = 0; r < 1000; r++) {
+        size += new Set(small).size;
+    }
+    return size;
+});
+
+measure("array destructuring", function() {
+    var pair = [1, 2];
+    var sum = 0;
+    for (var i = 0; i < SIZE * ROUNDS; i++) {
+        var [a, b] = pair;
+        sum += a + b;
+    }
+    return sum;
+});
@@ -0,0 +1,68 @@
+// JSON.parse throughput on ~50MB payloads: records with repeated keys, numeric arrays and escaped strings
+// usage: escargot tools/benchmark/json-parse.js
+
+function measure(name, megabytes, fn) {
+    var start = Date.now();
+    var result = fn();
+    var elapsed = Date.now() - start;
+    print(name + ": " + elapsed + "ms, " + (elapsed ? (megabytes * 1000 / elapsed).toFixed(1) : "inf") + " MB/s (" + result + ")");
+}
+
+var MB = 1024 * 1024;
+
+function buildRecords(targetLength) {
+    var parts = [];
+    var length = 0;
+    for (var i = 0; length < targetLength; i++) {
+        var part = JSON.stringify({
+            id: i,
+            name: "user" + i,
+            email: "user" + i + "@example.com",
+            active: (i % 3) != 0,
+            score: i * 0.25,
+            tags: ["a", "b" + (i % 10)],
+            address: { city: "City " + (i % 100), zip: "" + (10000 + i % 90000) }
+        });
+        parts.push(part);
+        length += part.length + 1;
+    }
+    return "[" + parts.join(",") + "]";
+}
+
+function buildNumbers(targetLength) {
+    var parts = [];
+    var length = 0;
+    for (var i = 0; length < targetLength; i++) {
+        var part = (i % 2) ? "" + (i * 31) : "" + (i / 7);
+        parts.push(part);
+        length += part.length + 1;
+    }
+    return "[" + parts.join(",") + "]";
+}
+
+function buildStrings(targetLength) {
+    var parts = [];
+    var length = 0;
+    for (var i = 0; length < targetLength; i++) {
+        var part = JSON.stringify("line " + i + "\n\t\"quoted\" café 가나 end");
+        parts.push(part);
+        length += part.length + 1;
+    }
+    return "[" + parts.join(",") + "]";
+}
+
+var records = buildRecords(50 * MB);
+var numbers = buildNumbers(50 * MB);
+var strings = buildStrings(50 * MB);
+
+measure("records 50MB", records.length / MB, function() {
+    return JSON.parse(records).length;
+});
+
+measure("numbers 50MB", numbers.length / MB, function() {
+    return JSON.parse(numbers).length;
+});
+
+measure("escaped UTF-16 strings 50MB", strings.length / MB, function() {
+    return JSON.parse(strings).length;
+});
@@ -0,0 +1,66 @@
+// JSON.stringify on API-response-like objects: many small responses, one large listing and escaped text
+// usage: escargot tools/benchmark/json-stringify.js
+
+function measure(name, fn) {
+    var start = Date.now();
+    var result = fn();
+    print(name + ": " + (Date.now() - start) + "ms (" + result + ")");
+}
+
+function makeItem(i) {
+    return {
+        id: i,
+        slug: "item-" + i,
+        title: "Item number " + i,
+        price: (i % 1000) / 4,
+        inStock: i % 7 != 0,
+        rating: null,
+        author: { id: i % 50, name: "Author " + (i % 50), verified: true },
+        tags: ["tag" + (i % 5), "tag" + (i % 11)],
+        createdAt: "2024-05-" + (10 + i % 20) + "T12:00:00.000Z"
+    };
+}
+
+function makeResponse(offset, count) {
+    var items = [];
+    for (var i = 0; i < count; i++) {
+        items.push(makeItem(offset + i));
+    }
+    return {
+        status: "ok",
+        data: { items: items, page: { offset: offset, count: count, total: 100000 } },
+        meta: { requestId: "req-" + offset, elapsedMs: 12 }
+    };
+}
+
+var responses = [];
+for (var i = 0; i < 200; i++) {
+    responses.push(makeResponse(i * 20, 20));
+}
+var listing = makeResponse(0, 100000);
+var texts = [];
+for (var i = 0; i < 20000; i++) {
+    texts.push({ id: i, body: "line one\nline \"two\"\twith tab, café and 가나다 " + i });
+}
+
+measure("200 responses x 20 items, 10 rounds", function() {
+    var length = 0;
+    for (var round = 0; round < 10; round++) {
+        for (var i = 0; i < responses.length; i++) {
+            length += JSON.stringify(responses[i]).length;
+        }
+    }
+    return length;
+});
+
+measure("listing of 100k items", function() {
+    return JSON.stringify(listing).length;
+});
+
+measure("20k records with escaped UTF-16 text", function() {
+    return JSON.stringify(texts).length;
+});
+
+measure("listing of 100k items, indented", function() {
+    return JSON.stringify(listing, null, 2).length;
+});
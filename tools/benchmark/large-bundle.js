@@ -0,0 +1,56 @@
+// parse latency of large generated bundles with many functions in one scope, as produced by module bundlers
+// usage: escargot tools/benchmark/large-bundle.js
+
+function measure(name, fn) {
+    var start = Date.now();
+    var result = fn();
+    print(name + ": " + (Date.now() - start) + "ms (" + result + ")");
+}
+
+function makeBundle(size, wrapInFunction) {
+    var parts = [wrapInFunction ? "(function() {\nvar modules = [];\n" : "var modules = [];\n"];
+    var length = 0;
+    for (var i = 0; length < size; i++) {
+        var part = "modules[" + i + "] = function(exports) {\n"
+            + "  var message = 'hello module " + i + "';\n"
+            + "  var table = [1, 2, 3, 4, 5, 6, 7, 8];\n"
+            + "  exports.run = function(x) { for (var k = 0; k < table.length; k++) { x += table[k] * k; } return message.length + x; };\n"
+            + "  return exports;\n"
+            + "};\n";
+        parts.push(part);
+        length += part.length;
+    }
+    parts.push(wrapInFunction ? "return modules[1]({}).run(1);\n})()" : "modules[1]({}).run(1)");
+    return parts.join("");
+}
+
+// scope hoisting bundlers put every module's declarations into one function scope
+function makeHoistedBundle(count) {
+    var parts = ["(function() {\n'use strict';\n"];
+    for (var i = 0; i < count; i++) {
+        parts.push("var value" + i + " = " + i + ";\n");
+        parts.push("function helper" + i + "(a, b) { if (a > value" + i + ") { return helper" + ((i * 7) % count) + "(b, a) + value" + ((i * 13) % count) + "; } return a + b; }\n");
+    }
+    parts.push("return helper1(1, 2);\n})()");
+    return parts.join("");
+}
+
+var globalEval = eval;
+[1, 4].forEach(function(mb) {
+    var flat = makeBundle(mb * 1024 * 1024, false);
+    measure(mb + "MB bundle with functions at top level", function() {
+        return globalEval(flat);
+    });
+
+    var wrapped = makeBundle(mb * 1024 * 1024, true);
+    measure(mb + "MB bundle wrapped in a function", function() {
+        return globalEval(wrapped);
+    });
+});
+
+[2000, 8000].forEach(function(count) {
+    var hoisted = makeHoistedBundle(count);
+    measure(count + " declarations hoisted into one function", function() {
+        return globalEval(hoisted);
+    });
+});
@@ -0,0 +1,91 @@
+// parse throughput in tokens per second for minified, commented and non-Latin1 sources
+// usage: escargot tools/benchmark/lexer-scan.js
+//        escargot -e "var LIBRARIES = ['path/to/library.js']" tools/benchmark/lexer-scan.js
+
+var ROUNDS = 5;
+
+// approximate, only used to report throughput.
+// regular expression literals are not recognized, so sources with many of them are undercounted
+function countTokens(source) {
+    var tokenPattern = /\/\/[^\n]*|\/\*[^*]*\*+(?:[^\/*][^*]*\*+)*\/|"[^"\\\n]*(?:\\.[^"\\\n]*)*"|'[^'\\\n]*(?:\\.[^'\\\n]*)*'|[A-Za-z_$\u00C0-\uFFFF][\w$\u00C0-\uFFFF]*|\d[\w.]*|\S/g;
+    var count = 0;
+    var match;
+    while ((match = tokenPattern.exec(source)) !== null) {
+        if (match[0][0] !== "/" || (match[0][1] !== "/" && match[0][1] !== "*")) {
+            count++;
+        }
+    }
+    return count;
+}
+
+function measureParse(name, source) {
+    var tokens = countTokens(source);
+    var start = Date.now();
+    for (var i = 0; i < ROUNDS; i++) {
+        new Function(source);
+    }
+    var elapsed = Date.now() - start;
+    elapsed = Math.max(elapsed, 1);
+    print(name + ": " + elapsed + "ms (" + Math.round(tokens * ROUNDS / elapsed) + " ktokens/s, " + Math.round(source.length * ROUNDS / elapsed) + " kchars/s)");
+}
+
+function makeMinified(size) {
+    var parts = [];
+    var length = 0;
+    for (var i = 0; length < size; i++) {
+        var part = "defineModule(" + i + ",function(requireModuleFunction,exportsObjectReference){"
+            + "var errorMessageTemplate='The value passed to createElementWithAttributes is not valid: expected an object but got '+typeof requireModuleFunction;"
+            + "if(exportsObjectReference.hasOwnPropertyDescriptor&&requireModuleFunction.configurationSettings){throw new TypeError(errorMessageTemplate)}"
+            + "return exportsObjectReference.defineComponentProperties(\"componentDidMountLifecycle\",requireModuleFunction.configurationSettings)});";
+        parts.push(part);
+        length += part.length;
+    }
+    return parts.join("");
+}
+
+function makeCommented(size) {
+    var parts = [];
+    var length = 0;
+    for (var i = 0; length < size; i++) {
+        var part = "/**\n"
+            + " * Creates an element with the given attributes and appends it to the parent node.\n"
+            + " * The attributes are copied, so later changes to the object do not affect the element.\n"
+            + " * @param {Object} parent the node the new element is appended to\n"
+            + " * @return {Object} the new element\n"
+            + " */\n"
+            + "elements.create" + i + " = function(parent, attributes) {\n"
+            + "    // copy the attributes before touching the parent node, as the caller may reuse them\n"
+            + "    var copied = {};\n"
+            + "    for (var key in attributes) {\n"
+            + "        copied[key] = attributes[key]; // shallow copy is enough here\n"
+            + "    }\n"
+            + "    return parent.appendChild(copied);\n"
+            + "};\n\n";
+        parts.push(part);
+        length += part.length;
+    }
+    return parts.join("");
+}
+
+function makeNonLatin1(size) {
+    var parts = [];
+    var length = 0;
+    for (var i = 0; length < size; i++) {
+        var part = "messages[" + i + "] = { title: '설정 화면을 열 수 없습니다', detail: '네트워크 연결을 확인하고 다시 시도하세요' };\n"
+            + "// — 사용자에게 보여 주는 메시지들\n"
+            + "dialogs[" + i + "] = function(dialogElement) { return dialogElement.render(messages[" + i + "].title, messages[" + i + "].detail); };\n";
+        parts.push(part);
+        length += part.length;
+    }
+    return parts.join("");
+}
+
+measureParse("minified 1MB", makeMinified(1024 * 1024));
+measureParse("commented 1MB", makeCommented(1024 * 1024));
+measureParse("non-Latin1 1MB", makeNonLatin1(1024 * 1024));
+
+if (typeof LIBRARIES !== "undefined") {
+    LIBRARIES.forEach(function(path) {
+        measureParse(path, read(path));
+    });
+}
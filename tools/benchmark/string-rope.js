@@ -0,0 +1,58 @@
+// incremental string building interleaved with reads
+// usage: escargot tools/benchmark/string-rope.js
+
+function measure(name, fn) {
+    var start = Date.now();
+    var result = fn();
+    print(name + ": " + (Date.now() - start) + "ms (" + result + ")");
+}
+
+var ITERATIONS = 20000;
+
+measure("append + charAt(last)", function() {
+    var s = "";
+    var sum = 0;
+    for (var i = 0; i < ITERATIONS; i++) {
+        s += "piece" + i + ";";
+        sum += s.charCodeAt(s.length - 1);
+    }
+    return sum;
+});
+
+measure("append + charAt(middle)", function() {
+    var s = "";
+    var sum = 0;
+    for (var i = 0; i < ITERATIONS; i++) {
+        s += "piece" + i + ";";
+        sum += s.charCodeAt(s.length >> 1);
+    }
+    return sum;
+});
+
+measure("append + slice(tail)", function() {
+    var s = "";
+    var total = 0;
+    for (var i = 0; i < ITERATIONS; i++) {
+        s += "piece" + i + ";";
+        total += s.slice(-16).length;
+    }
+    return total;
+});
+
+measure("append + substring(head)", function() {
+    var s = "";
+    var total = 0;
+    for (var i = 0; i < ITERATIONS; i++) {
+        s = "piece" + i + ";" + s;
+        total += s.substring(0, 40).length;
+    }
+    return total;
+});
+
+measure("append only", function() {
+    var s = "";
+    for (var i = 0; i < ITERATIONS * 10; i++) {
+        s += "piece" + i + ";";
+    }
+    return s.length;
+});
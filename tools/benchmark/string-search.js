@@ -0,0 +1,98 @@
+// indexOf/lastIndexOf/includes/split/compare over MB-sized haystacks
+// usage: escargot tools/benchmark/string-search.js
+
+function measure(name, fn) {
+    var start = Date.now();
+    var result = fn();
+    print(name + ": " + (Date.now() - start) + "ms (" + result + ")");
+}
+
+function repeat(unit, length) {
+    var s = unit;
+    while (s.length < length) {
+        s += s;
+    }
+    return s.substring(0, length);
+}
+
+var MB = 1024 * 1024;
+var ROUNDS = 20;
+
+var latin1 = repeat("lorem ipsum dolor sit amet, consectetur adipiscing elit ", 4 * MB);
+var utf16 = repeat("가나다 라마바 사아자 ", 4 * MB);
+var needleShort = "zq";
+var needleLong = "consectetur adipiscing elit! sed do eiusmod";
+var needleLong16 = "가나다 라마바 사아자!";
+var latin1Copy = latin1.substring(0, latin1.length - 1) + "!";
+
+measure("8-bit indexOf(single char, miss) 4MB", function() {
+    var r = 0;
+    for (var i = 0; i < ROUNDS; i++) {
+        r += latin1.indexOf("#");
+    }
+    return r;
+});
+
+measure("8-bit indexOf(short needle, miss) 4MB", function() {
+    var r = 0;
+    for (var i = 0; i < ROUNDS; i++) {
+        r += latin1.indexOf(needleShort);
+    }
+    return r;
+});
+
+measure("8-bit indexOf(long needle, partial matches) 4MB", function() {
+    var r = 0;
+    for (var i = 0; i < ROUNDS; i++) {
+        r += latin1.indexOf(needleLong);
+    }
+    return r;
+});
+
+measure("8-bit lastIndexOf(short needle, miss) 4MB", function() {
+    var r = 0;
+    for (var i = 0; i < ROUNDS; i++) {
+        r += latin1.lastIndexOf(needleShort);
+    }
+    return r;
+});
+
+measure("16-bit indexOf(single char, miss) 4MB", function() {
+    var r = 0;
+    for (var i = 0; i < ROUNDS; i++) {
+        r += utf16.indexOf("あ");
+    }
+    return r;
+});
+
+measure("16-bit includes(long needle, partial matches) 4MB", function() {
+    var r = 0;
+    for (var i = 0; i < ROUNDS; i++) {
+        r += utf16.includes(needleLong16) ? 1 : 0;
+    }
+    return r;
+});
+
+measure("16-bit haystack, 8-bit needle 4MB", function() {
+    var r = 0;
+    for (var i = 0; i < ROUNDS; i++) {
+        r += utf16.indexOf(needleShort);
+    }
+    return r;
+});
+
+measure("8-bit split(long separator) 4MB", function() {
+    var r = 0;
+    for (var i = 0; i < ROUNDS; i++) {
+        r += latin1.split("adipiscing elit lorem").length;
+    }
+    return r;
+});
+
+measure("8-bit equality and compare 4MB", function() {
+    var r = 0;
+    for (var i = 0; i < ROUNDS; i++) {
+        r += (latin1 == latin1Copy ? 1 : 0) + (latin1 < latin1Copy ? 1 : 0);
+    }
+    return r;
+});
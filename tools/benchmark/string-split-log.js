@@ -0,0 +1,67 @@
+// splitting a large log into lines and fields, keeping a few matches alive
+// usage: escargot tools/benchmark/string-split-log.js
+// run under a memory profiler (e.g. /usr/bin/time -v) to compare peak memory
+
+function measure(name, fn) {
+    var start = Date.now();
+    var result = fn();
+    print(name + ": " + (Date.now() - start) + "ms (" + result + ")");
+}
+
+var LINES = 100000;
+var parts = [];
+for (var i = 0; i < LINES; i++) {
+    var level = (i % 97 == 0) ? "ERROR" : "INFO";
+    parts.push("2024-05-" + (10 + i % 20) + "T12:" + (10 + i % 50) + ":00.000Z " + level + " [worker-" + (i % 8) + "] request id=" + i + " path=/api/v1/items/" + (i * 7) + " status=200 latency=" + (i % 300) + "ms");
+}
+var log = parts.join("\n");
+parts = null;
+print("log size: " + log.length + " chars");
+
+var kept = [];
+
+measure("split lines", function() {
+    return log.split("\n").length;
+});
+
+measure("split lines + fields", function() {
+    var lines = log.split("\n");
+    var fields = 0;
+    for (var i = 0; i < lines.length; i++) {
+        fields += lines[i].split(" ").length;
+    }
+    return fields;
+});
+
+measure("split lines + keep ERROR lines", function() {
+    var lines = log.split("\n");
+    for (var i = 0; i < lines.length; i++) {
+        if (lines[i].indexOf(" ERROR ") > 0) {
+            kept.push(lines[i]);
+        }
+    }
+    return kept.length;
+});
+
+measure("regexp match pieces", function() {
+    var re = /id=(\d+) path=(\S+)/g;
+    var m;
+    var count = 0;
+    while ((m = re.exec(log)) !== null) {
+        count += m[2].length;
+    }
+    return count;
+});
+
+measure("slice long tail", function() {
+    var total = 0;
+    for (var i = 0; i < 1000; i++) {
+        total += log.slice(i, log.length - i).length;
+    }
+    return total;
+});
+
+// drop the log; with the compaction policy only the kept lines stay alive
+log = null;
+gc();
+print("kept lines: " + kept.length);
@@ -0,0 +1,90 @@
+// case conversion, trim and UTF-8 transcoding throughput on header/CSV-like text
+// usage: escargot tools/benchmark/string-transcode.js
+
+function measure(name, megabytes, fn) {
+    var start = Date.now();
+    var result = fn();
+    var elapsed = Date.now() - start;
+    print(name + ": " + elapsed + "ms, " + (elapsed ? (megabytes * 1000 / elapsed).toFixed(1) : "inf") + " MB/s (" + result + ")");
+}
+
+function repeat(unit, length) {
+    var s = unit;
+    while (s.length < length) {
+        s += s;
+    }
+    return s.substring(0, length);
+}
+
+var MB = 1024 * 1024;
+var ROUNDS = 16;
+
+var header = repeat("Content-Type: Text/HTML; Charset=UTF-8\r\nX-Request-Id: 0AF3-B9C2\r\n", MB);
+var latin1 = repeat("Café Crème, Straße 12; ", MB);
+var utf16 = repeat("Header: value 가나다 ASCII tail after the wide part\r\n", MB);
+var padded = "   \t\t  " + repeat("id,name,price,qty;", MB) + "  \r\n  ";
+var csvLines = [];
+for (var i = 0; i < 20000; i++) {
+    csvLines.push("   " + i + ",Widget " + i + ",12.50,3\t  ");
+}
+
+measure("toLowerCase ASCII 1MB", ROUNDS, function() {
+    var r = 0;
+    for (var i = 0; i < ROUNDS; i++) {
+        r += header.toLowerCase().length;
+    }
+    return r;
+});
+
+measure("toUpperCase ASCII 1MB", ROUNDS, function() {
+    var r = 0;
+    for (var i = 0; i < ROUNDS; i++) {
+        r += header.toUpperCase().length;
+    }
+    return r;
+});
+
+measure("toLowerCase Latin1 1MB", ROUNDS, function() {
+    var r = 0;
+    for (var i = 0; i < ROUNDS; i++) {
+        r += latin1.toLowerCase().length;
+    }
+    return r;
+});
+
+measure("toUpperCase UTF-16 1MB", ROUNDS, function() {
+    var r = 0;
+    for (var i = 0; i < ROUNDS; i++) {
+        r += utf16.toUpperCase().length;
+    }
+    return r;
+});
+
+measure("trim 1MB", ROUNDS, function() {
+    var r = 0;
+    for (var i = 0; i < ROUNDS; i++) {
+        r += padded.trim().length + header.trim().length;
+    }
+    return r;
+});
+
+measure("trim short CSV lines", csvLines.length * 30 * ROUNDS / MB, function() {
+    var r = 0;
+    for (var i = 0; i < ROUNDS; i++) {
+        for (var j = 0; j < csvLines.length; j++) {
+            r += csvLines[j].trim().length;
+        }
+    }
+    return r;
+});
+
+// read() decodes the file through String::fromUTF8; this file mixes ASCII, Latin1 and Hangul text
+var SELF = "tools/benchmark/string-transcode.js";
+var selfLength = read(SELF).length;
+measure("UTF-8 decode via read()", selfLength * 500 / MB, function() {
+    var r = 0;
+    for (var i = 0; i < 500; i++) {
+        r += read(SELF).length;
+    }
+    return r;
+});
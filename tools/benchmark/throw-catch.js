@@ -0,0 +1,102 @@
+// exceptions thrown from nested calls and caught without reading their stack, as in validation and parsing code
+// usage: escargot tools/benchmark/throw-catch.js
+
+function measure(name, fn) {
+    var start = Date.now();
+    var result = fn();
+    print(name + ": " + (Date.now() - start) + "ms (" + result + ")");
+}
+
+var COUNT = 20000;
+
+function fail(depth) {
+    if (depth === 0) {
+        throw new Error("fail");
+    }
+    return fail(depth - 1) + 1;
+}
+
+function parseDigit(c) {
+    var n = parseInt(c);
+    if (isNaN(n)) {
+        throw new TypeError("not a digit: " + c);
+    }
+    return n;
+}
+
+measure("throw Error and catch", function() {
+    var count = 0;
+    for (var i = 0; i < COUNT; i++) {
+        try {
+            throw new Error("e");
+        } catch (e) {
+            count++;
+        }
+    }
+    return count;
+});
+
+measure("throw from 10 frames deep and catch", function() {
+    var count = 0;
+    for (var i = 0; i < COUNT; i++) {
+        try {
+            fail(10);
+        } catch (e) {
+            count++;
+        }
+    }
+    return count;
+});
+
+measure("throw from 100 frames deep and catch", function() {
+    var count = 0;
+    for (var i = 0; i < COUNT / 10; i++) {
+        try {
+            fail(100);
+        } catch (e) {
+            count++;
+        }
+    }
+    return count;
+});
+
+measure("built-in TypeError through native frames", function() {
+    var count = 0;
+    for (var i = 0; i < COUNT; i++) {
+        try {
+            [1, 2, 3].forEach(function(v) {
+                null.x;
+            });
+        } catch (e) {
+            count++;
+        }
+    }
+    return count;
+});
+
+measure("validation failures", function() {
+    var input = "12a45b78c9";
+    var sum = 0;
+    for (var i = 0; i < COUNT / 10; i++) {
+        for (var j = 0; j < input.length; j++) {
+            try {
+                sum += parseDigit(input[j]);
+            } catch (e) {
+                sum--;
+            }
+        }
+    }
+    return sum;
+});
+
+measure("throw non-error value and catch", function() {
+    var count = 0;
+    for (var i = 0; i < COUNT; i++) {
+        try {
+            throw i;
+        } catch (e) {
+            count += e & 1;
+        }
+    }
+    return count;
+});
@@ -0,0 +1,71 @@
+// indexed reads and writes in tight loops over typed arrays, with a plain array for comparison
+// usage: escargot tools/benchmark/typed-array-access.js
+
+function measure(name, fn) {
+    var start = Date.now();
+    var result = fn();
+    print(name + ": " + (Date.now() - start) + "ms (" + result + ")");
+}
+
+var SIZE = 1 << 20;
+var ROUNDS = 10;
+
+var pixels = new Uint8Array(SIZE);
+var words = new Int32Array(SIZE);
+var xs = new Float64Array(SIZE);
+var ys = new Float64Array(SIZE);
+var plain = [];
+for (var i = 0; i < SIZE; i++) {
+    pixels[i] = i & 0xff;
+    words[i] = i * 2654435761;
+    xs[i] = i / SIZE;
+    ys[i] = 1 - i / SIZE;
+    plain.push(i & 0xff);
+}
+
+measure("Uint8Array invert", function() {
+    for (var r = 0; r < ROUNDS; r++) {
+        for (var i = 0; i < SIZE; i++) {
+            pixels[i] = 255 - pixels[i];
+        }
+    }
+    return pixels[1];
+});
+
+measure("Array invert", function() {
+    for (var r = 0; r < ROUNDS; r++) {
+        for (var i = 0; i < SIZE; i++) {
+            plain[i] = 255 - plain[i];
+        }
+    }
+    return plain[1];
+});
+
+measure("Int32Array checksum", function() {
+    var h = 0;
+    for (var r = 0; r < ROUNDS; r++) {
+        for (var i = 0; i < SIZE; i++) {
+            h = (h + words[i]) | 0;
+        }
+    }
+    return h;
+});
+
+measure("Float64Array dot product", function() {
+    var s = 0;
+    for (var r = 0; r < ROUNDS; r++) {
+        for (var i = 0; i < SIZE; i++) {
+            s += xs[i] * ys[i];
+        }
+    }
+    return Math.round(s);
+});
+
+measure("Uint8Array to Float64Array", function() {
+    for (var r = 0; r < ROUNDS; r++) {
+        for (var i = 0; i < SIZE; i++) {
+            xs[i] = pixels[i] / 255;
+        }
+    }
+    return xs[3];
+});
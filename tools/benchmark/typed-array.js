@@ -0,0 +1,84 @@
+// %TypedArray%.prototype bulk operations on 1M-element Int32Array, Uint8Array and Float64Array
+// usage: escargot tools/benchmark/typed-array.js
+
+function measure(name, fn) {
+    var start = Date.now();
+    var result = fn();
+    print(name + ": " + (Date.now() - start) + "ms (" + result + ")");
+}
+
+var SIZE = 1000000;
+var seed = 42;
+function random(n) {
+    seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+    return seed % n;
+}
+
+var int32s = new Int32Array(SIZE);
+var bytes = new Uint8Array(SIZE);
+var doubles = new Float64Array(SIZE);
+for (var i = 0; i < SIZE; i++) {
+    int32s[i] = random(SIZE * 10) - SIZE * 5;
+    bytes[i] = random(200);
+    doubles[i] = (random(SIZE) - SIZE / 2) / 7;
+}
+bytes[SIZE - 1] = 255;
+int32s[SIZE - 1] = SIZE * 10;
+doubles[SIZE - 1] = NaN;
+
+[["Int32Array", int32s, SIZE * 10], ["Uint8Array", bytes, 255], ["Float64Array", doubles, 0.5]].forEach(function(entry) {
+    var name = entry[0];
+    var array = entry[1];
+    var missing = entry[2];
+    var copy = new array.constructor(SIZE);
+
+    measure(name + " sort", function() {
+        copy.set(array);
+        return copy.sort()[0];
+    });
+    measure(name + " indexOf x10", function() {
+        var r = 0;
+        for (var i = 0; i < 10; i++) {
+            r += array.indexOf(missing);
+        }
+        return r;
+    });
+    measure(name + " lastIndexOf x10", function() {
+        var r = 0;
+        for (var i = 0; i < 10; i++) {
+            r += array.lastIndexOf(array[0]);
+        }
+        return r;
+    });
+    measure(name + " fill x10", function() {
+        for (var i = 0; i < 10; i++) {
+            copy.fill(i);
+        }
+        return copy[0];
+    });
+    measure(name + " reverse x10", function() {
+        for (var i = 0; i < 10; i++) {
+            copy.reverse();
+        }
+        return copy[0];
+    });
+    measure(name + " set x10", function() {
+        for (var i = 0; i < 10; i++) {
+            copy.set(array);
+        }
+        return copy[0];
+    });
+    measure(name + " slice x10", function() {
+        var r = 0;
+        for (var i = 0; i < 10; i++) {
+            r += array.slice(i).length;
+        }
+        return r;
+    });
+    measure(name + " copyWithin x10", function() {
+        for (var i = 0; i < 10; i++) {
+            copy.copyWithin(1, 0);
+        }
+        return copy[0];
+    });
+});
@@ -331,6 +331,23 @@ def run_regression_tests(engine, arch):
         raise Exception("Regression tests failed")
 
 
+@runner('internal-regression-tests', default=True)
+def run_internal_regression_tests(engine, arch):
+    REGRESSION_DIR = join(PROJECT_SOURCE_DIR, 'test', 'regression-tests')
+    REGRESSION_ASSERT_JS = join(REGRESSION_DIR, 'assert.js')
+
+    print('Running internal regression tests:')
+    files = sorted(f for f in glob(join(REGRESSION_DIR, '*.js')) if f != REGRESSION_ASSERT_JS)
+    fail_total = _run_regression_tests(engine, REGRESSION_ASSERT_JS, files, False)
+
+    print('TOTAL: %d' % (len(files)))
+    print('%sPASS : %d%s' % (COLOR_GREEN, len(files) - fail_total, COLOR_RESET))
+    print('%sFAIL : %d%s' % (COLOR_RED, fail_total, COLOR_RESET))
+
+    if fail_total > 0:
+        raise Exception("Internal regression tests failed")
+
+
 def _run_jetstream(engine, target_test):
     JETSTREAM_OVERRIDE_DIR = join(PROJECT_SOURCE_DIR, 'tools', 'test', 'jetstream')
     JETSTREAM_DIR = join(PROJECT_SOURCE_DIR, 'test', 'vendortest', 'JetStream-1.1')